@@ -1,13 +1,41 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20260606
+dnl Version: 20260628
 
 dnl Function to detect if libmodi dependencies are available
 AC_DEFUN([AX_LIBMODI_CHECK_LOCAL],
   [dnl Check for internationalization functions in libmodi/libmodi_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers and functions included in libmodi/libmodi_mapped_file.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h sys/types.h unistd.h])
+  AC_CHECK_FUNCS([clock_gettime close fstat mmap munmap open posix_fadvise posix_memalign pread])
 ])
 
+dnl Function to detect whether statistics support should be disabled
+AC_DEFUN([AX_LIBMODI_CHECK_ENABLE_STATISTICS],
+  [AX_COMMON_ARG_DISABLE(
+    [statistics],
+    [statistics],
+    [statistics support])
+
+  AS_IF(
+    [test "x$ac_cv_enable_statistics" != xno],
+    [AC_DEFINE(
+      [HAVE_STATISTICS],
+      [1],
+      [Define to 1 if statistics should be maintained.])
+    AC_SUBST(
+      [HAVE_STATISTICS],
+      [1])
+
+    ac_cv_enable_statistics=yes],
+    [AC_SUBST(
+      [HAVE_STATISTICS],
+      [0])
+    ])
+  ])
+
 dnl Function to check if DLL support is needed
 AC_DEFUN([AX_LIBMODI_CHECK_DLL_SUPPORT],
   [AS_IF(
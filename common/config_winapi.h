@@ -91,6 +91,12 @@
 #define HAVE_MULTI_THREAD_SUPPORT	1
 #endif
 
+/* If not controlled by config.h enable statistics
+ */
+#if !defined( HAVE_CONFIG_H ) && !defined( HAVE_STATISTICS )
+#define HAVE_STATISTICS			1
+#endif
+
 #endif /* defined( WINAPI ) */
 
 #endif /* !defined( _CONFIG_WINAPI_H ) */
@@ -32,6 +32,7 @@
 #include "libmodi_libcnotify.h"
 #include "libmodi_libfdata.h"
 #include "libmodi_libfcache.h"
+#include "libmodi_statistics.h"
 #include "libmodi_unused.h"
 
 /* Creates bands data handle
@@ -111,6 +112,8 @@ int libmodi_bands_data_handle_initialize(
 
 		return( -1 );
 	}
+	( *data_handle )->io_handle = io_handle;
+
 	if( libfdata_vector_initialize(
 	     &( ( *data_handle )->bands_vector ),
 	     (size64_t) 512,
@@ -267,6 +270,65 @@ int libmodi_bands_data_handle_append_segment(
 	return( 1 );
 }
 
+/* Sets the maximum cache size
+ * The number of cached bands is limited so that their combined size does not exceed
+ * the maximum cache size, with a minimum of 1. A maximum cache size of 0 restores
+ * the default number of cache entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_bands_data_handle_set_maximum_cache_size(
+     libmodi_bands_data_handle_t *data_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libmodi_bands_data_handle_set_maximum_cache_size";
+	size64_t element_size     = 0;
+	int maximum_cache_entries = LIBMODI_MAXIMUM_CACHE_ENTRIES_DATA_BANDS;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bands vector caches elements of 512 bytes
+	 */
+	element_size = (size64_t) 512;
+
+	if( ( maximum_cache_size > 0 )
+	 && ( element_size > 0 ) )
+	{
+		if( ( maximum_cache_size / element_size ) < (size64_t) maximum_cache_entries )
+		{
+			maximum_cache_entries = (int) ( maximum_cache_size / element_size );
+		}
+		if( maximum_cache_entries < 1 )
+		{
+			maximum_cache_entries = 1;
+		}
+	}
+	if( libfcache_cache_resize(
+	     data_handle->bands_cache,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize bands cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads data from the current offset into a compressed
  * Callback for the data stream
  * Returns the number of bytes read or -1 on error
@@ -303,6 +365,17 @@ ssize_t libmodi_bands_data_handle_read_segment_data(
 
 		return( -1 );
 	}
+	if( data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( data_handle->current_offset < 0 )
 	{
 		libcerror_error_set(
@@ -413,6 +486,17 @@ ssize_t libmodi_bands_data_handle_read_segment_data(
 
 			return( -1 );
 		}
+		/* The cache misses are counted by the element data read callback,
+		 * which creates the data block
+		 */
+		if( data_block->is_cached != 0 )
+		{
+			LIBMODI_STATISTICS_ADD(
+			 data_handle->io_handle->statistics.number_of_cache_hits,
+			 1 );
+		}
+		data_block->is_cached = 1;
+
 		if( ( element_data_offset < 0 )
 		 || ( (size64_t) element_data_offset >= data_block->data_size ) )
 		{
@@ -39,6 +39,10 @@ typedef struct libmodi_bands_data_handle libmodi_bands_data_handle_t;
 
 struct libmodi_bands_data_handle
 {
+	/* The IO handle
+	 */
+	libmodi_io_handle_t *io_handle;
+
 	/* The current offset
 	 */
 	off64_t current_offset;
@@ -73,6 +77,11 @@ int libmodi_bands_data_handle_append_segment(
      uint32_t segment_flags,
      libcerror_error_t **error );
 
+int libmodi_bands_data_handle_set_maximum_cache_size(
+     libmodi_bands_data_handle_t *data_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
 ssize_t libmodi_bands_data_handle_read_segment_data(
          libmodi_bands_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
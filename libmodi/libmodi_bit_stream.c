@@ -194,11 +194,7 @@ int libmodi_bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error )
 {
-	static char *function            = "libmodi_bit_stream_get_value";
-	uint32_t read_value_32bit        = 0;
-	uint32_t safe_value_32bit        = 0;
-	uint8_t read_number_of_bits      = 0;
-	uint8_t remaining_number_of_bits = 0;
+	static char *function = "libmodi_bit_stream_get_value";
 
 	if( bit_stream == NULL )
 	{
@@ -233,81 +229,191 @@ int libmodi_bit_stream_get_value(
 
 		return( -1 );
 	}
-	remaining_number_of_bits = number_of_bits;
-
-	while( remaining_number_of_bits > 0 )
+	/* The bit buffer is refilled a byte at a time so that reading beyond
+	 * the end of the byte stream is reported as an error, the decoding hot
+	 * loops use the LIBMODI_BIT_STREAM_REFILL macros instead
+	 */
+	while( number_of_bits > bit_stream->bit_buffer_size )
 	{
-		while( ( remaining_number_of_bits > bit_stream->bit_buffer_size )
-		    && ( bit_stream->bit_buffer_size <= 24 ) )
+		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
 		{
-			if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid byte stream offset value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
-			{
-				bit_stream->bit_buffer |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
-			}
-			else if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
-			{
-				bit_stream->bit_buffer <<= 8;
-				bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
-			}
-			bit_stream->bit_buffer_size    += 8;
-			bit_stream->byte_stream_offset += 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			return( -1 );
 		}
-		if( remaining_number_of_bits < bit_stream->bit_buffer_size )
+		if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
 		{
-			read_number_of_bits = remaining_number_of_bits;
+			bit_stream->bit_buffer |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
 		}
-		else
+		else if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
 		{
-			read_number_of_bits = bit_stream->bit_buffer_size;
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
 		}
-		read_value_32bit = bit_stream->bit_buffer;
+		bit_stream->bit_buffer_size    += 8;
+		bit_stream->byte_stream_offset += 1;
+	}
+	if( number_of_bits == 0 )
+	{
+		*value_32bit = 0;
+	}
+	else if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		*value_32bit = (uint32_t) LIBMODI_BIT_STREAM_PEEK_BACK_TO_FRONT(
+		                           bit_stream,
+		                           number_of_bits );
 
-		if( remaining_number_of_bits < number_of_bits )
-		{
-			safe_value_32bit <<= remaining_number_of_bits;
-		}
+		LIBMODI_BIT_STREAM_CONSUME_BACK_TO_FRONT(
+		 bit_stream,
+		 number_of_bits );
+	}
+	else if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	{
+		*value_32bit = (uint32_t) LIBMODI_BIT_STREAM_PEEK_FRONT_TO_BACK(
+		                           bit_stream,
+		                           number_of_bits );
+
+		LIBMODI_BIT_STREAM_CONSUME_FRONT_TO_BACK(
+		 bit_stream,
+		 number_of_bits );
+	}
+	return( 1 );
+}
+
+/* Retrieves a value from the bit stream without consuming the bits
+ * The value is padded with 0-bit values if the bit stream contains
+ * less than the number of bits
+ * Returns 1 on success or -1 on error
+ */
+int libmodi_bit_stream_peek_value(
+     libmodi_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_bit_stream_peek_value";
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_bits == 0 )
+	 || ( number_of_bits > (uint8_t) 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( number_of_bits > bit_stream->bit_buffer_size )
+	    && ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size ) )
+	{
 		if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
 		{
-			if( read_number_of_bits < 32 )
-			{
-				/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
-				 */
-				read_value_32bit &= ~( 0xffffffffUL << read_number_of_bits );
-
-				bit_stream->bit_buffer >>= read_number_of_bits;
-			}
-			bit_stream->bit_buffer_size -= read_number_of_bits;
+			bit_stream->bit_buffer |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
 		}
 		else if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
 		{
-			bit_stream->bit_buffer_size -= read_number_of_bits;
-			read_value_32bit           >>= bit_stream->bit_buffer_size;
-
-			if( bit_stream->bit_buffer_size > 0 )
-			{
-				bit_stream->bit_buffer &= 0xffffffffUL >> ( 32 - bit_stream->bit_buffer_size );
-			}
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
+		}
+		bit_stream->bit_buffer_size    += 8;
+		bit_stream->byte_stream_offset += 1;
+	}
+	if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		*value_32bit = (uint32_t) LIBMODI_BIT_STREAM_PEEK_BACK_TO_FRONT(
+		                           bit_stream,
+		                           number_of_bits );
+	}
+	else if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	{
+		if( bit_stream->bit_buffer_size >= number_of_bits )
+		{
+			*value_32bit = (uint32_t) LIBMODI_BIT_STREAM_PEEK_FRONT_TO_BACK(
+			                           bit_stream,
+			                           number_of_bits );
 		}
-		if( bit_stream->bit_buffer_size == 0 )
+		else
 		{
-			bit_stream->bit_buffer = 0;
+			*value_32bit = (uint32_t) ( bit_stream->bit_buffer << ( number_of_bits - bit_stream->bit_buffer_size ) );
 		}
-		safe_value_32bit         |= read_value_32bit;
-		remaining_number_of_bits -= read_number_of_bits;
 	}
-	*value_32bit = safe_value_32bit;
+	return( 1 );
+}
+
+/* Skips bits in the bit stream
+ * The bits must have been made available in the bit buffer by peeking
+ * Returns 1 on success or -1 on error
+ */
+int libmodi_bit_stream_skip_bits(
+     libmodi_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_bit_stream_skip_bits";
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > bit_stream->bit_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
 
+		return( -1 );
+	}
+	if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		LIBMODI_BIT_STREAM_CONSUME_BACK_TO_FRONT(
+		 bit_stream,
+		 number_of_bits );
+	}
+	else if( bit_stream->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	{
+		LIBMODI_BIT_STREAM_CONSUME_FRONT_TO_BACK(
+		 bit_stream,
+		 number_of_bits );
+	}
 	return( 1 );
 }
 
@@ -22,6 +22,7 @@
 #if !defined( _LIBMODI_BIT_STREAM_H )
 #define _LIBMODI_BIT_STREAM_H
 
+#include <byte_stream.h>
 #include <common.h>
 #include <types.h>
 
@@ -61,8 +62,10 @@ struct libmodi_bit_stream
 	uint8_t storage_type;
 
 	/* The bit buffer
+	 * Contains the bits in the least significant bit_buffer_size bits,
+	 * the remaining bits are 0
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits remaining in the bit buffer
 	 */
@@ -77,6 +80,127 @@ int libmodi_bit_stream_initialize(
      uint8_t storage_type,
      libcerror_error_t **error );
 
+/* The bit stream macros below are used by the decoding hot loops, they do not
+ * validate their arguments and are specialized for the storage type
+ */
+
+/* Refills the bit buffer of a byte back-to-front (LSB first) bit stream
+ * If the bit buffer contains less than 56 bits, it is filled with as many
+ * bytes as fit, using a single 64-bit read if at least 8 bytes remain
+ */
+#define LIBMODI_BIT_STREAM_REFILL_BACK_TO_FRONT( bit_stream ) \
+	do \
+	{ \
+		if( ( bit_stream )->bit_buffer_size < 56 ) \
+		{ \
+			uint64_t refill_value_64bit   = 0; \
+			size_t refill_number_of_bytes = ( 63 - ( bit_stream )->bit_buffer_size ) >> 3; \
+			size_t refill_byte_index      = 0; \
+\
+			if( ( ( bit_stream )->byte_stream_size - ( bit_stream )->byte_stream_offset ) >= 8 ) \
+			{ \
+				byte_stream_copy_to_uint64_little_endian( \
+				 &( ( ( bit_stream )->byte_stream )[ ( bit_stream )->byte_stream_offset ] ), \
+				 refill_value_64bit ); \
+\
+				refill_value_64bit &= ( (uint64_t) 1 << ( refill_number_of_bytes * 8 ) ) - 1; \
+			} \
+			else \
+			{ \
+				if( refill_number_of_bytes > ( ( bit_stream )->byte_stream_size - ( bit_stream )->byte_stream_offset ) ) \
+				{ \
+					refill_number_of_bytes = ( bit_stream )->byte_stream_size - ( bit_stream )->byte_stream_offset; \
+				} \
+				for( refill_byte_index = 0; \
+				     refill_byte_index < refill_number_of_bytes; \
+				     refill_byte_index++ ) \
+				{ \
+					refill_value_64bit |= (uint64_t) ( ( bit_stream )->byte_stream )[ ( bit_stream )->byte_stream_offset + refill_byte_index ] << ( refill_byte_index * 8 ); \
+				} \
+			} \
+			( bit_stream )->bit_buffer         |= refill_value_64bit << ( bit_stream )->bit_buffer_size; \
+			( bit_stream )->bit_buffer_size    += (uint8_t) ( refill_number_of_bytes * 8 ); \
+			( bit_stream )->byte_stream_offset += refill_number_of_bytes; \
+		} \
+	} \
+	while( 0 )
+
+/* Refills the bit buffer of a byte front-to-back (MSB first) bit stream
+ * If the bit buffer contains less than 56 bits, it is filled with as many
+ * bytes as fit, using a single 64-bit read if at least 8 bytes remain
+ */
+#define LIBMODI_BIT_STREAM_REFILL_FRONT_TO_BACK( bit_stream ) \
+	do \
+	{ \
+		if( ( bit_stream )->bit_buffer_size < 56 ) \
+		{ \
+			uint64_t refill_value_64bit   = 0; \
+			size_t refill_number_of_bytes = ( 63 - ( bit_stream )->bit_buffer_size ) >> 3; \
+			size_t refill_byte_index      = 0; \
+\
+			if( ( ( bit_stream )->byte_stream_size - ( bit_stream )->byte_stream_offset ) >= 8 ) \
+			{ \
+				byte_stream_copy_to_uint64_big_endian( \
+				 &( ( ( bit_stream )->byte_stream )[ ( bit_stream )->byte_stream_offset ] ), \
+				 refill_value_64bit ); \
+\
+				( bit_stream )->bit_buffer <<= refill_number_of_bytes * 8; \
+				( bit_stream )->bit_buffer  |= refill_value_64bit >> ( 64 - ( refill_number_of_bytes * 8 ) ); \
+			} \
+			else \
+			{ \
+				if( refill_number_of_bytes > ( ( bit_stream )->byte_stream_size - ( bit_stream )->byte_stream_offset ) ) \
+				{ \
+					refill_number_of_bytes = ( bit_stream )->byte_stream_size - ( bit_stream )->byte_stream_offset; \
+				} \
+				for( refill_byte_index = 0; \
+				     refill_byte_index < refill_number_of_bytes; \
+				     refill_byte_index++ ) \
+				{ \
+					( bit_stream )->bit_buffer <<= 8; \
+					( bit_stream )->bit_buffer  |= ( ( bit_stream )->byte_stream )[ ( bit_stream )->byte_stream_offset + refill_byte_index ]; \
+				} \
+			} \
+			( bit_stream )->bit_buffer_size    += (uint8_t) ( refill_number_of_bytes * 8 ); \
+			( bit_stream )->byte_stream_offset += refill_number_of_bytes; \
+		} \
+	} \
+	while( 0 )
+
+/* Retrieves the next number of bits of a byte back-to-front (LSB first) bit stream
+ * without consuming them, where the number of bits must be less than 64
+ */
+#define LIBMODI_BIT_STREAM_PEEK_BACK_TO_FRONT( bit_stream, number_of_bits ) \
+	( ( bit_stream )->bit_buffer & ( ( (uint64_t) 1 << ( number_of_bits ) ) - 1 ) )
+
+/* Retrieves the next number of bits of a byte front-to-back (MSB first) bit stream
+ * without consuming them, where the number of bits must be available in the bit buffer
+ */
+#define LIBMODI_BIT_STREAM_PEEK_FRONT_TO_BACK( bit_stream, number_of_bits ) \
+	( ( bit_stream )->bit_buffer >> ( ( bit_stream )->bit_buffer_size - ( number_of_bits ) ) )
+
+/* Consumes a number of bits of a byte back-to-front (LSB first) bit stream
+ * where the number of bits must be available in the bit buffer
+ */
+#define LIBMODI_BIT_STREAM_CONSUME_BACK_TO_FRONT( bit_stream, number_of_bits ) \
+	do \
+	{ \
+		( bit_stream )->bit_buffer      >>= ( number_of_bits ); \
+		( bit_stream )->bit_buffer_size  -= ( number_of_bits ); \
+	} \
+	while( 0 )
+
+/* Consumes a number of bits of a byte front-to-back (MSB first) bit stream
+ * where the number of bits must be available in the bit buffer
+ */
+#define LIBMODI_BIT_STREAM_CONSUME_FRONT_TO_BACK( bit_stream, number_of_bits ) \
+	do \
+	{ \
+		( bit_stream )->bit_buffer_size -= ( number_of_bits ); \
+		( bit_stream )->bit_buffer      &= ( (uint64_t) 1 << ( bit_stream )->bit_buffer_size ) - 1; \
+	} \
+	while( 0 )
+
 int libmodi_bit_stream_free(
      libmodi_bit_stream_t **bit_stream,
      libcerror_error_t **error );
@@ -87,6 +211,17 @@ int libmodi_bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error );
 
+int libmodi_bit_stream_peek_value(
+     libmodi_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int libmodi_bit_stream_skip_bits(
+     libmodi_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -39,6 +39,10 @@ typedef struct libmodi_block_chunks_data_handle libmodi_block_chunks_data_handle
 
 struct libmodi_block_chunks_data_handle
 {
+	/* The IO handle
+	 */
+	libmodi_io_handle_t *io_handle;
+
 	/* The current offset
 	 */
 	off64_t current_offset;
@@ -54,6 +58,10 @@ struct libmodi_block_chunks_data_handle
 	/* The block chunks cache
 	 */
 	libfcache_cache_t *block_chunks_cache;
+
+	/* The maximum mapped size of a block chunk
+	 */
+	size64_t maximum_mapped_size;
 };
 
 int libmodi_block_chunks_data_handle_initialize(
@@ -74,6 +82,11 @@ int libmodi_block_chunks_data_handle_append_segment(
      size64_t mapped_size,
      libcerror_error_t **error );
 
+int libmodi_block_chunks_data_handle_set_maximum_cache_size(
+     libmodi_block_chunks_data_handle_t *data_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
 ssize_t libmodi_block_chunks_data_handle_read_segment_data(
          libmodi_block_chunks_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
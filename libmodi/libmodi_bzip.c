@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -29,47 +30,634 @@
 #include "libmodi_libcerror.h"
 #include "libmodi_libcnotify.h"
 
-/* Table of the CRC-32 of all 8-bit messages.
- */
-uint32_t libmodi_bzip_crc32_table[ 256 ];
+#if defined( LIBMODI_BZIP_HAVE_X86_PCLMUL )
+#include <immintrin.h>
+#endif
 
-/* Value to indicate the CRC-32 table been computed
+/* Tables of the CRC-32 of all 8-bit messages for slicing-by-8
+ * The tables are calculated in reverse bit-order, where table 0 contains
+ * the CRC-32 of the byte values and table N the CRC-32 of the byte values
+ * followed by N 0-byte values
+ */
+const uint32_t libmodi_bzip_crc32_table[ 8 ][ 256 ] = {
+	{
+		0x00000000UL, 0x04c11db7UL, 0x09823b6eUL, 0x0d4326d9UL, 0x130476dcUL, 0x17c56b6bUL,
+		0x1a864db2UL, 0x1e475005UL, 0x2608edb8UL, 0x22c9f00fUL, 0x2f8ad6d6UL, 0x2b4bcb61UL,
+		0x350c9b64UL, 0x31cd86d3UL, 0x3c8ea00aUL, 0x384fbdbdUL, 0x4c11db70UL, 0x48d0c6c7UL,
+		0x4593e01eUL, 0x4152fda9UL, 0x5f15adacUL, 0x5bd4b01bUL, 0x569796c2UL, 0x52568b75UL,
+		0x6a1936c8UL, 0x6ed82b7fUL, 0x639b0da6UL, 0x675a1011UL, 0x791d4014UL, 0x7ddc5da3UL,
+		0x709f7b7aUL, 0x745e66cdUL, 0x9823b6e0UL, 0x9ce2ab57UL, 0x91a18d8eUL, 0x95609039UL,
+		0x8b27c03cUL, 0x8fe6dd8bUL, 0x82a5fb52UL, 0x8664e6e5UL, 0xbe2b5b58UL, 0xbaea46efUL,
+		0xb7a96036UL, 0xb3687d81UL, 0xad2f2d84UL, 0xa9ee3033UL, 0xa4ad16eaUL, 0xa06c0b5dUL,
+		0xd4326d90UL, 0xd0f37027UL, 0xddb056feUL, 0xd9714b49UL, 0xc7361b4cUL, 0xc3f706fbUL,
+		0xceb42022UL, 0xca753d95UL, 0xf23a8028UL, 0xf6fb9d9fUL, 0xfbb8bb46UL, 0xff79a6f1UL,
+		0xe13ef6f4UL, 0xe5ffeb43UL, 0xe8bccd9aUL, 0xec7dd02dUL, 0x34867077UL, 0x30476dc0UL,
+		0x3d044b19UL, 0x39c556aeUL, 0x278206abUL, 0x23431b1cUL, 0x2e003dc5UL, 0x2ac12072UL,
+		0x128e9dcfUL, 0x164f8078UL, 0x1b0ca6a1UL, 0x1fcdbb16UL, 0x018aeb13UL, 0x054bf6a4UL,
+		0x0808d07dUL, 0x0cc9cdcaUL, 0x7897ab07UL, 0x7c56b6b0UL, 0x71159069UL, 0x75d48ddeUL,
+		0x6b93dddbUL, 0x6f52c06cUL, 0x6211e6b5UL, 0x66d0fb02UL, 0x5e9f46bfUL, 0x5a5e5b08UL,
+		0x571d7dd1UL, 0x53dc6066UL, 0x4d9b3063UL, 0x495a2dd4UL, 0x44190b0dUL, 0x40d816baUL,
+		0xaca5c697UL, 0xa864db20UL, 0xa527fdf9UL, 0xa1e6e04eUL, 0xbfa1b04bUL, 0xbb60adfcUL,
+		0xb6238b25UL, 0xb2e29692UL, 0x8aad2b2fUL, 0x8e6c3698UL, 0x832f1041UL, 0x87ee0df6UL,
+		0x99a95df3UL, 0x9d684044UL, 0x902b669dUL, 0x94ea7b2aUL, 0xe0b41de7UL, 0xe4750050UL,
+		0xe9362689UL, 0xedf73b3eUL, 0xf3b06b3bUL, 0xf771768cUL, 0xfa325055UL, 0xfef34de2UL,
+		0xc6bcf05fUL, 0xc27dede8UL, 0xcf3ecb31UL, 0xcbffd686UL, 0xd5b88683UL, 0xd1799b34UL,
+		0xdc3abdedUL, 0xd8fba05aUL, 0x690ce0eeUL, 0x6dcdfd59UL, 0x608edb80UL, 0x644fc637UL,
+		0x7a089632UL, 0x7ec98b85UL, 0x738aad5cUL, 0x774bb0ebUL, 0x4f040d56UL, 0x4bc510e1UL,
+		0x46863638UL, 0x42472b8fUL, 0x5c007b8aUL, 0x58c1663dUL, 0x558240e4UL, 0x51435d53UL,
+		0x251d3b9eUL, 0x21dc2629UL, 0x2c9f00f0UL, 0x285e1d47UL, 0x36194d42UL, 0x32d850f5UL,
+		0x3f9b762cUL, 0x3b5a6b9bUL, 0x0315d626UL, 0x07d4cb91UL, 0x0a97ed48UL, 0x0e56f0ffUL,
+		0x1011a0faUL, 0x14d0bd4dUL, 0x19939b94UL, 0x1d528623UL, 0xf12f560eUL, 0xf5ee4bb9UL,
+		0xf8ad6d60UL, 0xfc6c70d7UL, 0xe22b20d2UL, 0xe6ea3d65UL, 0xeba91bbcUL, 0xef68060bUL,
+		0xd727bbb6UL, 0xd3e6a601UL, 0xdea580d8UL, 0xda649d6fUL, 0xc423cd6aUL, 0xc0e2d0ddUL,
+		0xcda1f604UL, 0xc960ebb3UL, 0xbd3e8d7eUL, 0xb9ff90c9UL, 0xb4bcb610UL, 0xb07daba7UL,
+		0xae3afba2UL, 0xaafbe615UL, 0xa7b8c0ccUL, 0xa379dd7bUL, 0x9b3660c6UL, 0x9ff77d71UL,
+		0x92b45ba8UL, 0x9675461fUL, 0x8832161aUL, 0x8cf30badUL, 0x81b02d74UL, 0x857130c3UL,
+		0x5d8a9099UL, 0x594b8d2eUL, 0x5408abf7UL, 0x50c9b640UL, 0x4e8ee645UL, 0x4a4ffbf2UL,
+		0x470cdd2bUL, 0x43cdc09cUL, 0x7b827d21UL, 0x7f436096UL, 0x7200464fUL, 0x76c15bf8UL,
+		0x68860bfdUL, 0x6c47164aUL, 0x61043093UL, 0x65c52d24UL, 0x119b4be9UL, 0x155a565eUL,
+		0x18197087UL, 0x1cd86d30UL, 0x029f3d35UL, 0x065e2082UL, 0x0b1d065bUL, 0x0fdc1becUL,
+		0x3793a651UL, 0x3352bbe6UL, 0x3e119d3fUL, 0x3ad08088UL, 0x2497d08dUL, 0x2056cd3aUL,
+		0x2d15ebe3UL, 0x29d4f654UL, 0xc5a92679UL, 0xc1683bceUL, 0xcc2b1d17UL, 0xc8ea00a0UL,
+		0xd6ad50a5UL, 0xd26c4d12UL, 0xdf2f6bcbUL, 0xdbee767cUL, 0xe3a1cbc1UL, 0xe760d676UL,
+		0xea23f0afUL, 0xeee2ed18UL, 0xf0a5bd1dUL, 0xf464a0aaUL, 0xf9278673UL, 0xfde69bc4UL,
+		0x89b8fd09UL, 0x8d79e0beUL, 0x803ac667UL, 0x84fbdbd0UL, 0x9abc8bd5UL, 0x9e7d9662UL,
+		0x933eb0bbUL, 0x97ffad0cUL, 0xafb010b1UL, 0xab710d06UL, 0xa6322bdfUL, 0xa2f33668UL,
+		0xbcb4666dUL, 0xb8757bdaUL, 0xb5365d03UL, 0xb1f740b4UL
+	},
+	{
+		0x00000000UL, 0xd219c1dcUL, 0xa0f29e0fUL, 0x72eb5fd3UL, 0x452421a9UL, 0x973de075UL,
+		0xe5d6bfa6UL, 0x37cf7e7aUL, 0x8a484352UL, 0x5851828eUL, 0x2abadd5dUL, 0xf8a31c81UL,
+		0xcf6c62fbUL, 0x1d75a327UL, 0x6f9efcf4UL, 0xbd873d28UL, 0x10519b13UL, 0xc2485acfUL,
+		0xb0a3051cUL, 0x62bac4c0UL, 0x5575babaUL, 0x876c7b66UL, 0xf58724b5UL, 0x279ee569UL,
+		0x9a19d841UL, 0x4800199dUL, 0x3aeb464eUL, 0xe8f28792UL, 0xdf3df9e8UL, 0x0d243834UL,
+		0x7fcf67e7UL, 0xadd6a63bUL, 0x20a33626UL, 0xf2baf7faUL, 0x8051a829UL, 0x524869f5UL,
+		0x6587178fUL, 0xb79ed653UL, 0xc5758980UL, 0x176c485cUL, 0xaaeb7574UL, 0x78f2b4a8UL,
+		0x0a19eb7bUL, 0xd8002aa7UL, 0xefcf54ddUL, 0x3dd69501UL, 0x4f3dcad2UL, 0x9d240b0eUL,
+		0x30f2ad35UL, 0xe2eb6ce9UL, 0x9000333aUL, 0x4219f2e6UL, 0x75d68c9cUL, 0xa7cf4d40UL,
+		0xd5241293UL, 0x073dd34fUL, 0xbabaee67UL, 0x68a32fbbUL, 0x1a487068UL, 0xc851b1b4UL,
+		0xff9ecfceUL, 0x2d870e12UL, 0x5f6c51c1UL, 0x8d75901dUL, 0x41466c4cUL, 0x935fad90UL,
+		0xe1b4f243UL, 0x33ad339fUL, 0x04624de5UL, 0xd67b8c39UL, 0xa490d3eaUL, 0x76891236UL,
+		0xcb0e2f1eUL, 0x1917eec2UL, 0x6bfcb111UL, 0xb9e570cdUL, 0x8e2a0eb7UL, 0x5c33cf6bUL,
+		0x2ed890b8UL, 0xfcc15164UL, 0x5117f75fUL, 0x830e3683UL, 0xf1e56950UL, 0x23fca88cUL,
+		0x1433d6f6UL, 0xc62a172aUL, 0xb4c148f9UL, 0x66d88925UL, 0xdb5fb40dUL, 0x094675d1UL,
+		0x7bad2a02UL, 0xa9b4ebdeUL, 0x9e7b95a4UL, 0x4c625478UL, 0x3e890babUL, 0xec90ca77UL,
+		0x61e55a6aUL, 0xb3fc9bb6UL, 0xc117c465UL, 0x130e05b9UL, 0x24c17bc3UL, 0xf6d8ba1fUL,
+		0x8433e5ccUL, 0x562a2410UL, 0xebad1938UL, 0x39b4d8e4UL, 0x4b5f8737UL, 0x994646ebUL,
+		0xae893891UL, 0x7c90f94dUL, 0x0e7ba69eUL, 0xdc626742UL, 0x71b4c179UL, 0xa3ad00a5UL,
+		0xd1465f76UL, 0x035f9eaaUL, 0x3490e0d0UL, 0xe689210cUL, 0x94627edfUL, 0x467bbf03UL,
+		0xfbfc822bUL, 0x29e543f7UL, 0x5b0e1c24UL, 0x8917ddf8UL, 0xbed8a382UL, 0x6cc1625eUL,
+		0x1e2a3d8dUL, 0xcc33fc51UL, 0x828cd898UL, 0x50951944UL, 0x227e4697UL, 0xf067874bUL,
+		0xc7a8f931UL, 0x15b138edUL, 0x675a673eUL, 0xb543a6e2UL, 0x08c49bcaUL, 0xdadd5a16UL,
+		0xa83605c5UL, 0x7a2fc419UL, 0x4de0ba63UL, 0x9ff97bbfUL, 0xed12246cUL, 0x3f0be5b0UL,
+		0x92dd438bUL, 0x40c48257UL, 0x322fdd84UL, 0xe0361c58UL, 0xd7f96222UL, 0x05e0a3feUL,
+		0x770bfc2dUL, 0xa5123df1UL, 0x189500d9UL, 0xca8cc105UL, 0xb8679ed6UL, 0x6a7e5f0aUL,
+		0x5db12170UL, 0x8fa8e0acUL, 0xfd43bf7fUL, 0x2f5a7ea3UL, 0xa22feebeUL, 0x70362f62UL,
+		0x02dd70b1UL, 0xd0c4b16dUL, 0xe70bcf17UL, 0x35120ecbUL, 0x47f95118UL, 0x95e090c4UL,
+		0x2867adecUL, 0xfa7e6c30UL, 0x889533e3UL, 0x5a8cf23fUL, 0x6d438c45UL, 0xbf5a4d99UL,
+		0xcdb1124aUL, 0x1fa8d396UL, 0xb27e75adUL, 0x6067b471UL, 0x128ceba2UL, 0xc0952a7eUL,
+		0xf75a5404UL, 0x254395d8UL, 0x57a8ca0bUL, 0x85b10bd7UL, 0x383636ffUL, 0xea2ff723UL,
+		0x98c4a8f0UL, 0x4add692cUL, 0x7d121756UL, 0xaf0bd68aUL, 0xdde08959UL, 0x0ff94885UL,
+		0xc3cab4d4UL, 0x11d37508UL, 0x63382adbUL, 0xb121eb07UL, 0x86ee957dUL, 0x54f754a1UL,
+		0x261c0b72UL, 0xf405caaeUL, 0x4982f786UL, 0x9b9b365aUL, 0xe9706989UL, 0x3b69a855UL,
+		0x0ca6d62fUL, 0xdebf17f3UL, 0xac544820UL, 0x7e4d89fcUL, 0xd39b2fc7UL, 0x0182ee1bUL,
+		0x7369b1c8UL, 0xa1707014UL, 0x96bf0e6eUL, 0x44a6cfb2UL, 0x364d9061UL, 0xe45451bdUL,
+		0x59d36c95UL, 0x8bcaad49UL, 0xf921f29aUL, 0x2b383346UL, 0x1cf74d3cUL, 0xceee8ce0UL,
+		0xbc05d333UL, 0x6e1c12efUL, 0xe36982f2UL, 0x3170432eUL, 0x439b1cfdUL, 0x9182dd21UL,
+		0xa64da35bUL, 0x74546287UL, 0x06bf3d54UL, 0xd4a6fc88UL, 0x6921c1a0UL, 0xbb38007cUL,
+		0xc9d35fafUL, 0x1bca9e73UL, 0x2c05e009UL, 0xfe1c21d5UL, 0x8cf77e06UL, 0x5eeebfdaUL,
+		0xf33819e1UL, 0x2121d83dUL, 0x53ca87eeUL, 0x81d34632UL, 0xb61c3848UL, 0x6405f994UL,
+		0x16eea647UL, 0xc4f7679bUL, 0x79705ab3UL, 0xab699b6fUL, 0xd982c4bcUL, 0x0b9b0560UL,
+		0x3c547b1aUL, 0xee4dbac6UL, 0x9ca6e515UL, 0x4ebf24c9UL
+	},
+	{
+		0x00000000UL, 0x01d8ac87UL, 0x03b1590eUL, 0x0269f589UL, 0x0762b21cUL, 0x06ba1e9bUL,
+		0x04d3eb12UL, 0x050b4795UL, 0x0ec56438UL, 0x0f1dc8bfUL, 0x0d743d36UL, 0x0cac91b1UL,
+		0x09a7d624UL, 0x087f7aa3UL, 0x0a168f2aUL, 0x0bce23adUL, 0x1d8ac870UL, 0x1c5264f7UL,
+		0x1e3b917eUL, 0x1fe33df9UL, 0x1ae87a6cUL, 0x1b30d6ebUL, 0x19592362UL, 0x18818fe5UL,
+		0x134fac48UL, 0x129700cfUL, 0x10fef546UL, 0x112659c1UL, 0x142d1e54UL, 0x15f5b2d3UL,
+		0x179c475aUL, 0x1644ebddUL, 0x3b1590e0UL, 0x3acd3c67UL, 0x38a4c9eeUL, 0x397c6569UL,
+		0x3c7722fcUL, 0x3daf8e7bUL, 0x3fc67bf2UL, 0x3e1ed775UL, 0x35d0f4d8UL, 0x3408585fUL,
+		0x3661add6UL, 0x37b90151UL, 0x32b246c4UL, 0x336aea43UL, 0x31031fcaUL, 0x30dbb34dUL,
+		0x269f5890UL, 0x2747f417UL, 0x252e019eUL, 0x24f6ad19UL, 0x21fdea8cUL, 0x2025460bUL,
+		0x224cb382UL, 0x23941f05UL, 0x285a3ca8UL, 0x2982902fUL, 0x2beb65a6UL, 0x2a33c921UL,
+		0x2f388eb4UL, 0x2ee02233UL, 0x2c89d7baUL, 0x2d517b3dUL, 0x762b21c0UL, 0x77f38d47UL,
+		0x759a78ceUL, 0x7442d449UL, 0x714993dcUL, 0x70913f5bUL, 0x72f8cad2UL, 0x73206655UL,
+		0x78ee45f8UL, 0x7936e97fUL, 0x7b5f1cf6UL, 0x7a87b071UL, 0x7f8cf7e4UL, 0x7e545b63UL,
+		0x7c3daeeaUL, 0x7de5026dUL, 0x6ba1e9b0UL, 0x6a794537UL, 0x6810b0beUL, 0x69c81c39UL,
+		0x6cc35bacUL, 0x6d1bf72bUL, 0x6f7202a2UL, 0x6eaaae25UL, 0x65648d88UL, 0x64bc210fUL,
+		0x66d5d486UL, 0x670d7801UL, 0x62063f94UL, 0x63de9313UL, 0x61b7669aUL, 0x606fca1dUL,
+		0x4d3eb120UL, 0x4ce61da7UL, 0x4e8fe82eUL, 0x4f5744a9UL, 0x4a5c033cUL, 0x4b84afbbUL,
+		0x49ed5a32UL, 0x4835f6b5UL, 0x43fbd518UL, 0x4223799fUL, 0x404a8c16UL, 0x41922091UL,
+		0x44996704UL, 0x4541cb83UL, 0x47283e0aUL, 0x46f0928dUL, 0x50b47950UL, 0x516cd5d7UL,
+		0x5305205eUL, 0x52dd8cd9UL, 0x57d6cb4cUL, 0x560e67cbUL, 0x54679242UL, 0x55bf3ec5UL,
+		0x5e711d68UL, 0x5fa9b1efUL, 0x5dc04466UL, 0x5c18e8e1UL, 0x5913af74UL, 0x58cb03f3UL,
+		0x5aa2f67aUL, 0x5b7a5afdUL, 0xec564380UL, 0xed8eef07UL, 0xefe71a8eUL, 0xee3fb609UL,
+		0xeb34f19cUL, 0xeaec5d1bUL, 0xe885a892UL, 0xe95d0415UL, 0xe29327b8UL, 0xe34b8b3fUL,
+		0xe1227eb6UL, 0xe0fad231UL, 0xe5f195a4UL, 0xe4293923UL, 0xe640ccaaUL, 0xe798602dUL,
+		0xf1dc8bf0UL, 0xf0042777UL, 0xf26dd2feUL, 0xf3b57e79UL, 0xf6be39ecUL, 0xf766956bUL,
+		0xf50f60e2UL, 0xf4d7cc65UL, 0xff19efc8UL, 0xfec1434fUL, 0xfca8b6c6UL, 0xfd701a41UL,
+		0xf87b5dd4UL, 0xf9a3f153UL, 0xfbca04daUL, 0xfa12a85dUL, 0xd743d360UL, 0xd69b7fe7UL,
+		0xd4f28a6eUL, 0xd52a26e9UL, 0xd021617cUL, 0xd1f9cdfbUL, 0xd3903872UL, 0xd24894f5UL,
+		0xd986b758UL, 0xd85e1bdfUL, 0xda37ee56UL, 0xdbef42d1UL, 0xdee40544UL, 0xdf3ca9c3UL,
+		0xdd555c4aUL, 0xdc8df0cdUL, 0xcac91b10UL, 0xcb11b797UL, 0xc978421eUL, 0xc8a0ee99UL,
+		0xcdaba90cUL, 0xcc73058bUL, 0xce1af002UL, 0xcfc25c85UL, 0xc40c7f28UL, 0xc5d4d3afUL,
+		0xc7bd2626UL, 0xc6658aa1UL, 0xc36ecd34UL, 0xc2b661b3UL, 0xc0df943aUL, 0xc10738bdUL,
+		0x9a7d6240UL, 0x9ba5cec7UL, 0x99cc3b4eUL, 0x981497c9UL, 0x9d1fd05cUL, 0x9cc77cdbUL,
+		0x9eae8952UL, 0x9f7625d5UL, 0x94b80678UL, 0x9560aaffUL, 0x97095f76UL, 0x96d1f3f1UL,
+		0x93dab464UL, 0x920218e3UL, 0x906bed6aUL, 0x91b341edUL, 0x87f7aa30UL, 0x862f06b7UL,
+		0x8446f33eUL, 0x859e5fb9UL, 0x8095182cUL, 0x814db4abUL, 0x83244122UL, 0x82fceda5UL,
+		0x8932ce08UL, 0x88ea628fUL, 0x8a839706UL, 0x8b5b3b81UL, 0x8e507c14UL, 0x8f88d093UL,
+		0x8de1251aUL, 0x8c39899dUL, 0xa168f2a0UL, 0xa0b05e27UL, 0xa2d9abaeUL, 0xa3010729UL,
+		0xa60a40bcUL, 0xa7d2ec3bUL, 0xa5bb19b2UL, 0xa463b535UL, 0xafad9698UL, 0xae753a1fUL,
+		0xac1ccf96UL, 0xadc46311UL, 0xa8cf2484UL, 0xa9178803UL, 0xab7e7d8aUL, 0xaaa6d10dUL,
+		0xbce23ad0UL, 0xbd3a9657UL, 0xbf5363deUL, 0xbe8bcf59UL, 0xbb8088ccUL, 0xba58244bUL,
+		0xb831d1c2UL, 0xb9e97d45UL, 0xb2275ee8UL, 0xb3fff26fUL, 0xb19607e6UL, 0xb04eab61UL,
+		0xb545ecf4UL, 0xb49d4073UL, 0xb6f4b5faUL, 0xb72c197dUL
+	},
+	{
+		0x00000000UL, 0xdc6d9ab7UL, 0xbc1a28d9UL, 0x6077b26eUL, 0x7cf54c05UL, 0xa098d6b2UL,
+		0xc0ef64dcUL, 0x1c82fe6bUL, 0xf9ea980aUL, 0x258702bdUL, 0x45f0b0d3UL, 0x999d2a64UL,
+		0x851fd40fUL, 0x59724eb8UL, 0x3905fcd6UL, 0xe5686661UL, 0xf7142da3UL, 0x2b79b714UL,
+		0x4b0e057aUL, 0x97639fcdUL, 0x8be161a6UL, 0x578cfb11UL, 0x37fb497fUL, 0xeb96d3c8UL,
+		0x0efeb5a9UL, 0xd2932f1eUL, 0xb2e49d70UL, 0x6e8907c7UL, 0x720bf9acUL, 0xae66631bUL,
+		0xce11d175UL, 0x127c4bc2UL, 0xeae946f1UL, 0x3684dc46UL, 0x56f36e28UL, 0x8a9ef49fUL,
+		0x961c0af4UL, 0x4a719043UL, 0x2a06222dUL, 0xf66bb89aUL, 0x1303defbUL, 0xcf6e444cUL,
+		0xaf19f622UL, 0x73746c95UL, 0x6ff692feUL, 0xb39b0849UL, 0xd3ecba27UL, 0x0f812090UL,
+		0x1dfd6b52UL, 0xc190f1e5UL, 0xa1e7438bUL, 0x7d8ad93cUL, 0x61082757UL, 0xbd65bde0UL,
+		0xdd120f8eUL, 0x017f9539UL, 0xe417f358UL, 0x387a69efUL, 0x580ddb81UL, 0x84604136UL,
+		0x98e2bf5dUL, 0x448f25eaUL, 0x24f89784UL, 0xf8950d33UL, 0xd1139055UL, 0x0d7e0ae2UL,
+		0x6d09b88cUL, 0xb164223bUL, 0xade6dc50UL, 0x718b46e7UL, 0x11fcf489UL, 0xcd916e3eUL,
+		0x28f9085fUL, 0xf49492e8UL, 0x94e32086UL, 0x488eba31UL, 0x540c445aUL, 0x8861deedUL,
+		0xe8166c83UL, 0x347bf634UL, 0x2607bdf6UL, 0xfa6a2741UL, 0x9a1d952fUL, 0x46700f98UL,
+		0x5af2f1f3UL, 0x869f6b44UL, 0xe6e8d92aUL, 0x3a85439dUL, 0xdfed25fcUL, 0x0380bf4bUL,
+		0x63f70d25UL, 0xbf9a9792UL, 0xa31869f9UL, 0x7f75f34eUL, 0x1f024120UL, 0xc36fdb97UL,
+		0x3bfad6a4UL, 0xe7974c13UL, 0x87e0fe7dUL, 0x5b8d64caUL, 0x470f9aa1UL, 0x9b620016UL,
+		0xfb15b278UL, 0x277828cfUL, 0xc2104eaeUL, 0x1e7dd419UL, 0x7e0a6677UL, 0xa267fcc0UL,
+		0xbee502abUL, 0x6288981cUL, 0x02ff2a72UL, 0xde92b0c5UL, 0xcceefb07UL, 0x108361b0UL,
+		0x70f4d3deUL, 0xac994969UL, 0xb01bb702UL, 0x6c762db5UL, 0x0c019fdbUL, 0xd06c056cUL,
+		0x3504630dUL, 0xe969f9baUL, 0x891e4bd4UL, 0x5573d163UL, 0x49f12f08UL, 0x959cb5bfUL,
+		0xf5eb07d1UL, 0x29869d66UL, 0xa6e63d1dUL, 0x7a8ba7aaUL, 0x1afc15c4UL, 0xc6918f73UL,
+		0xda137118UL, 0x067eebafUL, 0x660959c1UL, 0xba64c376UL, 0x5f0ca517UL, 0x83613fa0UL,
+		0xe3168dceUL, 0x3f7b1779UL, 0x23f9e912UL, 0xff9473a5UL, 0x9fe3c1cbUL, 0x438e5b7cUL,
+		0x51f210beUL, 0x8d9f8a09UL, 0xede83867UL, 0x3185a2d0UL, 0x2d075cbbUL, 0xf16ac60cUL,
+		0x911d7462UL, 0x4d70eed5UL, 0xa81888b4UL, 0x74751203UL, 0x1402a06dUL, 0xc86f3adaUL,
+		0xd4edc4b1UL, 0x08805e06UL, 0x68f7ec68UL, 0xb49a76dfUL, 0x4c0f7becUL, 0x9062e15bUL,
+		0xf0155335UL, 0x2c78c982UL, 0x30fa37e9UL, 0xec97ad5eUL, 0x8ce01f30UL, 0x508d8587UL,
+		0xb5e5e3e6UL, 0x69887951UL, 0x09ffcb3fUL, 0xd5925188UL, 0xc910afe3UL, 0x157d3554UL,
+		0x750a873aUL, 0xa9671d8dUL, 0xbb1b564fUL, 0x6776ccf8UL, 0x07017e96UL, 0xdb6ce421UL,
+		0xc7ee1a4aUL, 0x1b8380fdUL, 0x7bf43293UL, 0xa799a824UL, 0x42f1ce45UL, 0x9e9c54f2UL,
+		0xfeebe69cUL, 0x22867c2bUL, 0x3e048240UL, 0xe26918f7UL, 0x821eaa99UL, 0x5e73302eUL,
+		0x77f5ad48UL, 0xab9837ffUL, 0xcbef8591UL, 0x17821f26UL, 0x0b00e14dUL, 0xd76d7bfaUL,
+		0xb71ac994UL, 0x6b775323UL, 0x8e1f3542UL, 0x5272aff5UL, 0x32051d9bUL, 0xee68872cUL,
+		0xf2ea7947UL, 0x2e87e3f0UL, 0x4ef0519eUL, 0x929dcb29UL, 0x80e180ebUL, 0x5c8c1a5cUL,
+		0x3cfba832UL, 0xe0963285UL, 0xfc14cceeUL, 0x20795659UL, 0x400ee437UL, 0x9c637e80UL,
+		0x790b18e1UL, 0xa5668256UL, 0xc5113038UL, 0x197caa8fUL, 0x05fe54e4UL, 0xd993ce53UL,
+		0xb9e47c3dUL, 0x6589e68aUL, 0x9d1cebb9UL, 0x4171710eUL, 0x2106c360UL, 0xfd6b59d7UL,
+		0xe1e9a7bcUL, 0x3d843d0bUL, 0x5df38f65UL, 0x819e15d2UL, 0x64f673b3UL, 0xb89be904UL,
+		0xd8ec5b6aUL, 0x0481c1ddUL, 0x18033fb6UL, 0xc46ea501UL, 0xa419176fUL, 0x78748dd8UL,
+		0x6a08c61aUL, 0xb6655cadUL, 0xd612eec3UL, 0x0a7f7474UL, 0x16fd8a1fUL, 0xca9010a8UL,
+		0xaae7a2c6UL, 0x768a3871UL, 0x93e25e10UL, 0x4f8fc4a7UL, 0x2ff876c9UL, 0xf395ec7eUL,
+		0xef171215UL, 0x337a88a2UL, 0x530d3accUL, 0x8f60a07bUL
+	},
+	{
+		0x00000000UL, 0x490d678dUL, 0x921acf1aUL, 0xdb17a897UL, 0x20f48383UL, 0x69f9e40eUL,
+		0xb2ee4c99UL, 0xfbe32b14UL, 0x41e90706UL, 0x08e4608bUL, 0xd3f3c81cUL, 0x9afeaf91UL,
+		0x611d8485UL, 0x2810e308UL, 0xf3074b9fUL, 0xba0a2c12UL, 0x83d20e0cUL, 0xcadf6981UL,
+		0x11c8c116UL, 0x58c5a69bUL, 0xa3268d8fUL, 0xea2bea02UL, 0x313c4295UL, 0x78312518UL,
+		0xc23b090aUL, 0x8b366e87UL, 0x5021c610UL, 0x192ca19dUL, 0xe2cf8a89UL, 0xabc2ed04UL,
+		0x70d54593UL, 0x39d8221eUL, 0x036501afUL, 0x4a686622UL, 0x917fceb5UL, 0xd872a938UL,
+		0x2391822cUL, 0x6a9ce5a1UL, 0xb18b4d36UL, 0xf8862abbUL, 0x428c06a9UL, 0x0b816124UL,
+		0xd096c9b3UL, 0x999bae3eUL, 0x6278852aUL, 0x2b75e2a7UL, 0xf0624a30UL, 0xb96f2dbdUL,
+		0x80b70fa3UL, 0xc9ba682eUL, 0x12adc0b9UL, 0x5ba0a734UL, 0xa0438c20UL, 0xe94eebadUL,
+		0x3259433aUL, 0x7b5424b7UL, 0xc15e08a5UL, 0x88536f28UL, 0x5344c7bfUL, 0x1a49a032UL,
+		0xe1aa8b26UL, 0xa8a7ecabUL, 0x73b0443cUL, 0x3abd23b1UL, 0x06ca035eUL, 0x4fc764d3UL,
+		0x94d0cc44UL, 0xddddabc9UL, 0x263e80ddUL, 0x6f33e750UL, 0xb4244fc7UL, 0xfd29284aUL,
+		0x47230458UL, 0x0e2e63d5UL, 0xd539cb42UL, 0x9c34accfUL, 0x67d787dbUL, 0x2edae056UL,
+		0xf5cd48c1UL, 0xbcc02f4cUL, 0x85180d52UL, 0xcc156adfUL, 0x1702c248UL, 0x5e0fa5c5UL,
+		0xa5ec8ed1UL, 0xece1e95cUL, 0x37f641cbUL, 0x7efb2646UL, 0xc4f10a54UL, 0x8dfc6dd9UL,
+		0x56ebc54eUL, 0x1fe6a2c3UL, 0xe40589d7UL, 0xad08ee5aUL, 0x761f46cdUL, 0x3f122140UL,
+		0x05af02f1UL, 0x4ca2657cUL, 0x97b5cdebUL, 0xdeb8aa66UL, 0x255b8172UL, 0x6c56e6ffUL,
+		0xb7414e68UL, 0xfe4c29e5UL, 0x444605f7UL, 0x0d4b627aUL, 0xd65ccaedUL, 0x9f51ad60UL,
+		0x64b28674UL, 0x2dbfe1f9UL, 0xf6a8496eUL, 0xbfa52ee3UL, 0x867d0cfdUL, 0xcf706b70UL,
+		0x1467c3e7UL, 0x5d6aa46aUL, 0xa6898f7eUL, 0xef84e8f3UL, 0x34934064UL, 0x7d9e27e9UL,
+		0xc7940bfbUL, 0x8e996c76UL, 0x558ec4e1UL, 0x1c83a36cUL, 0xe7608878UL, 0xae6deff5UL,
+		0x757a4762UL, 0x3c7720efUL, 0x0d9406bcUL, 0x44996131UL, 0x9f8ec9a6UL, 0xd683ae2bUL,
+		0x2d60853fUL, 0x646de2b2UL, 0xbf7a4a25UL, 0xf6772da8UL, 0x4c7d01baUL, 0x05706637UL,
+		0xde67cea0UL, 0x976aa92dUL, 0x6c898239UL, 0x2584e5b4UL, 0xfe934d23UL, 0xb79e2aaeUL,
+		0x8e4608b0UL, 0xc74b6f3dUL, 0x1c5cc7aaUL, 0x5551a027UL, 0xaeb28b33UL, 0xe7bfecbeUL,
+		0x3ca84429UL, 0x75a523a4UL, 0xcfaf0fb6UL, 0x86a2683bUL, 0x5db5c0acUL, 0x14b8a721UL,
+		0xef5b8c35UL, 0xa656ebb8UL, 0x7d41432fUL, 0x344c24a2UL, 0x0ef10713UL, 0x47fc609eUL,
+		0x9cebc809UL, 0xd5e6af84UL, 0x2e058490UL, 0x6708e31dUL, 0xbc1f4b8aUL, 0xf5122c07UL,
+		0x4f180015UL, 0x06156798UL, 0xdd02cf0fUL, 0x940fa882UL, 0x6fec8396UL, 0x26e1e41bUL,
+		0xfdf64c8cUL, 0xb4fb2b01UL, 0x8d23091fUL, 0xc42e6e92UL, 0x1f39c605UL, 0x5634a188UL,
+		0xadd78a9cUL, 0xe4daed11UL, 0x3fcd4586UL, 0x76c0220bUL, 0xccca0e19UL, 0x85c76994UL,
+		0x5ed0c103UL, 0x17dda68eUL, 0xec3e8d9aUL, 0xa533ea17UL, 0x7e244280UL, 0x3729250dUL,
+		0x0b5e05e2UL, 0x4253626fUL, 0x9944caf8UL, 0xd049ad75UL, 0x2baa8661UL, 0x62a7e1ecUL,
+		0xb9b0497bUL, 0xf0bd2ef6UL, 0x4ab702e4UL, 0x03ba6569UL, 0xd8adcdfeUL, 0x91a0aa73UL,
+		0x6a438167UL, 0x234ee6eaUL, 0xf8594e7dUL, 0xb15429f0UL, 0x888c0beeUL, 0xc1816c63UL,
+		0x1a96c4f4UL, 0x539ba379UL, 0xa878886dUL, 0xe175efe0UL, 0x3a624777UL, 0x736f20faUL,
+		0xc9650ce8UL, 0x80686b65UL, 0x5b7fc3f2UL, 0x1272a47fUL, 0xe9918f6bUL, 0xa09ce8e6UL,
+		0x7b8b4071UL, 0x328627fcUL, 0x083b044dUL, 0x413663c0UL, 0x9a21cb57UL, 0xd32cacdaUL,
+		0x28cf87ceUL, 0x61c2e043UL, 0xbad548d4UL, 0xf3d82f59UL, 0x49d2034bUL, 0x00df64c6UL,
+		0xdbc8cc51UL, 0x92c5abdcUL, 0x692680c8UL, 0x202be745UL, 0xfb3c4fd2UL, 0xb231285fUL,
+		0x8be90a41UL, 0xc2e46dccUL, 0x19f3c55bUL, 0x50fea2d6UL, 0xab1d89c2UL, 0xe210ee4fUL,
+		0x390746d8UL, 0x700a2155UL, 0xca000d47UL, 0x830d6acaUL, 0x581ac25dUL, 0x1117a5d0UL,
+		0xeaf48ec4UL, 0xa3f9e949UL, 0x78ee41deUL, 0x31e32653UL
+	},
+	{
+		0x00000000UL, 0x1b280d78UL, 0x36501af0UL, 0x2d781788UL, 0x6ca035e0UL, 0x77883898UL,
+		0x5af02f10UL, 0x41d82268UL, 0xd9406bc0UL, 0xc26866b8UL, 0xef107130UL, 0xf4387c48UL,
+		0xb5e05e20UL, 0xaec85358UL, 0x83b044d0UL, 0x989849a8UL, 0xb641ca37UL, 0xad69c74fUL,
+		0x8011d0c7UL, 0x9b39ddbfUL, 0xdae1ffd7UL, 0xc1c9f2afUL, 0xecb1e527UL, 0xf799e85fUL,
+		0x6f01a1f7UL, 0x7429ac8fUL, 0x5951bb07UL, 0x4279b67fUL, 0x03a19417UL, 0x1889996fUL,
+		0x35f18ee7UL, 0x2ed9839fUL, 0x684289d9UL, 0x736a84a1UL, 0x5e129329UL, 0x453a9e51UL,
+		0x04e2bc39UL, 0x1fcab141UL, 0x32b2a6c9UL, 0x299aabb1UL, 0xb102e219UL, 0xaa2aef61UL,
+		0x8752f8e9UL, 0x9c7af591UL, 0xdda2d7f9UL, 0xc68ada81UL, 0xebf2cd09UL, 0xf0dac071UL,
+		0xde0343eeUL, 0xc52b4e96UL, 0xe853591eUL, 0xf37b5466UL, 0xb2a3760eUL, 0xa98b7b76UL,
+		0x84f36cfeUL, 0x9fdb6186UL, 0x0743282eUL, 0x1c6b2556UL, 0x311332deUL, 0x2a3b3fa6UL,
+		0x6be31dceUL, 0x70cb10b6UL, 0x5db3073eUL, 0x469b0a46UL, 0xd08513b2UL, 0xcbad1ecaUL,
+		0xe6d50942UL, 0xfdfd043aUL, 0xbc252652UL, 0xa70d2b2aUL, 0x8a753ca2UL, 0x915d31daUL,
+		0x09c57872UL, 0x12ed750aUL, 0x3f956282UL, 0x24bd6ffaUL, 0x65654d92UL, 0x7e4d40eaUL,
+		0x53355762UL, 0x481d5a1aUL, 0x66c4d985UL, 0x7decd4fdUL, 0x5094c375UL, 0x4bbcce0dUL,
+		0x0a64ec65UL, 0x114ce11dUL, 0x3c34f695UL, 0x271cfbedUL, 0xbf84b245UL, 0xa4acbf3dUL,
+		0x89d4a8b5UL, 0x92fca5cdUL, 0xd32487a5UL, 0xc80c8addUL, 0xe5749d55UL, 0xfe5c902dUL,
+		0xb8c79a6bUL, 0xa3ef9713UL, 0x8e97809bUL, 0x95bf8de3UL, 0xd467af8bUL, 0xcf4fa2f3UL,
+		0xe237b57bUL, 0xf91fb803UL, 0x6187f1abUL, 0x7aaffcd3UL, 0x57d7eb5bUL, 0x4cffe623UL,
+		0x0d27c44bUL, 0x160fc933UL, 0x3b77debbUL, 0x205fd3c3UL, 0x0e86505cUL, 0x15ae5d24UL,
+		0x38d64aacUL, 0x23fe47d4UL, 0x622665bcUL, 0x790e68c4UL, 0x54767f4cUL, 0x4f5e7234UL,
+		0xd7c63b9cUL, 0xccee36e4UL, 0xe196216cUL, 0xfabe2c14UL, 0xbb660e7cUL, 0xa04e0304UL,
+		0x8d36148cUL, 0x961e19f4UL, 0xa5cb3ad3UL, 0xbee337abUL, 0x939b2023UL, 0x88b32d5bUL,
+		0xc96b0f33UL, 0xd243024bUL, 0xff3b15c3UL, 0xe41318bbUL, 0x7c8b5113UL, 0x67a35c6bUL,
+		0x4adb4be3UL, 0x51f3469bUL, 0x102b64f3UL, 0x0b03698bUL, 0x267b7e03UL, 0x3d53737bUL,
+		0x138af0e4UL, 0x08a2fd9cUL, 0x25daea14UL, 0x3ef2e76cUL, 0x7f2ac504UL, 0x6402c87cUL,
+		0x497adff4UL, 0x5252d28cUL, 0xcaca9b24UL, 0xd1e2965cUL, 0xfc9a81d4UL, 0xe7b28cacUL,
+		0xa66aaec4UL, 0xbd42a3bcUL, 0x903ab434UL, 0x8b12b94cUL, 0xcd89b30aUL, 0xd6a1be72UL,
+		0xfbd9a9faUL, 0xe0f1a482UL, 0xa12986eaUL, 0xba018b92UL, 0x97799c1aUL, 0x8c519162UL,
+		0x14c9d8caUL, 0x0fe1d5b2UL, 0x2299c23aUL, 0x39b1cf42UL, 0x7869ed2aUL, 0x6341e052UL,
+		0x4e39f7daUL, 0x5511faa2UL, 0x7bc8793dUL, 0x60e07445UL, 0x4d9863cdUL, 0x56b06eb5UL,
+		0x17684cddUL, 0x0c4041a5UL, 0x2138562dUL, 0x3a105b55UL, 0xa28812fdUL, 0xb9a01f85UL,
+		0x94d8080dUL, 0x8ff00575UL, 0xce28271dUL, 0xd5002a65UL, 0xf8783dedUL, 0xe3503095UL,
+		0x754e2961UL, 0x6e662419UL, 0x431e3391UL, 0x58363ee9UL, 0x19ee1c81UL, 0x02c611f9UL,
+		0x2fbe0671UL, 0x34960b09UL, 0xac0e42a1UL, 0xb7264fd9UL, 0x9a5e5851UL, 0x81765529UL,
+		0xc0ae7741UL, 0xdb867a39UL, 0xf6fe6db1UL, 0xedd660c9UL, 0xc30fe356UL, 0xd827ee2eUL,
+		0xf55ff9a6UL, 0xee77f4deUL, 0xafafd6b6UL, 0xb487dbceUL, 0x99ffcc46UL, 0x82d7c13eUL,
+		0x1a4f8896UL, 0x016785eeUL, 0x2c1f9266UL, 0x37379f1eUL, 0x76efbd76UL, 0x6dc7b00eUL,
+		0x40bfa786UL, 0x5b97aafeUL, 0x1d0ca0b8UL, 0x0624adc0UL, 0x2b5cba48UL, 0x3074b730UL,
+		0x71ac9558UL, 0x6a849820UL, 0x47fc8fa8UL, 0x5cd482d0UL, 0xc44ccb78UL, 0xdf64c600UL,
+		0xf21cd188UL, 0xe934dcf0UL, 0xa8ecfe98UL, 0xb3c4f3e0UL, 0x9ebce468UL, 0x8594e910UL,
+		0xab4d6a8fUL, 0xb06567f7UL, 0x9d1d707fUL, 0x86357d07UL, 0xc7ed5f6fUL, 0xdcc55217UL,
+		0xf1bd459fUL, 0xea9548e7UL, 0x720d014fUL, 0x69250c37UL, 0x445d1bbfUL, 0x5f7516c7UL,
+		0x1ead34afUL, 0x058539d7UL, 0x28fd2e5fUL, 0x33d52327UL
+	},
+	{
+		0x00000000UL, 0x4f576811UL, 0x9eaed022UL, 0xd1f9b833UL, 0x399cbdf3UL, 0x76cbd5e2UL,
+		0xa7326dd1UL, 0xe86505c0UL, 0x73397be6UL, 0x3c6e13f7UL, 0xed97abc4UL, 0xa2c0c3d5UL,
+		0x4aa5c615UL, 0x05f2ae04UL, 0xd40b1637UL, 0x9b5c7e26UL, 0xe672f7ccUL, 0xa9259fddUL,
+		0x78dc27eeUL, 0x378b4fffUL, 0xdfee4a3fUL, 0x90b9222eUL, 0x41409a1dUL, 0x0e17f20cUL,
+		0x954b8c2aUL, 0xda1ce43bUL, 0x0be55c08UL, 0x44b23419UL, 0xacd731d9UL, 0xe38059c8UL,
+		0x3279e1fbUL, 0x7d2e89eaUL, 0xc824f22fUL, 0x87739a3eUL, 0x568a220dUL, 0x19dd4a1cUL,
+		0xf1b84fdcUL, 0xbeef27cdUL, 0x6f169ffeUL, 0x2041f7efUL, 0xbb1d89c9UL, 0xf44ae1d8UL,
+		0x25b359ebUL, 0x6ae431faUL, 0x8281343aUL, 0xcdd65c2bUL, 0x1c2fe418UL, 0x53788c09UL,
+		0x2e5605e3UL, 0x61016df2UL, 0xb0f8d5c1UL, 0xffafbdd0UL, 0x17cab810UL, 0x589dd001UL,
+		0x89646832UL, 0xc6330023UL, 0x5d6f7e05UL, 0x12381614UL, 0xc3c1ae27UL, 0x8c96c636UL,
+		0x64f3c3f6UL, 0x2ba4abe7UL, 0xfa5d13d4UL, 0xb50a7bc5UL, 0x9488f9e9UL, 0xdbdf91f8UL,
+		0x0a2629cbUL, 0x457141daUL, 0xad14441aUL, 0xe2432c0bUL, 0x33ba9438UL, 0x7cedfc29UL,
+		0xe7b1820fUL, 0xa8e6ea1eUL, 0x791f522dUL, 0x36483a3cUL, 0xde2d3ffcUL, 0x917a57edUL,
+		0x4083efdeUL, 0x0fd487cfUL, 0x72fa0e25UL, 0x3dad6634UL, 0xec54de07UL, 0xa303b616UL,
+		0x4b66b3d6UL, 0x0431dbc7UL, 0xd5c863f4UL, 0x9a9f0be5UL, 0x01c375c3UL, 0x4e941dd2UL,
+		0x9f6da5e1UL, 0xd03acdf0UL, 0x385fc830UL, 0x7708a021UL, 0xa6f11812UL, 0xe9a67003UL,
+		0x5cac0bc6UL, 0x13fb63d7UL, 0xc202dbe4UL, 0x8d55b3f5UL, 0x6530b635UL, 0x2a67de24UL,
+		0xfb9e6617UL, 0xb4c90e06UL, 0x2f957020UL, 0x60c21831UL, 0xb13ba002UL, 0xfe6cc813UL,
+		0x1609cdd3UL, 0x595ea5c2UL, 0x88a71df1UL, 0xc7f075e0UL, 0xbadefc0aUL, 0xf589941bUL,
+		0x24702c28UL, 0x6b274439UL, 0x834241f9UL, 0xcc1529e8UL, 0x1dec91dbUL, 0x52bbf9caUL,
+		0xc9e787ecUL, 0x86b0effdUL, 0x574957ceUL, 0x181e3fdfUL, 0xf07b3a1fUL, 0xbf2c520eUL,
+		0x6ed5ea3dUL, 0x2182822cUL, 0x2dd0ee65UL, 0x62878674UL, 0xb37e3e47UL, 0xfc295656UL,
+		0x144c5396UL, 0x5b1b3b87UL, 0x8ae283b4UL, 0xc5b5eba5UL, 0x5ee99583UL, 0x11befd92UL,
+		0xc04745a1UL, 0x8f102db0UL, 0x67752870UL, 0x28224061UL, 0xf9dbf852UL, 0xb68c9043UL,
+		0xcba219a9UL, 0x84f571b8UL, 0x550cc98bUL, 0x1a5ba19aUL, 0xf23ea45aUL, 0xbd69cc4bUL,
+		0x6c907478UL, 0x23c71c69UL, 0xb89b624fUL, 0xf7cc0a5eUL, 0x2635b26dUL, 0x6962da7cUL,
+		0x8107dfbcUL, 0xce50b7adUL, 0x1fa90f9eUL, 0x50fe678fUL, 0xe5f41c4aUL, 0xaaa3745bUL,
+		0x7b5acc68UL, 0x340da479UL, 0xdc68a1b9UL, 0x933fc9a8UL, 0x42c6719bUL, 0x0d91198aUL,
+		0x96cd67acUL, 0xd99a0fbdUL, 0x0863b78eUL, 0x4734df9fUL, 0xaf51da5fUL, 0xe006b24eUL,
+		0x31ff0a7dUL, 0x7ea8626cUL, 0x0386eb86UL, 0x4cd18397UL, 0x9d283ba4UL, 0xd27f53b5UL,
+		0x3a1a5675UL, 0x754d3e64UL, 0xa4b48657UL, 0xebe3ee46UL, 0x70bf9060UL, 0x3fe8f871UL,
+		0xee114042UL, 0xa1462853UL, 0x49232d93UL, 0x06744582UL, 0xd78dfdb1UL, 0x98da95a0UL,
+		0xb958178cUL, 0xf60f7f9dUL, 0x27f6c7aeUL, 0x68a1afbfUL, 0x80c4aa7fUL, 0xcf93c26eUL,
+		0x1e6a7a5dUL, 0x513d124cUL, 0xca616c6aUL, 0x8536047bUL, 0x54cfbc48UL, 0x1b98d459UL,
+		0xf3fdd199UL, 0xbcaab988UL, 0x6d5301bbUL, 0x220469aaUL, 0x5f2ae040UL, 0x107d8851UL,
+		0xc1843062UL, 0x8ed35873UL, 0x66b65db3UL, 0x29e135a2UL, 0xf8188d91UL, 0xb74fe580UL,
+		0x2c139ba6UL, 0x6344f3b7UL, 0xb2bd4b84UL, 0xfdea2395UL, 0x158f2655UL, 0x5ad84e44UL,
+		0x8b21f677UL, 0xc4769e66UL, 0x717ce5a3UL, 0x3e2b8db2UL, 0xefd23581UL, 0xa0855d90UL,
+		0x48e05850UL, 0x07b73041UL, 0xd64e8872UL, 0x9919e063UL, 0x02459e45UL, 0x4d12f654UL,
+		0x9ceb4e67UL, 0xd3bc2676UL, 0x3bd923b6UL, 0x748e4ba7UL, 0xa577f394UL, 0xea209b85UL,
+		0x970e126fUL, 0xd8597a7eUL, 0x09a0c24dUL, 0x46f7aa5cUL, 0xae92af9cUL, 0xe1c5c78dUL,
+		0x303c7fbeUL, 0x7f6b17afUL, 0xe4376989UL, 0xab600198UL, 0x7a99b9abUL, 0x35ced1baUL,
+		0xddabd47aUL, 0x92fcbc6bUL, 0x43050458UL, 0x0c526c49UL
+	},
+	{
+		0x00000000UL, 0x5ba1dccaUL, 0xb743b994UL, 0xece2655eUL, 0x6a466e9fUL, 0x31e7b255UL,
+		0xdd05d70bUL, 0x86a40bc1UL, 0xd48cdd3eUL, 0x8f2d01f4UL, 0x63cf64aaUL, 0x386eb860UL,
+		0xbecab3a1UL, 0xe56b6f6bUL, 0x09890a35UL, 0x5228d6ffUL, 0xadd8a7cbUL, 0xf6797b01UL,
+		0x1a9b1e5fUL, 0x413ac295UL, 0xc79ec954UL, 0x9c3f159eUL, 0x70dd70c0UL, 0x2b7cac0aUL,
+		0x79547af5UL, 0x22f5a63fUL, 0xce17c361UL, 0x95b61fabUL, 0x1312146aUL, 0x48b3c8a0UL,
+		0xa451adfeUL, 0xfff07134UL, 0x5f705221UL, 0x04d18eebUL, 0xe833ebb5UL, 0xb392377fUL,
+		0x35363cbeUL, 0x6e97e074UL, 0x8275852aUL, 0xd9d459e0UL, 0x8bfc8f1fUL, 0xd05d53d5UL,
+		0x3cbf368bUL, 0x671eea41UL, 0xe1bae180UL, 0xba1b3d4aUL, 0x56f95814UL, 0x0d5884deUL,
+		0xf2a8f5eaUL, 0xa9092920UL, 0x45eb4c7eUL, 0x1e4a90b4UL, 0x98ee9b75UL, 0xc34f47bfUL,
+		0x2fad22e1UL, 0x740cfe2bUL, 0x262428d4UL, 0x7d85f41eUL, 0x91679140UL, 0xcac64d8aUL,
+		0x4c62464bUL, 0x17c39a81UL, 0xfb21ffdfUL, 0xa0802315UL, 0xbee0a442UL, 0xe5417888UL,
+		0x09a31dd6UL, 0x5202c11cUL, 0xd4a6caddUL, 0x8f071617UL, 0x63e57349UL, 0x3844af83UL,
+		0x6a6c797cUL, 0x31cda5b6UL, 0xdd2fc0e8UL, 0x868e1c22UL, 0x002a17e3UL, 0x5b8bcb29UL,
+		0xb769ae77UL, 0xecc872bdUL, 0x13380389UL, 0x4899df43UL, 0xa47bba1dUL, 0xffda66d7UL,
+		0x797e6d16UL, 0x22dfb1dcUL, 0xce3dd482UL, 0x959c0848UL, 0xc7b4deb7UL, 0x9c15027dUL,
+		0x70f76723UL, 0x2b56bbe9UL, 0xadf2b028UL, 0xf6536ce2UL, 0x1ab109bcUL, 0x4110d576UL,
+		0xe190f663UL, 0xba312aa9UL, 0x56d34ff7UL, 0x0d72933dUL, 0x8bd698fcUL, 0xd0774436UL,
+		0x3c952168UL, 0x6734fda2UL, 0x351c2b5dUL, 0x6ebdf797UL, 0x825f92c9UL, 0xd9fe4e03UL,
+		0x5f5a45c2UL, 0x04fb9908UL, 0xe819fc56UL, 0xb3b8209cUL, 0x4c4851a8UL, 0x17e98d62UL,
+		0xfb0be83cUL, 0xa0aa34f6UL, 0x260e3f37UL, 0x7dafe3fdUL, 0x914d86a3UL, 0xcaec5a69UL,
+		0x98c48c96UL, 0xc365505cUL, 0x2f873502UL, 0x7426e9c8UL, 0xf282e209UL, 0xa9233ec3UL,
+		0x45c15b9dUL, 0x1e608757UL, 0x79005533UL, 0x22a189f9UL, 0xce43eca7UL, 0x95e2306dUL,
+		0x13463bacUL, 0x48e7e766UL, 0xa4058238UL, 0xffa45ef2UL, 0xad8c880dUL, 0xf62d54c7UL,
+		0x1acf3199UL, 0x416eed53UL, 0xc7cae692UL, 0x9c6b3a58UL, 0x70895f06UL, 0x2b2883ccUL,
+		0xd4d8f2f8UL, 0x8f792e32UL, 0x639b4b6cUL, 0x383a97a6UL, 0xbe9e9c67UL, 0xe53f40adUL,
+		0x09dd25f3UL, 0x527cf939UL, 0x00542fc6UL, 0x5bf5f30cUL, 0xb7179652UL, 0xecb64a98UL,
+		0x6a124159UL, 0x31b39d93UL, 0xdd51f8cdUL, 0x86f02407UL, 0x26700712UL, 0x7dd1dbd8UL,
+		0x9133be86UL, 0xca92624cUL, 0x4c36698dUL, 0x1797b547UL, 0xfb75d019UL, 0xa0d40cd3UL,
+		0xf2fcda2cUL, 0xa95d06e6UL, 0x45bf63b8UL, 0x1e1ebf72UL, 0x98bab4b3UL, 0xc31b6879UL,
+		0x2ff90d27UL, 0x7458d1edUL, 0x8ba8a0d9UL, 0xd0097c13UL, 0x3ceb194dUL, 0x674ac587UL,
+		0xe1eece46UL, 0xba4f128cUL, 0x56ad77d2UL, 0x0d0cab18UL, 0x5f247de7UL, 0x0485a12dUL,
+		0xe867c473UL, 0xb3c618b9UL, 0x35621378UL, 0x6ec3cfb2UL, 0x8221aaecUL, 0xd9807626UL,
+		0xc7e0f171UL, 0x9c412dbbUL, 0x70a348e5UL, 0x2b02942fUL, 0xada69feeUL, 0xf6074324UL,
+		0x1ae5267aUL, 0x4144fab0UL, 0x136c2c4fUL, 0x48cdf085UL, 0xa42f95dbUL, 0xff8e4911UL,
+		0x792a42d0UL, 0x228b9e1aUL, 0xce69fb44UL, 0x95c8278eUL, 0x6a3856baUL, 0x31998a70UL,
+		0xdd7bef2eUL, 0x86da33e4UL, 0x007e3825UL, 0x5bdfe4efUL, 0xb73d81b1UL, 0xec9c5d7bUL,
+		0xbeb48b84UL, 0xe515574eUL, 0x09f73210UL, 0x5256eedaUL, 0xd4f2e51bUL, 0x8f5339d1UL,
+		0x63b15c8fUL, 0x38108045UL, 0x9890a350UL, 0xc3317f9aUL, 0x2fd31ac4UL, 0x7472c60eUL,
+		0xf2d6cdcfUL, 0xa9771105UL, 0x4595745bUL, 0x1e34a891UL, 0x4c1c7e6eUL, 0x17bda2a4UL,
+		0xfb5fc7faUL, 0xa0fe1b30UL, 0x265a10f1UL, 0x7dfbcc3bUL, 0x9119a965UL, 0xcab875afUL,
+		0x3548049bUL, 0x6ee9d851UL, 0x820bbd0fUL, 0xd9aa61c5UL, 0x5f0e6a04UL, 0x04afb6ceUL,
+		0xe84dd390UL, 0xb3ec0f5aUL, 0xe1c4d9a5UL, 0xba65056fUL, 0x56876031UL, 0x0d26bcfbUL,
+		0x8b82b73aUL, 0xd0236bf0UL, 0x3cc10eaeUL, 0x6760d264UL
+	}
+};
+
+/* Creates a BZIP2 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int libmodi_bzip_crc32_table_computed = 0;
+int libmodi_bzip_context_initialize(
+     libmodi_bzip_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_bzip_context_initialize";
+	uint8_t tree_index    = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            libmodi_bzip_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( libmodi_bzip_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
+	}
+	/* A block contains at most 256 byte values and the RUNA, RUNB and
+	 * end of block symbols, where RUNA and RUNB replace byte value 0
+	 */
+	for( tree_index = 0;
+	     tree_index < LIBMODI_BZIP_MAXIMUM_NUMBER_OF_TREES;
+	     tree_index++ )
+	{
+		if( libmodi_huffman_tree_initialize(
+		     &( ( *context )->huffman_trees[ tree_index ] ),
+		     258,
+		     20,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create Huffman tree: %" PRIu8 ".",
+			 function,
+			 tree_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		libmodi_bzip_context_free(
+		 context,
+		 NULL );
+	}
+	return( -1 );
+}
 
-/* Initializes the internal CRC-32 table
- * The table speeds up the CRC-32 calculation
- * The table is calcuted in reverse bit-order
+/* Frees a BZIP2 context
+ * Returns 1 if successful or -1 on error
  */
-void libmodi_bzip_initialize_crc32_table(
-      void )
+int libmodi_bzip_context_free(
+     libmodi_bzip_context_t **context,
+     libcerror_error_t **error )
 {
-	uint32_t crc32             = 0;
-	uint16_t crc32_table_index = 0;
-	uint8_t bit_iterator       = 0;
+	static char *function = "libmodi_bzip_context_free";
+	uint8_t tree_index    = 0;
+	int result            = 1;
 
-	for( crc32_table_index = 0;
-	     crc32_table_index < 256;
-	     crc32_table_index++ )
+	if( context == NULL )
 	{
-		crc32 = (uint32_t) crc32_table_index << 24;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
-		for( bit_iterator = 0;
-		     bit_iterator < 8;
-		     bit_iterator++ )
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		for( tree_index = 0;
+		     tree_index < LIBMODI_BZIP_MAXIMUM_NUMBER_OF_TREES;
+		     tree_index++ )
 		{
-			if( crc32 & 0x80000000UL )
+			if( ( *context )->huffman_trees[ tree_index ] != NULL )
 			{
-				crc32 = 0x04c11db7UL ^ ( crc32 << 1 );
-			}
-			else
-			{
-				crc32 = crc32 << 1;
+				if( libmodi_huffman_tree_free(
+				     &( ( *context )->huffman_trees[ tree_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free Huffman tree: %" PRIu8 ".",
+					 function,
+					 tree_index );
+
+					result = -1;
+				}
 			}
 		}
-		libmodi_bzip_crc32_table[ crc32_table_index ] = crc32;
+		if( ( *context )->permutations != NULL )
+		{
+			memory_free(
+			 ( *context )->permutations );
+		}
+		if( ( *context )->block_data != NULL )
+		{
+			memory_free(
+			 ( *context )->block_data );
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Resizes the block data and permutations of a BZIP2 context
+ * The buffers are only reallocated when they are smaller than the block data size
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_bzip_context_resize_block_data(
+     libmodi_bzip_context_t *context,
+     size_t block_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_bzip_context_resize_block_data";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_data_size == 0 )
+	 || ( block_data_size > (size_t) 900000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_size <= context->block_data_size )
+	{
+		return( 1 );
 	}
-	libmodi_bzip_crc32_table_computed = 1;
+	if( context->permutations != NULL )
+	{
+		memory_free(
+		 context->permutations );
+
+		context->permutations = NULL;
+	}
+	if( context->block_data != NULL )
+	{
+		memory_free(
+		 context->block_data );
+
+		context->block_data = NULL;
+	}
+	context->block_data_size = 0;
+
+	context->block_data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * block_data_size );
+
+	if( context->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		return( -1 );
+	}
+	context->permutations = (uint32_t *) memory_allocate(
+	                                      sizeof( uint32_t ) * block_data_size );
+
+	if( context->permutations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create permutations.",
+		 function );
+
+		memory_free(
+		 context->block_data );
+
+		context->block_data = NULL;
+
+		return( -1 );
+	}
+	context->block_data_size = block_data_size;
+
+	return( 1 );
 }
 
 /* Calculates the CRC-32 of a buffer
@@ -83,10 +671,11 @@ int libmodi_bzip_calculate_crc32(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	static char *function      = "libmodi_bzip_calculate_crc32";
-	size_t data_offset         = 0;
-	uint32_t crc32_table_index = 0;
-	uint32_t safe_crc32        = 0;
+	static char *function   = "libmodi_bzip_calculate_crc32";
+	size_t data_offset      = 0;
+	size_t number_of_blocks = 0;
+	uint32_t safe_crc32     = 0;
+	uint32_t value_32bit    = 0;
 
 	if( crc32 == NULL )
 	{
@@ -121,34 +710,183 @@ int libmodi_bzip_calculate_crc32(
 
 		return( -1 );
 	}
-        if( libmodi_bzip_crc32_table_computed == 0 )
+	safe_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+
+#if defined( LIBMODI_BZIP_HAVE_X86_PCLMUL )
+	if( ( data_size >= 256 )
+	 && ( __builtin_cpu_supports( "pclmul" ) )
+	 && ( __builtin_cpu_supports( "ssse3" ) ) )
 	{
-		libmodi_bzip_initialize_crc32_table();
+		number_of_blocks = data_size / 64;
+
+		libmodi_bzip_calculate_crc32_pclmul(
+		 &safe_crc32,
+		 data,
+		 number_of_blocks );
+
+		data_offset = number_of_blocks * 64;
 	}
-	safe_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+#endif /* defined( LIBMODI_BZIP_HAVE_X86_PCLMUL ) */
 
-        for( data_offset = 0;
-	     data_offset < data_size;
-	     data_offset++ )
+	/* Use the upper 8-bits of the pre-calculated CRC-32 values due to BZip bit ordering
+	 */
+	while( ( data_size - data_offset ) >= 8 )
 	{
-		/* Use the upper 8-bits of the pre-calculated CRC-32 values due to BZip bit ordering
-		 */
-		crc32_table_index = ( ( safe_crc32 >> 24 ) ^ data[ data_offset ] ) & 0x000000ffUL;
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		value_32bit ^= safe_crc32;
+
+		safe_crc32 = libmodi_bzip_crc32_table[ 7 ][ value_32bit >> 24 ]
+		           ^ libmodi_bzip_crc32_table[ 6 ][ ( value_32bit >> 16 ) & 0x000000ffUL ]
+		           ^ libmodi_bzip_crc32_table[ 5 ][ ( value_32bit >> 8 ) & 0x000000ffUL ]
+		           ^ libmodi_bzip_crc32_table[ 4 ][ value_32bit & 0x000000ffUL ]
+		           ^ libmodi_bzip_crc32_table[ 3 ][ data[ data_offset + 4 ] ]
+		           ^ libmodi_bzip_crc32_table[ 2 ][ data[ data_offset + 5 ] ]
+		           ^ libmodi_bzip_crc32_table[ 1 ][ data[ data_offset + 6 ] ]
+		           ^ libmodi_bzip_crc32_table[ 0 ][ data[ data_offset + 7 ] ];
+
+		data_offset += 8;
+	}
+	while( data_offset < data_size )
+	{
+		safe_crc32 = libmodi_bzip_crc32_table[ 0 ][ ( ( safe_crc32 >> 24 ) ^ data[ data_offset ] ) & 0x000000ffUL ]
+		           ^ ( safe_crc32 << 8 );
 
-		safe_crc32 = libmodi_bzip_crc32_table[ crc32_table_index ] ^ ( safe_crc32 << 8 );
-        }
-        *crc32 = safe_crc32 ^ (uint32_t) 0xffffffffUL;
+		data_offset++;
+	}
+	*crc32 = safe_crc32 ^ (uint32_t) 0xffffffffUL;
 
 	return( 1 );
 }
 
+#if defined( LIBMODI_BZIP_HAVE_X86_PCLMUL )
+
+/* Calculates the CRC-32 of 64-byte blocks using carry-less multiplication
+ * The CRC-32 is the intermediate value, not the finalized (inverted) CRC-32
+ *
+ * The blocks are folded into four 128-bit accumulators, where each 64-bit half
+ * is multiplied by x^N modulo the polynomial for the distance N it is moved forward.
+ * The remaining 128 bits are reduced using the table.
+ */
+__attribute__((target("pclmul,ssse3")))
+void libmodi_bzip_calculate_crc32_pclmul(
+      uint32_t *crc32,
+      const uint8_t *data,
+      size_t number_of_blocks )
+{
+	uint8_t state_data[ 16 ];
+
+	__m128i accumulator1;
+	__m128i accumulator2;
+	__m128i accumulator3;
+	__m128i accumulator4;
+
+	/* x^576 and x^512 modulo the polynomial, to fold 512 bits
+	 */
+	const __m128i fold_512bit_constants = _mm_set_epi64x( 0x8833794cUL, 0xe6228b11UL );
+
+	/* x^192 and x^128 modulo the polynomial, to fold 128 bits
+	 */
+	const __m128i fold_128bit_constants = _mm_set_epi64x( 0xc5b9cd4cUL, 0xe8a45605UL );
+
+	const __m128i byte_order_mask = _mm_setr_epi8( 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 );
+
+	uint32_t safe_crc32 = *crc32;
+	uint8_t byte_index  = 0;
+
+	accumulator1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) data ), byte_order_mask );
+	accumulator2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( data[ 16 ] ) ), byte_order_mask );
+	accumulator3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( data[ 32 ] ) ), byte_order_mask );
+	accumulator4 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( data[ 48 ] ) ), byte_order_mask );
+
+	/* The CRC-32 corresponds to the first 4 bytes of the data
+	 */
+	accumulator1 = _mm_xor_si128( accumulator1, _mm_set_epi32( (int) safe_crc32, 0, 0, 0 ) );
+
+	data             += 64;
+	number_of_blocks -= 1;
+
+	while( number_of_blocks > 0 )
+	{
+		accumulator1 = _mm_xor_si128(
+		                _mm_xor_si128(
+		                 _mm_clmulepi64_si128( accumulator1, fold_512bit_constants, 0x11 ),
+		                 _mm_clmulepi64_si128( accumulator1, fold_512bit_constants, 0x00 ) ),
+		                _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) data ), byte_order_mask ) );
+
+		accumulator2 = _mm_xor_si128(
+		                _mm_xor_si128(
+		                 _mm_clmulepi64_si128( accumulator2, fold_512bit_constants, 0x11 ),
+		                 _mm_clmulepi64_si128( accumulator2, fold_512bit_constants, 0x00 ) ),
+		                _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( data[ 16 ] ) ), byte_order_mask ) );
+
+		accumulator3 = _mm_xor_si128(
+		                _mm_xor_si128(
+		                 _mm_clmulepi64_si128( accumulator3, fold_512bit_constants, 0x11 ),
+		                 _mm_clmulepi64_si128( accumulator3, fold_512bit_constants, 0x00 ) ),
+		                _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( data[ 32 ] ) ), byte_order_mask ) );
+
+		accumulator4 = _mm_xor_si128(
+		                _mm_xor_si128(
+		                 _mm_clmulepi64_si128( accumulator4, fold_512bit_constants, 0x11 ),
+		                 _mm_clmulepi64_si128( accumulator4, fold_512bit_constants, 0x00 ) ),
+		                _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( data[ 48 ] ) ), byte_order_mask ) );
+
+		data             += 64;
+		number_of_blocks -= 1;
+	}
+	/* Fold the accumulators into a single 128-bit value
+	 */
+	accumulator2 = _mm_xor_si128(
+	                _mm_xor_si128(
+	                 _mm_clmulepi64_si128( accumulator1, fold_128bit_constants, 0x11 ),
+	                 _mm_clmulepi64_si128( accumulator1, fold_128bit_constants, 0x00 ) ),
+	                accumulator2 );
+
+	accumulator3 = _mm_xor_si128(
+	                _mm_xor_si128(
+	                 _mm_clmulepi64_si128( accumulator2, fold_128bit_constants, 0x11 ),
+	                 _mm_clmulepi64_si128( accumulator2, fold_128bit_constants, 0x00 ) ),
+	                accumulator3 );
+
+	accumulator4 = _mm_xor_si128(
+	                _mm_xor_si128(
+	                 _mm_clmulepi64_si128( accumulator3, fold_128bit_constants, 0x11 ),
+	                 _mm_clmulepi64_si128( accumulator3, fold_128bit_constants, 0x00 ) ),
+	                accumulator4 );
+
+	_mm_storeu_si128(
+	 (__m128i *) state_data,
+	 _mm_shuffle_epi8( accumulator4, byte_order_mask ) );
+
+	/* The CRC-32 of the remaining 128 bits with an initial CRC-32 of 0
+	 */
+	safe_crc32 = 0;
+
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		safe_crc32 = libmodi_bzip_crc32_table[ 0 ][ ( ( safe_crc32 >> 24 ) ^ state_data[ byte_index ] ) & 0x000000ffUL ]
+		           ^ ( safe_crc32 << 8 );
+	}
+	*crc32 = safe_crc32;
+}
+
+#endif /* defined( LIBMODI_BZIP_HAVE_X86_PCLMUL ) */
+
 /* Reverses a Burrows-Wheeler transform and run-length encoded strings
+ * The permutations are packed 32-bit values that contain the byte value in the lower 8 bits
+ * and the index of the next value in the upper 24 bits, so that walking the permutations
+ * only accesses a single array
  * Returns 1 on success or -1 on error
  */
 int libmodi_bzip_reverse_burrows_wheeler_transform(
      const uint8_t *input_data,
      size_t input_data_size,
-     size_t *permutations,
+     uint32_t *permutations,
      uint32_t origin_pointer,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -161,8 +899,8 @@ int libmodi_bzip_reverse_burrows_wheeler_transform(
 	size_t input_data_offset             = 0;
 	size_t distribution_value            = 0;
 	size_t number_of_values              = 0;
-	size_t permutation_value             = 0;
 	size_t safe_uncompressed_data_offset = 0;
+	uint32_t permutation_value           = 0;
 	uint16_t byte_value                  = 0;
 	uint16_t last_byte_value             = 0;
 	uint8_t number_of_last_byte_values   = 0;
@@ -178,7 +916,7 @@ int libmodi_bzip_reverse_burrows_wheeler_transform(
 
 		return( -1 );
 	}
-	if( input_data_size > (size_t) SSIZE_MAX )
+	if( input_data_size > (size_t) 0x00ffffffUL )
 	{
 		libcerror_error_set(
 		 error,
@@ -200,6 +938,18 @@ int libmodi_bzip_reverse_burrows_wheeler_transform(
 
 		return( -1 );
 	}
+	if( ( input_data_size > 0 )
+	 && ( (size_t) origin_pointer >= input_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid origin pointer value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -267,6 +1017,8 @@ int libmodi_bzip_reverse_burrows_wheeler_transform(
 		byte_value = input_data[ input_data_offset ];
 
 		distributions[ byte_value ] += 1;
+
+		permutations[ input_data_offset ] = (uint32_t) byte_value;
 	}
 	for( byte_value = 0;
 	     byte_value < 256;
@@ -286,17 +1038,21 @@ int libmodi_bzip_reverse_burrows_wheeler_transform(
 
 		distribution_value = distributions[ byte_value ];
 
-		permutations[ distribution_value ] = input_data_offset;
+		permutations[ distribution_value ] |= (uint32_t) input_data_offset << 8;
 
 		distributions[ byte_value ] += 1;
 	}
-	permutation_value = permutations[ origin_pointer ];
-
+	if( input_data_size > 0 )
+	{
+		permutation_value = permutations[ origin_pointer ] >> 8;
+	}
 	for( input_data_offset = 0;
 	     input_data_offset < input_data_size;
 	     input_data_offset++ )
 	{
-		byte_value = input_data[ permutation_value ];
+		permutation_value = permutations[ permutation_value ];
+		byte_value        = (uint16_t) ( permutation_value & 0x000000ffUL );
+		permutation_value >>= 8;
 
 		if( number_of_last_byte_values == 4 )
 		{
@@ -343,7 +1099,6 @@ int libmodi_bzip_reverse_burrows_wheeler_transform(
 			}
 			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) byte_value;
 		}
-		permutation_value = permutations[ permutation_value ];
 	}
 	*uncompressed_data_offset = safe_uncompressed_data_offset;
 
@@ -1100,6 +1855,7 @@ int libmodi_bzip_read_huffman_tree(
 	     huffman_tree,
 	     code_size_array,
 	     number_of_symbols,
+	     LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1115,6 +1871,7 @@ int libmodi_bzip_read_huffman_tree(
 }
 
 /* Reads the Huffman trees
+ * The Huffman trees are rebuilt and must have been created with sufficient symbols
  * Returns 1 on success or -1 on error
  */
 int libmodi_bzip_read_huffman_trees(
@@ -1124,9 +1881,8 @@ int libmodi_bzip_read_huffman_trees(
      uint16_t number_of_symbols,
      libcerror_error_t **error )
 {
-	libmodi_huffman_tree_t *huffman_tree = NULL;
-	static char *function                = "libmodi_bzip_read_huffman_trees";
-	uint8_t tree_index                   = 0;
+	static char *function = "libmodi_bzip_read_huffman_trees";
+	uint8_t tree_index    = 0;
 
 	if( huffman_trees == NULL )
 	{
@@ -1139,6 +1895,17 @@ int libmodi_bzip_read_huffman_trees(
 
 		return( -1 );
 	}
+	if( number_of_trees > LIBMODI_BZIP_MAXIMUM_NUMBER_OF_TREES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of trees value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	for( tree_index = 0;
 	     tree_index < number_of_trees;
 	     tree_index++ )
@@ -1152,25 +1919,9 @@ int libmodi_bzip_read_huffman_trees(
 			 tree_index );
 		}
 #endif
-		if( libmodi_huffman_tree_initialize(
-		     &huffman_tree,
-		     number_of_symbols,
-		     20,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create Huffman tree: %" PRIu8 ".",
-			 function,
-			 tree_index );
-
-			goto on_error;
-		}
 		if( libmodi_bzip_read_huffman_tree(
 		     bit_stream,
-		     huffman_tree,
+		     huffman_trees[ tree_index ],
 		     number_of_symbols,
 		     error ) != 1 )
 		{
@@ -1182,29 +1933,35 @@ int libmodi_bzip_read_huffman_trees(
 			 function,
 			 tree_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		huffman_trees[ tree_index ] = huffman_tree;
-		huffman_tree                = NULL;
 	}
 	return( 1 );
+}
 
-on_error:
-	if( huffman_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &huffman_tree,
-		 NULL );
-	}
-	for( tree_index = 0;
-	     tree_index < number_of_trees;
-	     tree_index++ )
+/* Moves the symbol at a specific index of the symbol stack to the front
+ * as part of the inverse move-to-front transform
+ */
+void libmodi_bzip_move_symbol_to_front(
+      uint8_t *symbol_stack,
+      uint8_t stack_index )
+{
+	uint8_t stack_value = 0;
+
+	if( stack_index > 0 )
 	{
-		libmodi_huffman_tree_free(
-		 &( huffman_trees[ tree_index ] ),
-		 NULL );
+		stack_value = symbol_stack[ stack_index ];
+
+		/* The symbols before the index are moved up in a single move
+		 * rather than one at a time
+		 */
+		memmove(
+		 &( symbol_stack[ 1 ] ),
+		 symbol_stack,
+		 (size_t) stack_index );
+
+		symbol_stack[ 0 ] = stack_value;
 	}
-	return( -1 );
 }
 
 /* Reads block data
@@ -1222,19 +1979,20 @@ int libmodi_bzip_read_block_data(
      size_t *block_data_size,
      libcerror_error_t **error )
 {
+	libmodi_huffman_tree_t *huffman_tree = NULL;
 	static char *function                = "libmodi_bzip_read_block_data";
 	size_t block_data_offset             = 0;
 	size_t safe_block_data_size          = 0;
-	size_t selector_index                = 0;
-	size_t symbol_index                  = 0;
 	uint64_t run_length                  = 0;
 	uint64_t run_length_value            = 0;
 	uint16_t end_of_block_symbol         = 0;
+	uint16_t lookup_value                = 0;
+	uint16_t selector_index              = 0;
 	uint16_t symbol                      = 0;
+	uint8_t code_size                    = 0;
+	uint8_t number_of_group_symbols      = 0;
 	uint8_t number_of_run_length_symbols = 0;
-	uint8_t stack_index                  = 0;
 	uint8_t stack_value                  = 0;
-	uint8_t stack_value_index            = 0;
 	uint8_t tree_index                   = 0;
 
 	if( bit_stream == NULL )
@@ -1259,6 +2017,17 @@ int libmodi_bzip_read_block_data(
 
 		return( -1 );
 	}
+	if( selectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selectors.",
+		 function );
+
+		return( -1 );
+	}
 	if( symbol_stack == NULL )
 	{
 		libcerror_error_set(
@@ -1305,28 +2074,69 @@ int libmodi_bzip_read_block_data(
 	}
 	safe_block_data_size = *block_data_size;
 
-	tree_index = selectors[ 0 ];
-
-	if( tree_index > number_of_trees )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid tree index value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	end_of_block_symbol = number_of_symbols - 1;
 
 	do
 	{
-		if( libmodi_huffman_tree_get_symbol_from_bit_stream(
-		     huffman_trees[ tree_index ],
-		     bit_stream,
-		     &symbol,
-		     error ) != 1 )
+		/* Every group of 50 symbols is decoded with the Huffman tree of its selector
+		 */
+		if( number_of_group_symbols == 0 )
+		{
+			if( selector_index >= number_of_selectors )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid selector index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			tree_index = selectors[ selector_index++ ];
+
+			if( tree_index >= number_of_trees )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tree index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			huffman_tree            = huffman_trees[ tree_index ];
+			number_of_group_symbols = 50;
+		}
+		number_of_group_symbols--;
+
+		/* Codes that are not fully available in the bit buffer or larger
+		 * than the lookup table are decoded by the Huffman tree function
+		 */
+		LIBMODI_BIT_STREAM_REFILL_FRONT_TO_BACK(
+		 bit_stream );
+
+		lookup_value = 0;
+
+		if( bit_stream->bit_buffer_size >= LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS )
+		{
+			lookup_value = huffman_tree->lookup_table[ LIBMODI_BIT_STREAM_PEEK_FRONT_TO_BACK( bit_stream, LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS ) ];
+		}
+		if( lookup_value != 0 )
+		{
+			symbol    = lookup_value >> 4;
+			code_size = (uint8_t) ( lookup_value & 0x000f );
+
+			LIBMODI_BIT_STREAM_CONSUME_FRONT_TO_BACK(
+			 bit_stream,
+			 code_size );
+		}
+		else if( libmodi_huffman_tree_get_symbol_from_bit_stream(
+		          huffman_tree,
+		          bit_stream,
+		          &symbol,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1367,11 +2177,11 @@ int libmodi_bzip_read_block_data(
 			run_length_value             = 0;
 			number_of_run_length_symbols = 0;
 
+			/* Inverse move-to-front transform
+			 * Note that 0 is already at the front of the stack hence the stack does not need to be reordered.
+			 */
 			while( run_length > 0 )
 			{
-				/* Inverse move-to-front transform
-				 * Note that 0 is already at the front of the stack hence the stack does not need to be reordered.
-				 */
 				block_data[ block_data_offset++ ] = symbol_stack[ 0 ];
 
 				run_length--;
@@ -1391,6 +2201,19 @@ int libmodi_bzip_read_block_data(
 		if( ( symbol == 0 )
 		 || ( symbol == 1 ) )
 		{
+			/* A run-length of more than 24 symbols exceeds the maximum block size
+			 */
+			if( number_of_run_length_symbols >= 24 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of run-length symbols value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
 			run_length_value             |= (uint64_t) symbol << number_of_run_length_symbols;
 			number_of_run_length_symbols += 1;
 
@@ -1408,16 +2231,11 @@ int libmodi_bzip_read_block_data(
 		{
 			/* Inverse move-to-front transform
 			 */
-			stack_value_index = symbol - 1;
-			stack_value       = symbol_stack[ stack_value_index ];
+			libmodi_bzip_move_symbol_to_front(
+			 symbol_stack,
+			 (uint8_t) ( symbol - 1 ) );
 
-			for( stack_index = stack_value_index;
-			     stack_index > 0;
-			     stack_index-- )
-			{
-				symbol_stack[ stack_index ] = symbol_stack[ stack_index - 1 ];
-			}
-			symbol_stack[ 0 ] = stack_value;
+			stack_value = symbol_stack[ 0 ];
 
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -1451,37 +2269,6 @@ int libmodi_bzip_read_block_data(
 			 symbol );
 		}
 #endif
-		symbol_index++;
-
-		if( ( symbol_index % 50 ) == 0 )
-		{
-			selector_index = symbol_index / 50;
-
-			if( selector_index > number_of_selectors )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid selector index value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			tree_index = selectors[ selector_index ];
-
-			if( tree_index > number_of_trees )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid tree index value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-		}
 	}
 	while( symbol != end_of_block_symbol );
 
@@ -1565,6 +2352,7 @@ int libmodi_bzip_read_stream_footer(
  * Returns 1 on success or -1 on error
  */
 int libmodi_bzip_decompress(
+     libmodi_bzip_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
@@ -1574,32 +2362,36 @@ int libmodi_bzip_decompress(
 	uint8_t symbol_stack[ 256 ];
 	uint8_t selectors[ ( 1 << 15 ) + 1 ];
 
-	libmodi_huffman_tree_t *huffman_trees[ 7 ] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL };
-
-	libmodi_bit_stream_t *bit_stream           = NULL;
-	size_t *permutations                       = NULL;
-	uint8_t *block_data                        = NULL;
-	static char *function                      = "libmodi_bzip_decompress";
-	size_t block_data_size                     = 0;
-	size_t compressed_data_offset              = 0;
-	size_t safe_block_data_size                = 0;
-	size_t safe_uncompressed_data_size         = 0;
-	size_t uncompressed_data_offset            = 0;
-	uint64_t signature                         = 0;
-	uint32_t calculated_checksum               = 0;
-	uint32_t origin_pointer                    = 0;
-	uint32_t stored_checksum                   = 0;
-	uint32_t value_32bit                       = 0;
-	uint16_t number_of_selectors               = 0;
-	uint16_t number_of_symbols                 = 0;
-	uint8_t compression_level                  = 0;
-	uint8_t number_of_trees                    = 0;
-	uint8_t tree_index                         = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	size_t block_data_offset                   = 0;
-#endif
+	libmodi_bit_stream_t *bit_stream   = NULL;
+	static char *function              = "libmodi_bzip_decompress";
+	size_t block_data_offset           = 0;
+	size_t block_data_size             = 0;
+	size_t compressed_data_offset      = 0;
+	size_t safe_block_data_size        = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint64_t signature                 = 0;
+	uint32_t block_checksum            = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t origin_pointer            = 0;
+	uint32_t stored_checksum           = 0;
+	uint32_t value_32bit               = 0;
+	uint16_t number_of_selectors       = 0;
+	uint16_t number_of_symbols         = 0;
+	uint8_t compression_level          = 0;
+	uint8_t number_of_trees            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -1663,32 +2455,22 @@ int libmodi_bzip_decompress(
 
 		goto on_error;
 	}
-	block_data_size = 100000;
-
-	block_data = (uint8_t *) memory_allocate(
-	                          sizeof( uint8_t ) * block_data_size );
+	/* The compression level defines the maximum block size in 100k units
+	 */
+	block_data_size = (size_t) compression_level * 100000;
 
-	if( block_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create block data.",
-		 function );
-
-		goto on_error;
-	}
-	permutations = (size_t *) memory_allocate(
-	                           sizeof( size_t ) * block_data_size );
-
-	if( permutations == NULL )
+	/* The block data and permutations are kept in the context across calls
+	 */
+	if( libmodi_bzip_context_resize_block_data(
+	     context,
+	     block_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create permutations.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize block data.",
 		 function );
 
 		goto on_error;
@@ -1710,7 +2492,8 @@ int libmodi_bzip_decompress(
 
 		goto on_error;
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
 	{
 		if( libmodi_bzip_read_signature(
 		     bit_stream,
@@ -1757,7 +2540,7 @@ int libmodi_bzip_decompress(
 
 			goto on_error;
 		}
-		if( origin_pointer > block_data_size )
+		if( origin_pointer >= block_data_size )
 		{
 			libcerror_error_set(
 			 error,
@@ -1814,6 +2597,18 @@ int libmodi_bzip_decompress(
 		}
 		number_of_trees = (uint8_t) ( value_32bit & 0x00000007UL );
 
+		if( ( number_of_trees < 2 )
+		 || ( number_of_trees > LIBMODI_BZIP_MAXIMUM_NUMBER_OF_TREES ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of trees value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
 		if( libmodi_bit_stream_get_value(
 		     bit_stream,
 		     15,
@@ -1880,7 +2675,7 @@ int libmodi_bzip_decompress(
 		}
 		if( libmodi_bzip_read_huffman_trees(
 		     bit_stream,
-		     huffman_trees,
+		     context->huffman_trees,
 		     number_of_trees,
 		     number_of_symbols,
 		     error ) != 1 )
@@ -1898,13 +2693,13 @@ int libmodi_bzip_decompress(
 
 		if( libmodi_bzip_read_block_data(
 		     bit_stream,
-		     huffman_trees,
+		     context->huffman_trees,
 		     number_of_trees,
 		     selectors,
 		     number_of_selectors,
 		     symbol_stack,
 		     number_of_symbols,
-		     block_data,
+		     context->block_data,
 		     &safe_block_data_size,
 		     error ) != 1 )
 		{
@@ -1917,29 +2712,14 @@ int libmodi_bzip_decompress(
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
 		block_data_offset = uncompressed_data_offset;
-#endif
-		if( memory_set(
-		     permutations,
-		     0,
-		     sizeof( size_t ) * block_data_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear permutations.",
-			 function );
 
-			goto on_error;
-		}
 		/* Perform Burrows-Wheeler transform
 		 */
 		if( libmodi_bzip_reverse_burrows_wheeler_transform(
-		     block_data,
+		     context->block_data,
 		     safe_block_data_size,
-		     permutations,
+		     context->permutations,
 		     origin_pointer,
 		     uncompressed_data,
 		     safe_uncompressed_data_size,
@@ -1955,6 +2735,27 @@ int libmodi_bzip_decompress(
 
 			goto on_error;
 		}
+		if( libmodi_bzip_calculate_crc32(
+		     &block_checksum,
+		     &( uncompressed_data[ block_data_offset ] ),
+		     uncompressed_data_offset - block_data_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate block checksum.",
+			 function );
+
+			goto on_error;
+		}
+		/* The stream checksum combines the block checksums
+		 */
+		calculated_checksum = ( calculated_checksum << 1 ) | ( calculated_checksum >> 31 );
+		calculated_checksum ^= block_checksum;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -1967,25 +2768,6 @@ int libmodi_bzip_decompress(
 			 0 );
 		}
 #endif
-		for( tree_index = 0;
-		     tree_index < number_of_trees;
-		     tree_index++ )
-		{
-			if( libmodi_huffman_tree_free(
-			     &( huffman_trees[ tree_index ] ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free Huffman tree: %" PRIu8 ".",
-				 function,
-				 tree_index );
-
-				goto on_error;
-			}
-		}
 	}
 	if( libmodi_bzip_read_stream_footer(
 	     bit_stream,
@@ -2015,32 +2797,6 @@ int libmodi_bzip_decompress(
 
 		goto on_error;
 	}
-	memory_free(
-	 permutations );
-
-	permutations = NULL;
-
-	memory_free(
-	 block_data );
-
-	block_data = NULL;
-
-	if( libmodi_bzip_calculate_crc32(
-	     &calculated_checksum,
-	     uncompressed_data,
-	     uncompressed_data_offset,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to calculate checksum.",
-		 function );
-
-		goto on_error;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -2073,30 +2829,12 @@ int libmodi_bzip_decompress(
 	return( 1 );
 
 on_error:
-	for( tree_index = 0;
-	     tree_index < number_of_trees;
-	     tree_index++ )
-	{
-		libmodi_huffman_tree_free(
-		 &( huffman_trees[ tree_index ] ),
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libmodi_bit_stream_free(
 		 &bit_stream,
 		 NULL );
 	}
-	if( permutations != NULL )
-	{
-		memory_free(
-		 permutations );
-	}
-	if( block_data != NULL )
-	{
-		memory_free(
-		 block_data );
-	}
 	return( -1 );
 }
 
@@ -29,12 +29,54 @@
 #include "libmodi_huffman_tree.h"
 #include "libmodi_libcerror.h"
 
+/* The carry-less multiplication CRC-32 function requires a compiler that supports
+ * per-function target attributes and run-time detection of PCLMULQDQ
+ */
+#if ( defined( __i386__ ) || defined( __x86_64__ ) ) && ( ( defined( __clang__ ) && ( __clang_major__ >= 8 ) ) || ( !defined( __clang__ ) && defined( __GNUC__ ) && ( __GNUC__ >= 8 ) ) )
+#define LIBMODI_BZIP_HAVE_X86_PCLMUL
+#endif
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-void libmodi_bzip_initialize_crc32_table(
-      void );
+/* The maximum number of Huffman trees in a block
+ */
+#define LIBMODI_BZIP_MAXIMUM_NUMBER_OF_TREES		6
+
+typedef struct libmodi_bzip_context libmodi_bzip_context_t;
+
+struct libmodi_bzip_context
+{
+	/* The block data
+	 */
+	uint8_t *block_data;
+
+	/* The permutations
+	 */
+	uint32_t *permutations;
+
+	/* The (allocated) block data size
+	 */
+	size_t block_data_size;
+
+	/* The Huffman trees
+	 */
+	libmodi_huffman_tree_t *huffman_trees[ LIBMODI_BZIP_MAXIMUM_NUMBER_OF_TREES ];
+};
+
+int libmodi_bzip_context_initialize(
+     libmodi_bzip_context_t **context,
+     libcerror_error_t **error );
+
+int libmodi_bzip_context_free(
+     libmodi_bzip_context_t **context,
+     libcerror_error_t **error );
+
+int libmodi_bzip_context_resize_block_data(
+     libmodi_bzip_context_t *context,
+     size_t block_data_size,
+     libcerror_error_t **error );
 
 int libmodi_bzip_calculate_crc32(
      uint32_t *crc32,
@@ -43,10 +85,19 @@ int libmodi_bzip_calculate_crc32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+#if defined( LIBMODI_BZIP_HAVE_X86_PCLMUL )
+
+void libmodi_bzip_calculate_crc32_pclmul(
+      uint32_t *crc32,
+      const uint8_t *data,
+      size_t number_of_blocks );
+
+#endif /* defined( LIBMODI_BZIP_HAVE_X86_PCLMUL ) */
+
 int libmodi_bzip_reverse_burrows_wheeler_transform(
      const uint8_t *input_data,
      size_t input_data_size,
-     size_t *permutations,
+     uint32_t *permutations,
      uint32_t origin_pointer,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -102,6 +153,10 @@ int libmodi_bzip_read_symbol(
      uint32_t *symbol,
      libcerror_error_t **error );
 
+void libmodi_bzip_move_symbol_to_front(
+      uint8_t *symbol_stack,
+      uint8_t stack_index );
+
 int libmodi_bzip_read_block_data(
      libmodi_bit_stream_t *bit_stream,
      libmodi_huffman_tree_t **huffman_trees,
@@ -121,6 +176,7 @@ int libmodi_bzip_read_stream_footer(
      libcerror_error_t **error );
 
 int libmodi_bzip_decompress(
+     libmodi_bzip_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
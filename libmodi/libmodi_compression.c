@@ -31,10 +31,6 @@
 #include <bzlib.h>
 #endif
 
-#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
-#include <lzma.h>
-#endif
-
 #if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
 #include <zlib.h>
 #endif
@@ -47,10 +43,153 @@
 #include "libmodi_libcnotify.h"
 #include "libmodi_libfmos.h"
 
+/* Creates a decompression context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_decompression_context_initialize(
+     libmodi_decompression_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_decompression_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            libmodi_decompression_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( libmodi_decompression_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decompression context
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_decompression_context_free(
+     libmodi_decompression_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_decompression_context_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+		lzma_end(
+		 &( ( *context )->lzma_stream ) );
+#endif
+		if( ( *context )->bzip_context != NULL )
+		{
+			if( libmodi_bzip_context_free(
+			     &( ( *context )->bzip_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free BZIP2 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *context )->deflate_context != NULL )
+		{
+			if( libmodi_deflate_context_free(
+			     &( ( *context )->deflate_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free deflate context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
 /* Decompresses data using the compression method
+ * The decompression context contains decoder state that is reused across calls
+ * and must not be used concurrently
  * Returns 1 on success or -1 on error
  */
 int libmodi_decompress_data(
+     libmodi_decompression_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      int compression_method,
@@ -65,7 +204,7 @@ int libmodi_decompress_data(
 	int bzlib_result                          = 0;
 #endif
 #if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
-	lzma_stream lzma_compressed_stream        = LZMA_STREAM_INIT;
+	lzma_stream *lzma_compressed_stream       = NULL;
 	lzma_ret lzma_result                      = 0;
 #endif
 #if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
@@ -73,6 +212,17 @@ int libmodi_decompress_data(
 	int zlib_result                           = 0;
 #endif
 
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -219,7 +369,24 @@ int libmodi_decompress_data(
 		}
 		*uncompressed_data_size = (size_t) bzip2_uncompressed_data_size;
 #else
+		if( context->bzip_context == NULL )
+		{
+			if( libmodi_bzip_context_initialize(
+			     &( context->bzip_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create BZIP2 context.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libmodi_bzip_decompress(
+		     context->bzip_context,
 		     compressed_data,
 		     compressed_data_size,
 		     uncompressed_data,
@@ -317,7 +484,24 @@ int libmodi_decompress_data(
 		}
 		*uncompressed_data_size = (size_t) zlib_uncompressed_data_size;
 #else
+		if( context->deflate_context == NULL )
+		{
+			if( libmodi_deflate_context_initialize(
+			     &( context->deflate_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create deflate context.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libmodi_deflate_decompress_zlib(
+		     context->deflate_context,
 		     compressed_data,
 		     compressed_data_size,
 		     uncompressed_data,
@@ -357,8 +541,13 @@ int libmodi_decompress_data(
 	else if( compression_method == LIBMODI_COMPRESSION_METHOD_LZMA )
 	{
 #if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+		lzma_compressed_stream = &( context->lzma_stream );
+
+		/* Initializing a stream that already contains a stream decoder only
+		 * resets its state and keeps the memory it has allocated
+		 */
 		lzma_result = lzma_stream_decoder(
-		               &lzma_compressed_stream,
+		               lzma_compressed_stream,
 		               UINT64_MAX,
 		               0 );
 
@@ -373,13 +562,13 @@ int libmodi_decompress_data(
 
 			goto on_error;
 		}
-		lzma_compressed_stream.next_in   = compressed_data;
-		lzma_compressed_stream.avail_in  = compressed_data_size;
-		lzma_compressed_stream.next_out  = uncompressed_data;
-		lzma_compressed_stream.avail_out = *uncompressed_data_size;
+		lzma_compressed_stream->next_in   = compressed_data;
+		lzma_compressed_stream->avail_in  = compressed_data_size;
+		lzma_compressed_stream->next_out  = uncompressed_data;
+		lzma_compressed_stream->avail_out = *uncompressed_data_size;
 
 		lzma_result = lzma_code(
-		               &lzma_compressed_stream,
+		               lzma_compressed_stream,
 		               LZMA_RUN );
 
 		if( ( lzma_result == LZMA_DATA_ERROR )
@@ -428,10 +617,7 @@ int libmodi_decompress_data(
 
 			goto on_error;
 		}
-		*uncompressed_data_size = (size_t) lzma_compressed_stream.total_out;
-
-		lzma_end(
-		 &lzma_compressed_stream );
+		*uncompressed_data_size = (size_t) lzma_compressed_stream->total_out;
 #else
 		libcerror_error_set(
 		 error,
@@ -457,10 +643,6 @@ int libmodi_decompress_data(
 	return( 1 );
 
 on_error:
-#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
-	lzma_end(
-	 &lzma_compressed_stream );
-#endif
 	return( -1 );
 }
 
@@ -25,13 +25,49 @@
 #include <common.h>
 #include <types.h>
 
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+#include <lzma.h>
+#endif
+
+#include "libmodi_bzip.h"
+#include "libmodi_deflate.h"
 #include "libmodi_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libmodi_decompression_context libmodi_decompression_context_t;
+
+struct libmodi_decompression_context
+{
+	/* The BZIP2 context
+	 */
+	libmodi_bzip_context_t *bzip_context;
+
+	/* The deflate context
+	 */
+	libmodi_deflate_context_t *deflate_context;
+
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+	/* The LZMA stream
+	 * Re-initializing the stream for every chunk reuses the decoder
+	 * allocations of liblzma, such as the dictionary
+	 */
+	lzma_stream lzma_stream;
+#endif
+};
+
+int libmodi_decompression_context_initialize(
+     libmodi_decompression_context_t **context,
+     libcerror_error_t **error );
+
+int libmodi_decompression_context_free(
+     libmodi_decompression_context_t **context,
+     libcerror_error_t **error );
+
 int libmodi_decompress_data(
+     libmodi_decompression_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      int compression_method,
@@ -31,7 +31,9 @@
 #include "libmodi_libbfio.h"
 #include "libmodi_libcerror.h"
 #include "libmodi_libcnotify.h"
+#include "libmodi_libfcache.h"
 #include "libmodi_libfdata.h"
+#include "libmodi_statistics.h"
 #include "libmodi_unused.h"
 
 /* Creates a data block
@@ -314,6 +316,10 @@ int libmodi_data_block_read_list_element_data(
 	size_t uncompressed_data_size    = 0;
 	ssize_t read_count               = 0;
 
+#if defined( HAVE_STATISTICS )
+	uint64_t start_time              = 0;
+#endif
+
 	LIBMODI_UNREFERENCED_PARAMETER( element_data_file_index )
 	LIBMODI_UNREFERENCED_PARAMETER( read_flags )
 
@@ -383,6 +389,10 @@ int libmodi_data_block_read_list_element_data(
 
 		goto on_error;
 	}
+	LIBMODI_STATISTICS_ADD(
+	 io_handle->statistics.number_of_cache_misses,
+	 1 );
+
 	if( ( element_data_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
 	{
 		if( memory_set(
@@ -399,6 +409,9 @@ int libmodi_data_block_read_list_element_data(
 
 			goto on_error;
 		}
+		LIBMODI_STATISTICS_ADD(
+		 io_handle->statistics.number_of_sparse_bytes,
+		 data_block->data_size );
 	}
 	else if( ( element_data_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
 	{
@@ -426,6 +439,9 @@ int libmodi_data_block_read_list_element_data(
 
 			goto on_error;
 		}
+		LIBMODI_STATISTICS_SET_START_TIME(
+		 start_time );
+
 		read_count = libbfio_handle_read_buffer_at_offset(
 		              file_io_handle,
 		              compressed_data,
@@ -433,6 +449,10 @@ int libmodi_data_block_read_list_element_data(
 		              element_data_offset,
 		              error );
 
+		LIBMODI_STATISTICS_ADD_ELAPSED_TIME(
+		 io_handle->statistics.io_time,
+		 start_time );
+
 		if( read_count != (ssize_t) element_data_size )
 		{
 			libcerror_error_set(
@@ -446,9 +466,33 @@ int libmodi_data_block_read_list_element_data(
 
 			goto on_error;
 		}
+		LIBMODI_STATISTICS_ADD(
+		 io_handle->statistics.number_of_bytes_read_from_storage,
+		 read_count );
+
 		uncompressed_data_size = data_block->data_size;
 
+		if( io_handle->decompression_context == NULL )
+		{
+			if( libmodi_decompression_context_initialize(
+			     &( io_handle->decompression_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create decompression context.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		LIBMODI_STATISTICS_SET_START_TIME(
+		 start_time );
+
 		if( libmodi_decompress_data(
+		     io_handle->decompression_context,
 		     compressed_data,
 		     (size_t) read_count,
 		     io_handle->compression_method,
@@ -467,6 +511,17 @@ int libmodi_data_block_read_list_element_data(
 
 			goto on_error;
 		}
+		if( ( io_handle->compression_method >= 0 )
+		 && ( io_handle->compression_method < LIBMODI_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ) )
+		{
+			LIBMODI_STATISTICS_ADD_ELAPSED_TIME(
+			 io_handle->statistics.decompression_time[ io_handle->compression_method ],
+			 start_time );
+
+			LIBMODI_STATISTICS_ADD(
+			 io_handle->statistics.number_of_decompressed_chunks[ io_handle->compression_method ],
+			 1 );
+		}
 		memory_free(
 		 compressed_data );
 
@@ -474,6 +529,9 @@ int libmodi_data_block_read_list_element_data(
 	}
 	else
 	{
+		LIBMODI_STATISTICS_SET_START_TIME(
+		 start_time );
+
 		if( libmodi_data_block_read_file_io_handle(
 		     data_block,
 		     file_io_handle,
@@ -491,6 +549,13 @@ int libmodi_data_block_read_list_element_data(
 
 			goto on_error;
 		}
+		LIBMODI_STATISTICS_ADD_ELAPSED_TIME(
+		 io_handle->statistics.io_time,
+		 start_time );
+
+		LIBMODI_STATISTICS_ADD(
+		 io_handle->statistics.number_of_bytes_read_from_storage,
+		 data_block->data_size );
 	}
 	if( libfdata_list_element_set_element_value(
 	     element,
@@ -510,6 +575,8 @@ int libmodi_data_block_read_list_element_data(
 
 		goto on_error;
 	}
+	data_block = NULL;
+
 	return( 1 );
 
 on_error:
@@ -547,6 +614,13 @@ int libmodi_data_block_read_vector_element_data(
 	libbfio_handle_t *bfio_handle    = NULL;
 	libmodi_data_block_t *data_block = NULL;
 	static char *function            = "libmodi_data_block_read_vector_element_data";
+	size64_t file_size               = 0;
+	size_t read_size                 = 0;
+	ssize_t read_count               = 0;
+
+#if defined( HAVE_STATISTICS )
+	uint64_t start_time              = 0;
+#endif
 
 	LIBMODI_UNREFERENCED_PARAMETER( read_flags );
 
@@ -599,6 +673,10 @@ int libmodi_data_block_read_vector_element_data(
 
 		goto on_error;
 	}
+	LIBMODI_STATISTICS_ADD(
+	 io_handle->statistics.number_of_cache_misses,
+	 1 );
+
 	if( ( element_data_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
 	{
 		if( memory_set(
@@ -615,6 +693,9 @@ int libmodi_data_block_read_vector_element_data(
 
 			goto on_error;
 		}
+		LIBMODI_STATISTICS_ADD(
+		 io_handle->statistics.number_of_sparse_bytes,
+		 data_block->data_size );
 	}
 	else
 	{
@@ -638,22 +719,94 @@ int libmodi_data_block_read_vector_element_data(
 
 			goto on_error;
 		}
-		if( libmodi_data_block_read_file_io_handle(
-		     data_block,
-		     bfio_handle,
-		     element_data_offset,
-		     error ) != 1 )
+		if( io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 element_data_offset,
-			 element_data_offset );
-
-			goto on_error;
+			/* A band data file that does not exist or data beyond the end
+			 * of a band data file is sparse
+			 */
+			if( bfio_handle != NULL )
+			{
+				if( libbfio_handle_get_size(
+				     bfio_handle,
+				     &file_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve band data file: %d size.",
+					 function,
+					 element_data_file_index );
+
+					goto on_error;
+				}
+				if( (size64_t) element_data_offset < file_size )
+				{
+					read_size = file_size - element_data_offset;
+				}
+			}
+			if( read_size > data_block->data_size )
+			{
+				read_size = data_block->data_size;
+			}
+			if( read_size < data_block->data_size )
+			{
+				if( memory_set(
+				     &( data_block->data[ read_size ] ),
+				     0,
+				     data_block->data_size - read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear data block.",
+					 function );
+
+					goto on_error;
+				}
+				LIBMODI_STATISTICS_ADD(
+				 io_handle->statistics.number_of_sparse_bytes,
+				 data_block->data_size - read_size );
+			}
+		}
+		else
+		{
+			read_size = data_block->data_size;
+		}
+		if( read_size > 0 )
+		{
+			LIBMODI_STATISTICS_SET_START_TIME(
+			 start_time );
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              bfio_handle,
+			              data_block->data,
+			              read_size,
+			              element_data_offset,
+			              error );
+
+			LIBMODI_STATISTICS_ADD_ELAPSED_TIME(
+			 io_handle->statistics.io_time,
+			 start_time );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 element_data_offset,
+				 element_data_offset );
+
+				goto on_error;
+			}
+			LIBMODI_STATISTICS_ADD(
+			 io_handle->statistics.number_of_bytes_read_from_storage,
+			 read_count );
 		}
 	}
 	if( libfdata_vector_set_element_value_by_index(
@@ -675,6 +828,8 @@ int libmodi_data_block_read_vector_element_data(
 
 		goto on_error;
 	}
+	data_block = NULL;
+
 	return( 1 );
 
 on_error:
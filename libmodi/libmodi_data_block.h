@@ -45,6 +45,10 @@ struct libmodi_data_block
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* Value to indicate the data block was retrieved from the cache before
+	 */
+	uint8_t is_cached;
 };
 
 int libmodi_data_block_initialize(
@@ -29,6 +29,11 @@
 #include "libmodi_huffman_tree.h"
 #include "libmodi_libcerror.h"
 #include "libmodi_libcnotify.h"
+#include "libmodi_unused.h"
+
+#if defined( LIBMODI_DEFLATE_HAVE_X86_SIMD )
+#include <immintrin.h>
+#endif
 
 const uint8_t libmodi_deflate_code_sizes_sequence[ 19 ]  = {
 	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
@@ -51,27 +56,267 @@ const uint16_t libmodi_deflate_distance_codes_number_of_extra_bits[ 30 ] = {
 	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
 	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
 
+/* The fixed Huffman trees
+ * These are built once on first use by libmodi_deflate_get_fixed_huffman_trees
+ * and are shared by all decoders, hence they must not be modified
+ */
+uint16_t libmodi_deflate_fixed_huffman_literals_tree_symbols[ 288 ];
+
+int libmodi_deflate_fixed_huffman_literals_tree_code_size_counts[ 16 ];
+
+uint16_t libmodi_deflate_fixed_huffman_distances_tree_symbols[ 30 ];
+
+int libmodi_deflate_fixed_huffman_distances_tree_code_size_counts[ 16 ];
+
+libmodi_huffman_tree_t libmodi_deflate_fixed_huffman_literals_tree = {
+	15,
+	libmodi_deflate_fixed_huffman_literals_tree_symbols,
+	libmodi_deflate_fixed_huffman_literals_tree_code_size_counts,
+	0,
+	{ 0 } };
+
+libmodi_huffman_tree_t libmodi_deflate_fixed_huffman_distances_tree = {
+	15,
+	libmodi_deflate_fixed_huffman_distances_tree_symbols,
+	libmodi_deflate_fixed_huffman_distances_tree_code_size_counts,
+	0,
+	{ 0 } };
+
+/* Value to indicate the fixed Huffman trees were built, which is 1 if successful,
+ * -1 on error or 0 if not built yet
+ */
+int libmodi_deflate_fixed_huffman_trees_result = 0;
+
+#if defined( LIBMODI_DEFLATE_HAVE_PTHREAD_ONCE )
+pthread_once_t libmodi_deflate_fixed_huffman_trees_once = PTHREAD_ONCE_INIT;
+
+#elif defined( LIBMODI_DEFLATE_HAVE_WINAPI_INIT_ONCE )
+INIT_ONCE libmodi_deflate_fixed_huffman_trees_once = INIT_ONCE_STATIC_INIT;
+
+#endif
+
+/* Creates a deflate context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_deflate_context_initialize(
+     libmodi_deflate_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_deflate_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            libmodi_deflate_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( libmodi_deflate_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
+	}
+	if( libmodi_huffman_tree_initialize(
+	     &( ( *context )->codes_tree ),
+	     19,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create codes tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmodi_huffman_tree_initialize(
+	     &( ( *context )->literals_tree ),
+	     288,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create literals tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmodi_huffman_tree_initialize(
+	     &( ( *context )->distances_tree ),
+	     30,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create distances tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		libmodi_deflate_context_free(
+		 context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a deflate context
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_deflate_context_free(
+     libmodi_deflate_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_deflate_context_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( ( *context )->distances_tree != NULL )
+		{
+			if( libmodi_huffman_tree_free(
+			     &( ( *context )->distances_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free distances tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *context )->literals_tree != NULL )
+		{
+			if( libmodi_huffman_tree_free(
+			     &( ( *context )->literals_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free literals tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *context )->codes_tree != NULL )
+		{
+			if( libmodi_huffman_tree_free(
+			     &( ( *context )->codes_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free codes tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
 /* Initializes the dynamic Huffman trees
  * Returns 1 on success or -1 on error
  */
 int libmodi_deflate_build_dynamic_huffman_trees(
      libmodi_bit_stream_t *bit_stream,
+     libmodi_huffman_tree_t *codes_tree,
      libmodi_huffman_tree_t *literals_tree,
      libmodi_huffman_tree_t *distances_tree,
      libcerror_error_t **error )
 {
 	uint8_t code_size_array[ 316 ];
 
-	libmodi_huffman_tree_t *codes_tree = NULL;
-	static char *function              = "libmodi_deflate_build_dynamic_huffman_trees";
-	uint32_t code_size                 = 0;
-	uint32_t code_size_index           = 0;
-	uint32_t code_size_sequence        = 0;
-	uint32_t number_of_code_sizes      = 0;
-	uint32_t number_of_distance_codes  = 0;
-	uint32_t number_of_literal_codes   = 0;
-	uint32_t times_to_repeat           = 0;
-	uint16_t symbol                    = 0;
+	static char *function             = "libmodi_deflate_build_dynamic_huffman_trees";
+	uint32_t code_size                = 0;
+	uint32_t code_size_index          = 0;
+	uint32_t code_size_sequence       = 0;
+	uint32_t number_of_code_sizes     = 0;
+	uint32_t number_of_distance_codes = 0;
+	uint32_t number_of_literal_codes  = 0;
+	uint32_t times_to_repeat          = 0;
+	uint16_t symbol                   = 0;
 
 	if( libmodi_bit_stream_get_value(
 	     bit_stream,
@@ -86,7 +331,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 		 "%s: unable to retrieve value from bit stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_literal_codes  = number_of_code_sizes & 0x0000001fUL;
 	number_of_code_sizes   >>= 5;
@@ -104,7 +349,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 		 "%s: invalid number of literal codes value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_distance_codes += 1;
 
@@ -117,7 +362,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 		 "%s: invalid number of distance codes value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_code_sizes += 4;
 
@@ -138,7 +383,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 			 "%s: unable to retrieve value from bit stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		code_size_sequence = libmodi_deflate_code_sizes_sequence[ code_size_index ];
 
@@ -150,25 +395,11 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 
 		code_size_array[ code_size_sequence ] = 0;
 	}
-	if( libmodi_huffman_tree_initialize(
-	     &codes_tree,
-	     19,
-	     15,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build codes tree.",
-		 function );
-
-		goto on_error;
-	}
 	if( libmodi_huffman_tree_build(
 	     codes_tree,
 	     code_size_array,
 	     19,
+	     LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -178,7 +409,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build codes tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_code_sizes = number_of_literal_codes + number_of_distance_codes;
 
@@ -199,7 +430,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 			 "%s: unable to retrieve literal value from bit stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( symbol < 16 )
 		{
@@ -220,7 +451,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 				 "%s: invalid code size index value out of bounds.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			code_size = (uint32_t) code_size_array[ code_size_index - 1 ];
 
@@ -237,7 +468,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 3;
 		}
@@ -256,7 +487,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 3;
 		}
@@ -275,7 +506,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 11;
 		}
@@ -288,7 +519,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 			 "%s: invalid code value value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( ( code_size_index + times_to_repeat ) > number_of_code_sizes )
 		{
@@ -299,7 +530,7 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 			 "%s: invalid times to repeat value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		while( times_to_repeat > 0 )
 		{
@@ -317,25 +548,13 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 		 "%s: end-of-block code value missing in literal codes array.",
 		 function );
 
-		goto on_error;
-	}
-	if( libmodi_huffman_tree_free(
-	     &codes_tree,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free codes tree.",
-		 function );
-
-		goto on_error;
+		return( -1 );
 	}
 	if( libmodi_huffman_tree_build(
 	     literals_tree,
 	     code_size_array,
 	     number_of_literal_codes,
+	     LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -345,12 +564,13 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build literals tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libmodi_huffman_tree_build(
 	     distances_tree,
 	     &( code_size_array[ number_of_literal_codes ] ),
 	     number_of_distance_codes,
+	     LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -360,18 +580,9 @@ int libmodi_deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build distances tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( codes_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &codes_tree,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Initializes the fixed Huffman trees
@@ -412,36 +623,176 @@ int libmodi_deflate_build_fixed_huffman_trees(
 			code_size_array[ symbol ] = 5;
 		}
 	}
-	if( libmodi_huffman_tree_build(
-	     literals_tree,
-	     code_size_array,
-	     288,
-	     error ) != 1 )
+	if( libmodi_huffman_tree_build(
+	     literals_tree,
+	     code_size_array,
+	     288,
+	     LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literals tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmodi_huffman_tree_build(
+	     distances_tree,
+	     &( code_size_array[ 288 ] ),
+	     30,
+	     LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distances tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the fixed Huffman trees that are shared by all decoders
+ * This function is called once by libmodi_deflate_get_fixed_huffman_trees
+ */
+void libmodi_deflate_initialize_fixed_huffman_trees(
+      void )
+{
+	libcerror_error_t *error = NULL;
+
+	if( libmodi_deflate_build_fixed_huffman_trees(
+	     &libmodi_deflate_fixed_huffman_literals_tree,
+	     &libmodi_deflate_fixed_huffman_distances_tree,
+	     &error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		libmodi_deflate_fixed_huffman_trees_result = -1;
+	}
+	else
+	{
+		libmodi_deflate_fixed_huffman_trees_result = 1;
+	}
+}
+
+#if defined( LIBMODI_DEFLATE_HAVE_WINAPI_INIT_ONCE )
+
+/* Callback function for InitOnceExecuteOnce to build the fixed Huffman trees
+ * Returns TRUE
+ */
+BOOL CALLBACK libmodi_deflate_initialize_fixed_huffman_trees_callback(
+               PINIT_ONCE init_once,
+               PVOID parameter,
+               PVOID *context )
+{
+	LIBMODI_UNREFERENCED_PARAMETER( init_once )
+	LIBMODI_UNREFERENCED_PARAMETER( parameter )
+	LIBMODI_UNREFERENCED_PARAMETER( context )
+
+	libmodi_deflate_initialize_fixed_huffman_trees();
+
+	return( TRUE );
+}
+
+#endif /* defined( LIBMODI_DEFLATE_HAVE_WINAPI_INIT_ONCE ) */
+
+/* Retrieves the fixed Huffman trees
+ * The trees are built once on first use and must not be modified
+ * Returns 1 on success or -1 on error
+ */
+int libmodi_deflate_get_fixed_huffman_trees(
+     const libmodi_huffman_tree_t **literals_tree,
+     const libmodi_huffman_tree_t **distances_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_deflate_get_fixed_huffman_trees";
+
+	if( literals_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( distances_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBMODI_DEFLATE_HAVE_PTHREAD_ONCE )
+	if( pthread_once(
+	     &libmodi_deflate_fixed_huffman_trees_once,
+	     &libmodi_deflate_initialize_fixed_huffman_trees ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build literals tree.",
+		 "%s: unable to build fixed Huffman trees once.",
 		 function );
 
 		return( -1 );
 	}
-	if( libmodi_huffman_tree_build(
-	     distances_tree,
-	     &( code_size_array[ 288 ] ),
-	     30,
-	     error ) != 1 )
+#elif defined( LIBMODI_DEFLATE_HAVE_WINAPI_INIT_ONCE )
+	if( InitOnceExecuteOnce(
+	     &libmodi_deflate_fixed_huffman_trees_once,
+	     &libmodi_deflate_initialize_fixed_huffman_trees_callback,
+	     NULL,
+	     NULL ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build distances tree.",
+		 "%s: unable to build fixed Huffman trees once.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( libmodi_deflate_fixed_huffman_trees_result == 0 )
+	{
+		libmodi_deflate_initialize_fixed_huffman_trees();
+	}
+#endif
+	if( libmodi_deflate_fixed_huffman_trees_result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build fixed Huffman trees.",
 		 function );
 
 		return( -1 );
 	}
+	*literals_tree  = &libmodi_deflate_fixed_huffman_literals_tree;
+	*distances_tree = &libmodi_deflate_fixed_huffman_distances_tree;
+
 	return( 1 );
 }
 
@@ -450,20 +801,25 @@ int libmodi_deflate_build_fixed_huffman_trees(
  */
 int libmodi_deflate_decode_huffman(
      libmodi_bit_stream_t *bit_stream,
-     libmodi_huffman_tree_t *literals_tree,
-     libmodi_huffman_tree_t *distances_tree,
+     const libmodi_huffman_tree_t *literals_tree,
+     const libmodi_huffman_tree_t *distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
 	static char *function         = "libmodi_deflate_decode_huffman";
+	uint8_t *match_data           = NULL;
+	uint8_t *match_data_end       = NULL;
+	size_t copy_size              = 0;
 	size_t data_offset            = 0;
 	uint32_t extra_bits           = 0;
 	uint16_t compression_offset   = 0;
 	uint16_t compression_size     = 0;
+	uint16_t lookup_value         = 0;
 	uint16_t number_of_extra_bits = 0;
 	uint16_t symbol               = 0;
+	uint8_t code_size             = 0;
 
 	if( uncompressed_data == NULL )
 	{
@@ -498,15 +854,81 @@ int libmodi_deflate_decode_huffman(
 
 		return( -1 );
 	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->storage_type != LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bit stream storage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( literals_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( distances_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances tree.",
+		 function );
+
+		return( -1 );
+	}
 	data_offset = *uncompressed_data_offset;
 
 	do
 	{
-		if( libmodi_huffman_tree_get_symbol_from_bit_stream(
-		     literals_tree,
-		     bit_stream,
-		     &symbol,
-		     error ) != 1 )
+		/* After a refill the bit buffer contains at least 56 bits, unless
+		 * the end of the byte stream is reached, which is sufficient for
+		 * a literal code or a length and distance code pair including
+		 * their extra bits. Codes that are not fully available in the bit
+		 * buffer or larger than the lookup table are decoded by the Huffman
+		 * tree functions.
+		 */
+		LIBMODI_BIT_STREAM_REFILL_BACK_TO_FRONT(
+		 bit_stream );
+
+		lookup_value = literals_tree->lookup_table[ LIBMODI_BIT_STREAM_PEEK_BACK_TO_FRONT( bit_stream, LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS ) ];
+		code_size    = (uint8_t) ( lookup_value & 0x000f );
+
+		if( ( lookup_value != 0 )
+		 && ( code_size <= bit_stream->bit_buffer_size ) )
+		{
+			symbol = lookup_value >> 4;
+
+			LIBMODI_BIT_STREAM_CONSUME_BACK_TO_FRONT(
+			 bit_stream,
+			 code_size );
+		}
+		else if( libmodi_huffman_tree_get_symbol_from_bit_stream(
+		          literals_tree,
+		          bit_stream,
+		          &symbol,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -539,11 +961,21 @@ int libmodi_deflate_decode_huffman(
 
 			number_of_extra_bits = libmodi_deflate_literal_codes_number_of_extra_bits[ symbol ];
 
-			if( libmodi_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			if( number_of_extra_bits <= bit_stream->bit_buffer_size )
+			{
+				extra_bits = (uint32_t) LIBMODI_BIT_STREAM_PEEK_BACK_TO_FRONT(
+				                         bit_stream,
+				                         number_of_extra_bits );
+
+				LIBMODI_BIT_STREAM_CONSUME_BACK_TO_FRONT(
+				 bit_stream,
+				 number_of_extra_bits );
+			}
+			else if( libmodi_bit_stream_get_value(
+			          bit_stream,
+			          (uint8_t) number_of_extra_bits,
+			          &extra_bits,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -556,11 +988,23 @@ int libmodi_deflate_decode_huffman(
 			}
 			compression_size = libmodi_deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
 
-			if( libmodi_huffman_tree_get_symbol_from_bit_stream(
-			     distances_tree,
-			     bit_stream,
-			     &symbol,
-			     error ) != 1 )
+			lookup_value = distances_tree->lookup_table[ LIBMODI_BIT_STREAM_PEEK_BACK_TO_FRONT( bit_stream, LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS ) ];
+			code_size    = (uint8_t) ( lookup_value & 0x000f );
+
+			if( ( lookup_value != 0 )
+			 && ( code_size <= bit_stream->bit_buffer_size ) )
+			{
+				symbol = lookup_value >> 4;
+
+				LIBMODI_BIT_STREAM_CONSUME_BACK_TO_FRONT(
+				 bit_stream,
+				 code_size );
+			}
+			else if( libmodi_huffman_tree_get_symbol_from_bit_stream(
+			          distances_tree,
+			          bit_stream,
+			          &symbol,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -571,13 +1015,35 @@ int libmodi_deflate_decode_huffman(
 
 				return( -1 );
 			}
+			if( symbol >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance code value: %" PRIu16 " out of bounds.",
+				 function,
+				 symbol );
+
+				return( -1 );
+			}
 			number_of_extra_bits = libmodi_deflate_distance_codes_number_of_extra_bits[ symbol ];
 
-			if( libmodi_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			if( number_of_extra_bits <= bit_stream->bit_buffer_size )
+			{
+				extra_bits = (uint32_t) LIBMODI_BIT_STREAM_PEEK_BACK_TO_FRONT(
+				                         bit_stream,
+				                         number_of_extra_bits );
+
+				LIBMODI_BIT_STREAM_CONSUME_BACK_TO_FRONT(
+				 bit_stream,
+				 number_of_extra_bits );
+			}
+			else if( libmodi_bit_stream_get_value(
+			          bit_stream,
+			          (uint8_t) number_of_extra_bits,
+			          &extra_bits,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -612,13 +1078,57 @@ int libmodi_deflate_decode_huffman(
 
 				return( -1 );
 			}
-			while( compression_size > 0 )
+			match_data     = &( uncompressed_data[ data_offset ] );
+			match_data_end = &( match_data[ compression_size ] );
+
+			if( ( compression_offset >= 8 )
+			 && ( ( uncompressed_data_size - data_offset ) >= ( (size_t) compression_size + 8 ) ) )
+			{
+				/* The distance is at least 8 bytes hence every 8-byte word that is copied
+				 * has been fully written before. The last word can exceed the match by up
+				 * to 7 bytes, which is allowed since there is sufficient output slack and
+				 * the bytes are overwritten by subsequent output.
+				 */
+				while( match_data < match_data_end )
+				{
+					memory_copy(
+					 match_data,
+					 &( match_data[ -( (ssize_t) compression_offset ) ] ),
+					 8 );
+
+					match_data += 8;
+				}
+			}
+			else if( compression_offset == 1 )
+			{
+				memory_set(
+				 match_data,
+				 match_data[ -1 ],
+				 (size_t) compression_size );
+			}
+			else
 			{
-				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+				/* Expand the repeating pattern by copying the match data written so far,
+				 * which doubles the size of the pattern with every copy
+				 */
+				copy_size = (size_t) compression_offset;
 
-				data_offset++;
-				compression_size--;
+				while( match_data < match_data_end )
+				{
+					if( copy_size > (size_t) ( match_data_end - match_data ) )
+					{
+						copy_size = (size_t) ( match_data_end - match_data );
+					}
+					memory_copy(
+					 match_data,
+					 &( uncompressed_data[ data_offset - compression_offset ] ),
+					 copy_size );
+
+					match_data += copy_size;
+					copy_size   = (size_t) ( match_data - &( uncompressed_data[ data_offset - compression_offset ] ) );
+				}
 			}
+			data_offset += compression_size;
 		}
 		else if( symbol != 256 )
 		{
@@ -642,6 +1152,7 @@ int libmodi_deflate_decode_huffman(
 
 /* Calculates the little-endian Adler-32 of a buffer
  * It uses the initial value to calculate a new Adler-32
+ * Whole 32-byte blocks are processed by the vectorized function supported by the CPU, if any
  * Returns 1 if successful or -1 on error
  */
 int libmodi_deflate_calculate_adler32(
@@ -651,7 +1162,116 @@ int libmodi_deflate_calculate_adler32(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	static char *function = "libmodi_deflate_calculate_adler32";
+	static char *function   = "libmodi_deflate_calculate_adler32";
+	size_t data_offset      = 0;
+	size_t number_of_blocks = 0;
+	uint32_t lower_word     = 0;
+	uint32_t upper_word     = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	lower_word = initial_value & 0xffff;
+	upper_word = ( initial_value >> 16 ) & 0xffff;
+
+	number_of_blocks = data_size / 32;
+
+#if defined( LIBMODI_DEFLATE_HAVE_X86_SIMD )
+	if( number_of_blocks > 0 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			libmodi_deflate_calculate_adler32_avx2(
+			 &lower_word,
+			 &upper_word,
+			 data,
+			 number_of_blocks );
+		}
+		else if( __builtin_cpu_supports( "ssse3" ) )
+		{
+			libmodi_deflate_calculate_adler32_ssse3(
+			 &lower_word,
+			 &upper_word,
+			 data,
+			 number_of_blocks );
+		}
+		else if( __builtin_cpu_supports( "sse2" ) )
+		{
+			libmodi_deflate_calculate_adler32_sse2(
+			 &lower_word,
+			 &upper_word,
+			 data,
+			 number_of_blocks );
+		}
+		else
+		{
+			number_of_blocks = 0;
+		}
+		data_offset = number_of_blocks * 32;
+	}
+#endif /* defined( LIBMODI_DEFLATE_HAVE_X86_SIMD ) */
+
+	if( libmodi_deflate_calculate_adler32_scalar(
+	     checksum_value,
+	     &( data[ data_offset ] ),
+	     data_size - data_offset,
+	     ( upper_word << 16 ) | lower_word,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate Adler-32 of remaining data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the little-endian Adler-32 of a buffer one byte at a time
+ * It uses the initial value to calculate a new Adler-32
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_deflate_calculate_adler32_scalar(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_deflate_calculate_adler32_scalar";
 	size_t data_offset    = 0;
 	uint32_t lower_word   = 0;
 	uint32_t upper_word   = 0;
@@ -863,31 +1483,258 @@ int libmodi_deflate_calculate_adler32(
 		}
 		if( lower_word >= 65521 )
 		{
-			lower_word -= 65521;
+			lower_word -= 65521;
+		}
+		/* Optimized equivalent of:
+		 * upper_word %= 0xfff1
+		 */
+		value_32bit = upper_word >> 16;
+		upper_word &= 0x0000ffffUL;
+		upper_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( upper_word > 65521 )
+		{
+			value_32bit = upper_word >> 16;
+			upper_word &= 0x0000ffffUL;
+			upper_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( upper_word >= 65521 )
+		{
+			upper_word -= 65521;
+		}
+	}
+	*checksum_value = ( upper_word << 16 ) | lower_word;
+
+	return( 1 );
+}
+
+#if defined( LIBMODI_DEFLATE_HAVE_X86_SIMD )
+
+/* The vectorized Adler-32 functions process blocks of 32 bytes
+ * The modulo calculation is needed per 5552 bytes, which is 173 blocks
+ *
+ * For every block the lower word of the previous block is accumulated
+ * into a partial sum that contributes 32 times to the upper word and
+ * the bytes are weighted 32 to 1 according to their position in the block
+ */
+#define LIBMODI_DEFLATE_ADLER32_MAXIMUM_NUMBER_OF_BLOCKS	173
+
+/* Calculates the Adler-32 of 32-byte blocks using SSE2
+ * The lower and upper words are updated and reduced modulo 65521
+ */
+__attribute__((target("sse2")))
+void libmodi_deflate_calculate_adler32_sse2(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *data,
+      size_t number_of_blocks )
+{
+	__m128i bytes1;
+	__m128i bytes2;
+	__m128i lower_sum;
+	__m128i partial_sum;
+	__m128i upper_sum;
+
+	const __m128i weights1 = _mm_setr_epi16( 32, 31, 30, 29, 28, 27, 26, 25 );
+	const __m128i weights2 = _mm_setr_epi16( 24, 23, 22, 21, 20, 19, 18, 17 );
+	const __m128i weights3 = _mm_setr_epi16( 16, 15, 14, 13, 12, 11, 10, 9 );
+	const __m128i weights4 = _mm_setr_epi16( 8, 7, 6, 5, 4, 3, 2, 1 );
+	const __m128i zero     = _mm_setzero_si128();
+
+	uint32_t safe_lower_word = *lower_word;
+	uint32_t safe_upper_word = *upper_word;
+	size_t block_index       = 0;
+	size_t blocks_in_chunk   = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		blocks_in_chunk = number_of_blocks;
+
+		if( blocks_in_chunk > LIBMODI_DEFLATE_ADLER32_MAXIMUM_NUMBER_OF_BLOCKS )
+		{
+			blocks_in_chunk = LIBMODI_DEFLATE_ADLER32_MAXIMUM_NUMBER_OF_BLOCKS;
+		}
+		number_of_blocks -= blocks_in_chunk;
+
+		lower_sum   = zero;
+		partial_sum = _mm_cvtsi32_si128( (int) ( safe_lower_word * blocks_in_chunk ) );
+		upper_sum   = _mm_cvtsi32_si128( (int) safe_upper_word );
+
+		for( block_index = 0;
+		     block_index < blocks_in_chunk;
+		     block_index++ )
+		{
+			bytes1 = _mm_loadu_si128( (const __m128i *) data );
+			bytes2 = _mm_loadu_si128( (const __m128i *) &( data[ 16 ] ) );
+
+			partial_sum = _mm_add_epi32( partial_sum, lower_sum );
+
+			lower_sum = _mm_add_epi32( lower_sum, _mm_sad_epu8( bytes1, zero ) );
+			lower_sum = _mm_add_epi32( lower_sum, _mm_sad_epu8( bytes2, zero ) );
+
+			upper_sum = _mm_add_epi32( upper_sum, _mm_madd_epi16( _mm_unpacklo_epi8( bytes1, zero ), weights1 ) );
+			upper_sum = _mm_add_epi32( upper_sum, _mm_madd_epi16( _mm_unpackhi_epi8( bytes1, zero ), weights2 ) );
+			upper_sum = _mm_add_epi32( upper_sum, _mm_madd_epi16( _mm_unpacklo_epi8( bytes2, zero ), weights3 ) );
+			upper_sum = _mm_add_epi32( upper_sum, _mm_madd_epi16( _mm_unpackhi_epi8( bytes2, zero ), weights4 ) );
+
+			data += 32;
+		}
+		upper_sum = _mm_add_epi32( upper_sum, _mm_slli_epi32( partial_sum, 5 ) );
+
+		lower_sum = _mm_add_epi32( lower_sum, _mm_shuffle_epi32( lower_sum, 0x4e ) );
+		upper_sum = _mm_add_epi32( upper_sum, _mm_shuffle_epi32( upper_sum, 0xb1 ) );
+		upper_sum = _mm_add_epi32( upper_sum, _mm_shuffle_epi32( upper_sum, 0x4e ) );
+
+		safe_lower_word = ( safe_lower_word + (uint32_t) _mm_cvtsi128_si32( lower_sum ) ) % 65521;
+		safe_upper_word = (uint32_t) _mm_cvtsi128_si32( upper_sum ) % 65521;
+	}
+	*lower_word = safe_lower_word;
+	*upper_word = safe_upper_word;
+}
+
+/* Calculates the Adler-32 of 32-byte blocks using SSSE3
+ * The lower and upper words are updated and reduced modulo 65521
+ */
+__attribute__((target("ssse3")))
+void libmodi_deflate_calculate_adler32_ssse3(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *data,
+      size_t number_of_blocks )
+{
+	__m128i bytes1;
+	__m128i bytes2;
+	__m128i lower_sum;
+	__m128i partial_sum;
+	__m128i upper_sum;
+
+	const __m128i weights1 = _mm_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17 );
+	const __m128i weights2 = _mm_setr_epi8( 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+	const __m128i ones     = _mm_set1_epi16( 1 );
+	const __m128i zero     = _mm_setzero_si128();
+
+	uint32_t safe_lower_word = *lower_word;
+	uint32_t safe_upper_word = *upper_word;
+	size_t block_index       = 0;
+	size_t blocks_in_chunk   = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		blocks_in_chunk = number_of_blocks;
+
+		if( blocks_in_chunk > LIBMODI_DEFLATE_ADLER32_MAXIMUM_NUMBER_OF_BLOCKS )
+		{
+			blocks_in_chunk = LIBMODI_DEFLATE_ADLER32_MAXIMUM_NUMBER_OF_BLOCKS;
+		}
+		number_of_blocks -= blocks_in_chunk;
+
+		lower_sum   = zero;
+		partial_sum = _mm_cvtsi32_si128( (int) ( safe_lower_word * blocks_in_chunk ) );
+		upper_sum   = _mm_cvtsi32_si128( (int) safe_upper_word );
+
+		for( block_index = 0;
+		     block_index < blocks_in_chunk;
+		     block_index++ )
+		{
+			bytes1 = _mm_loadu_si128( (const __m128i *) data );
+			bytes2 = _mm_loadu_si128( (const __m128i *) &( data[ 16 ] ) );
+
+			partial_sum = _mm_add_epi32( partial_sum, lower_sum );
+
+			lower_sum = _mm_add_epi32( lower_sum, _mm_sad_epu8( bytes1, zero ) );
+			lower_sum = _mm_add_epi32( lower_sum, _mm_sad_epu8( bytes2, zero ) );
+
+			upper_sum = _mm_add_epi32( upper_sum, _mm_madd_epi16( _mm_maddubs_epi16( bytes1, weights1 ), ones ) );
+			upper_sum = _mm_add_epi32( upper_sum, _mm_madd_epi16( _mm_maddubs_epi16( bytes2, weights2 ), ones ) );
+
+			data += 32;
 		}
-		/* Optimized equivalent of:
-		 * upper_word %= 0xfff1
-		 */
-		value_32bit = upper_word >> 16;
-		upper_word &= 0x0000ffffUL;
-		upper_word += ( value_32bit << 4 ) - value_32bit;
+		upper_sum = _mm_add_epi32( upper_sum, _mm_slli_epi32( partial_sum, 5 ) );
 
-		if( upper_word > 65521 )
+		lower_sum = _mm_add_epi32( lower_sum, _mm_shuffle_epi32( lower_sum, 0x4e ) );
+		upper_sum = _mm_add_epi32( upper_sum, _mm_shuffle_epi32( upper_sum, 0xb1 ) );
+		upper_sum = _mm_add_epi32( upper_sum, _mm_shuffle_epi32( upper_sum, 0x4e ) );
+
+		safe_lower_word = ( safe_lower_word + (uint32_t) _mm_cvtsi128_si32( lower_sum ) ) % 65521;
+		safe_upper_word = (uint32_t) _mm_cvtsi128_si32( upper_sum ) % 65521;
+	}
+	*lower_word = safe_lower_word;
+	*upper_word = safe_upper_word;
+}
+
+/* Calculates the Adler-32 of 32-byte blocks using AVX2
+ * The lower and upper words are updated and reduced modulo 65521
+ */
+__attribute__((target("avx2")))
+void libmodi_deflate_calculate_adler32_avx2(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *data,
+      size_t number_of_blocks )
+{
+	__m128i lower_sum_128bit;
+	__m128i upper_sum_128bit;
+	__m256i bytes;
+	__m256i lower_sum;
+	__m256i partial_sum;
+	__m256i upper_sum;
+
+	const __m256i weights = _mm256_setr_epi8(
+	                         32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+	                         16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+	const __m256i ones    = _mm256_set1_epi16( 1 );
+	const __m256i zero    = _mm256_setzero_si256();
+
+	uint32_t safe_lower_word = *lower_word;
+	uint32_t safe_upper_word = *upper_word;
+	size_t block_index       = 0;
+	size_t blocks_in_chunk   = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		blocks_in_chunk = number_of_blocks;
+
+		if( blocks_in_chunk > LIBMODI_DEFLATE_ADLER32_MAXIMUM_NUMBER_OF_BLOCKS )
 		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
+			blocks_in_chunk = LIBMODI_DEFLATE_ADLER32_MAXIMUM_NUMBER_OF_BLOCKS;
 		}
-		if( upper_word >= 65521 )
+		number_of_blocks -= blocks_in_chunk;
+
+		lower_sum   = zero;
+		partial_sum = _mm256_setr_epi32( (int) ( safe_lower_word * blocks_in_chunk ), 0, 0, 0, 0, 0, 0, 0 );
+		upper_sum   = _mm256_setr_epi32( (int) safe_upper_word, 0, 0, 0, 0, 0, 0, 0 );
+
+		for( block_index = 0;
+		     block_index < blocks_in_chunk;
+		     block_index++ )
 		{
-			upper_word -= 65521;
+			bytes = _mm256_loadu_si256( (const __m256i *) data );
+
+			partial_sum = _mm256_add_epi32( partial_sum, lower_sum );
+
+			lower_sum = _mm256_add_epi32( lower_sum, _mm256_sad_epu8( bytes, zero ) );
+			upper_sum = _mm256_add_epi32( upper_sum, _mm256_madd_epi16( _mm256_maddubs_epi16( bytes, weights ), ones ) );
+
+			data += 32;
 		}
-	}
-	*checksum_value = ( upper_word << 16 ) | lower_word;
+		upper_sum = _mm256_add_epi32( upper_sum, _mm256_slli_epi32( partial_sum, 5 ) );
 
-	return( 1 );
+		lower_sum_128bit = _mm_add_epi32( _mm256_castsi256_si128( lower_sum ), _mm256_extracti128_si256( lower_sum, 1 ) );
+		upper_sum_128bit = _mm_add_epi32( _mm256_castsi256_si128( upper_sum ), _mm256_extracti128_si256( upper_sum, 1 ) );
+
+		lower_sum_128bit = _mm_add_epi32( lower_sum_128bit, _mm_shuffle_epi32( lower_sum_128bit, 0x4e ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0xb1 ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0x4e ) );
+
+		safe_lower_word = ( safe_lower_word + (uint32_t) _mm_cvtsi128_si32( lower_sum_128bit ) ) % 65521;
+		safe_upper_word = (uint32_t) _mm_cvtsi128_si32( upper_sum_128bit ) % 65521;
+	}
+	*lower_word = safe_lower_word;
+	*upper_word = safe_upper_word;
 }
 
+#endif /* defined( LIBMODI_DEFLATE_HAVE_X86_SIMD ) */
+
 /* Reads the compressed data header
  * Returns 1 on success or -1 on error
  */
@@ -1121,24 +1968,34 @@ int libmodi_deflate_read_block_header(
  * Returns 1 on success or -1 on error
  */
 int libmodi_deflate_read_block(
+     libmodi_deflate_context_t *context,
      libmodi_bit_stream_t *bit_stream,
      uint8_t block_type,
-     libmodi_huffman_tree_t *fixed_huffman_literals_tree,
-     libmodi_huffman_tree_t *fixed_huffman_distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	libmodi_huffman_tree_t *dynamic_huffman_distances_tree = NULL;
-	libmodi_huffman_tree_t *dynamic_huffman_literals_tree  = NULL;
-	static char *function                                  = "libmodi_deflate_read_block";
-	size_t safe_uncompressed_data_offset                   = 0;
-	uint32_t block_size                                    = 0;
-	uint32_t block_size_copy                               = 0;
-	uint32_t value_32bit                                   = 0;
-	uint8_t skip_bits                                      = 0;
+	const libmodi_huffman_tree_t *fixed_distances_tree = NULL;
+	const libmodi_huffman_tree_t *fixed_literals_tree  = NULL;
+	static char *function                              = "libmodi_deflate_read_block";
+	size_t safe_uncompressed_data_offset               = 0;
+	uint32_t block_size                                = 0;
+	uint32_t block_size_copy                           = 0;
+	uint32_t value_32bit                               = 0;
+	uint8_t skip_bits                                  = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
+		return( -1 );
+	}
 	if( bit_stream == NULL )
 	{
 		libcerror_error_set(
@@ -1207,7 +2064,7 @@ int libmodi_deflate_read_block(
 					 "%s: unable to retrieve value from bit stream.",
 					 function );
 
-					goto on_error;
+					return( -1 );
 				}
 			}
 			if( libmodi_bit_stream_get_value(
@@ -1223,8 +2080,15 @@ int libmodi_deflate_read_block(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
+			/* Return the remaining whole bytes in the bit buffer to the byte stream
+			 * since the uncompressed data is copied directly from the byte stream
+			 */
+			bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+			bit_stream->bit_buffer          = 0;
+			bit_stream->bit_buffer_size     = 0;
+
 			block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
 			block_size     &= 0x0000ffffUL;
 
@@ -1239,7 +2103,7 @@ int libmodi_deflate_read_block(
 				 block_size,
 				 block_size_copy );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( block_size == 0 )
 			{
@@ -1254,7 +2118,7 @@ int libmodi_deflate_read_block(
 				 "%s: invalid compressed data value too small.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( (size_t) block_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
 			{
@@ -1265,7 +2129,7 @@ int libmodi_deflate_read_block(
 				 "%s: invalid uncompressed data value too small.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( memory_copy(
 			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
@@ -1279,74 +2143,57 @@ int libmodi_deflate_read_block(
 				 "%s: unable to initialize lz buffer.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			bit_stream->byte_stream_offset += block_size;
 			safe_uncompressed_data_offset  += block_size;
 
-			/* Flush the bit stream buffer
-			 */
-			bit_stream->bit_buffer      = 0;
-			bit_stream->bit_buffer_size = 0;
-
 			break;
 
 		case LIBMODI_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
-			if( libmodi_deflate_decode_huffman(
-			     bit_stream,
-			     fixed_huffman_literals_tree,
-			     fixed_huffman_distances_tree,
-			     uncompressed_data,
-			     uncompressed_data_size,
-			     &safe_uncompressed_data_offset,
+			if( libmodi_deflate_get_fixed_huffman_trees(
+			     &fixed_literals_tree,
+			     &fixed_distances_tree,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to decode fixed Huffman encoded bit stream.",
+				 "%s: unable to retrieve fixed Huffman trees.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			break;
-
-		case LIBMODI_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
-			if( libmodi_huffman_tree_initialize(
-			     &dynamic_huffman_literals_tree,
-			     288,
-			     15,
+			if( libmodi_deflate_decode_huffman(
+			     bit_stream,
+			     fixed_literals_tree,
+			     fixed_distances_tree,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     &safe_uncompressed_data_offset,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to build dynamic literals Huffman tree.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode fixed Huffman encoded bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( libmodi_huffman_tree_initialize(
-			     &dynamic_huffman_distances_tree,
-			     30,
-			     15,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to build dynamic distances Huffman tree.",
-				 function );
+			break;
 
-				goto on_error;
-			}
+		case LIBMODI_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+			/* The dynamic Huffman trees are stored in the context
+			 * and are rebuilt for every block
+			 */
 			if( libmodi_deflate_build_dynamic_huffman_trees(
 			     bit_stream,
-			     dynamic_huffman_literals_tree,
-			     dynamic_huffman_distances_tree,
+			     context->codes_tree,
+			     context->literals_tree,
+			     context->distances_tree,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1356,12 +2203,12 @@ int libmodi_deflate_read_block(
 				 "%s: unable to build dynamic Huffman trees.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( libmodi_deflate_decode_huffman(
 			     bit_stream,
-			     dynamic_huffman_literals_tree,
-			     dynamic_huffman_distances_tree,
+			     context->literals_tree,
+			     context->distances_tree,
 			     uncompressed_data,
 			     uncompressed_data_size,
 			     &safe_uncompressed_data_offset,
@@ -1374,33 +2221,7 @@ int libmodi_deflate_read_block(
 				 "%s: unable to decode dynamic Huffman encoded bit stream.",
 				 function );
 
-				goto on_error;
-			}
-			if( libmodi_huffman_tree_free(
-			     &dynamic_huffman_distances_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic distances Huffman tree.",
-				 function );
-
-				goto on_error;
-			}
-			if( libmodi_huffman_tree_free(
-			     &dynamic_huffman_literals_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic literals Huffman tree.",
-				 function );
-
-				goto on_error;
+				return( -1 );
 			}
 			break;
 
@@ -1413,48 +2234,43 @@ int libmodi_deflate_read_block(
 			 "%s: unsupported block type.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 	}
 	*uncompressed_data_offset = safe_uncompressed_data_offset;
 
 	return( 1 );
-
-on_error:
-	if( dynamic_huffman_distances_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &dynamic_huffman_distances_tree,
-		 NULL );
-	}
-	if( dynamic_huffman_literals_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &dynamic_huffman_literals_tree,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Decompresses data using deflate compression
  * Returns 1 on success or -1 on error
  */
 int libmodi_deflate_decompress(
+     libmodi_deflate_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	libmodi_bit_stream_t *bit_stream                     = NULL;
-	libmodi_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	libmodi_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                                = "libmodi_deflate_decompress";
-	size_t compressed_data_offset                        = 0;
-	size_t safe_uncompressed_data_size                   = 0;
-	size_t uncompressed_data_offset                      = 0;
-	uint8_t block_type                                   = 0;
-	uint8_t last_block_flag                              = 0;
+	libmodi_bit_stream_t *bit_stream   = NULL;
+	static char *function              = "libmodi_deflate_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -1540,7 +2356,8 @@ int libmodi_deflate_decompress(
 
 		goto on_error;
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
 	{
 		if( libmodi_deflate_read_block_header(
 		     bit_stream,
@@ -1557,62 +2374,10 @@ int libmodi_deflate_decompress(
 
 			goto on_error;
 		}
-		if( block_type == LIBMODI_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( libmodi_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libmodi_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libmodi_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
 		if( libmodi_deflate_read_block(
+		     context,
 		     bit_stream,
 		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
 		     uncompressed_data,
 		     safe_uncompressed_data_size,
 		     &uncompressed_data_offset,
@@ -1632,38 +2397,6 @@ int libmodi_deflate_decompress(
 			break;
 		}
 	}
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		if( libmodi_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		if( libmodi_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	if( libmodi_bit_stream_free(
 	     &bit_stream,
 	     error ) != 1 )
@@ -1682,18 +2415,6 @@ int libmodi_deflate_decompress(
 	return( 1 );
 
 on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libmodi_bit_stream_free(
@@ -1707,24 +2428,34 @@ on_error:
  * Returns 1 on success or -1 on error
  */
 int libmodi_deflate_decompress_zlib(
+     libmodi_deflate_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	libmodi_bit_stream_t *bit_stream                     = NULL;
-	libmodi_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	libmodi_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                                = "libmodi_deflate_decompress_zlib";
-	size_t compressed_data_offset                        = 0;
-	size_t safe_uncompressed_data_size                   = 0;
-	size_t uncompressed_data_offset                      = 0;
-	uint32_t calculated_checksum                         = 0;
-	uint32_t stored_checksum                             = 0;
-	uint8_t block_type                                   = 0;
-	uint8_t last_block_flag                              = 0;
+	libmodi_bit_stream_t *bit_stream   = NULL;
+	static char *function              = "libmodi_deflate_decompress_zlib";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t stored_checksum           = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -1825,7 +2556,8 @@ int libmodi_deflate_decompress_zlib(
 
 		goto on_error;
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
 	{
 		if( libmodi_deflate_read_block_header(
 		     bit_stream,
@@ -1842,62 +2574,10 @@ int libmodi_deflate_decompress_zlib(
 
 			goto on_error;
 		}
-		if( block_type == LIBMODI_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( libmodi_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libmodi_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libmodi_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
 		if( libmodi_deflate_read_block(
+		     context,
 		     bit_stream,
 		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
 		     uncompressed_data,
 		     safe_uncompressed_data_size,
 		     &uncompressed_data_offset,
@@ -1917,13 +2597,14 @@ int libmodi_deflate_decompress_zlib(
 			break;
 		}
 	}
+	/* Return the remaining whole bytes in the bit buffer to the byte stream
+	 */
+	bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+	bit_stream->bit_buffer          = 0;
+	bit_stream->bit_buffer_size     = 0;
+
 	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
 	{
-		while( bit_stream->bit_buffer_size >= 8 )
-		{
-			bit_stream->byte_stream_offset -= 1;
-			bit_stream->bit_buffer_size    -= 8;
-		}
 		byte_stream_copy_to_uint32_big_endian(
 		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
 		 stored_checksum );
@@ -1958,38 +2639,6 @@ int libmodi_deflate_decompress_zlib(
 			goto on_error;
 		}
 	}
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		if( libmodi_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		if( libmodi_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	if( libmodi_bit_stream_free(
 	     &bit_stream,
 	     error ) != 1 )
@@ -2008,18 +2657,6 @@ int libmodi_deflate_decompress_zlib(
 	return( 1 );
 
 on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libmodi_bit_stream_free(
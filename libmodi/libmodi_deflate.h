@@ -29,6 +29,25 @@
 #include "libmodi_huffman_tree.h"
 #include "libmodi_libcerror.h"
 
+/* The vectorized Adler-32 functions require a compiler that supports
+ * per-function target attributes, the instruction set is selected at run-time
+ */
+#if ( defined( __i386__ ) || defined( __x86_64__ ) ) && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) )
+#define LIBMODI_DEFLATE_HAVE_X86_SIMD
+#endif
+
+/* The fixed Huffman trees are shared by all decoders and are built once
+ * using the once initialization of the platform
+ */
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define LIBMODI_DEFLATE_HAVE_PTHREAD_ONCE
+#include <pthread.h>
+
+#elif defined( WINAPI ) && ( WINVER >= 0x0600 )
+#define LIBMODI_DEFLATE_HAVE_WINAPI_INIT_ONCE
+
+#endif
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
@@ -43,8 +62,34 @@ enum LIBMODI_DEFLATE_BLOCK_TYPES
 	LIBMODI_DEFLATE_BLOCK_TYPE_RESERVED		= 0x03
 };
 
+typedef struct libmodi_deflate_context libmodi_deflate_context_t;
+
+struct libmodi_deflate_context
+{
+	/* The dynamic Huffman codes tree
+	 */
+	libmodi_huffman_tree_t *codes_tree;
+
+	/* The dynamic Huffman literals tree
+	 */
+	libmodi_huffman_tree_t *literals_tree;
+
+	/* The dynamic Huffman distances tree
+	 */
+	libmodi_huffman_tree_t *distances_tree;
+};
+
+int libmodi_deflate_context_initialize(
+     libmodi_deflate_context_t **context,
+     libcerror_error_t **error );
+
+int libmodi_deflate_context_free(
+     libmodi_deflate_context_t **context,
+     libcerror_error_t **error );
+
 int libmodi_deflate_build_dynamic_huffman_trees(
      libmodi_bit_stream_t *bit_stream,
+     libmodi_huffman_tree_t *codes_tree,
      libmodi_huffman_tree_t *literals_tree,
      libmodi_huffman_tree_t *distances_tree,
      libcerror_error_t **error );
@@ -54,10 +99,27 @@ int libmodi_deflate_build_fixed_huffman_trees(
      libmodi_huffman_tree_t *distances_tree,
      libcerror_error_t **error );
 
+void libmodi_deflate_initialize_fixed_huffman_trees(
+      void );
+
+#if defined( LIBMODI_DEFLATE_HAVE_WINAPI_INIT_ONCE )
+
+BOOL CALLBACK libmodi_deflate_initialize_fixed_huffman_trees_callback(
+               PINIT_ONCE init_once,
+               PVOID parameter,
+               PVOID *context );
+
+#endif /* defined( LIBMODI_DEFLATE_HAVE_WINAPI_INIT_ONCE ) */
+
+int libmodi_deflate_get_fixed_huffman_trees(
+     const libmodi_huffman_tree_t **literals_tree,
+     const libmodi_huffman_tree_t **distances_tree,
+     libcerror_error_t **error );
+
 int libmodi_deflate_decode_huffman(
      libmodi_bit_stream_t *bit_stream,
-     libmodi_huffman_tree_t *literals_tree,
-     libmodi_huffman_tree_t *distances_tree,
+     const libmodi_huffman_tree_t *literals_tree,
+     const libmodi_huffman_tree_t *distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
@@ -70,6 +132,35 @@ int libmodi_deflate_calculate_adler32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int libmodi_deflate_calculate_adler32_scalar(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+#if defined( LIBMODI_DEFLATE_HAVE_X86_SIMD )
+
+void libmodi_deflate_calculate_adler32_sse2(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *data,
+      size_t number_of_blocks );
+
+void libmodi_deflate_calculate_adler32_ssse3(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *data,
+      size_t number_of_blocks );
+
+void libmodi_deflate_calculate_adler32_avx2(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *data,
+      size_t number_of_blocks );
+
+#endif /* defined( LIBMODI_DEFLATE_HAVE_X86_SIMD ) */
+
 int libmodi_deflate_read_data_header(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -83,16 +174,16 @@ int libmodi_deflate_read_block_header(
      libcerror_error_t **error );
 
 int libmodi_deflate_read_block(
+     libmodi_deflate_context_t *context,
      libmodi_bit_stream_t *bit_stream,
      uint8_t block_type,
-     libmodi_huffman_tree_t *fixed_huffman_literals_tree,
-     libmodi_huffman_tree_t *fixed_huffman_distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error );
 
 int libmodi_deflate_decompress(
+     libmodi_deflate_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
@@ -100,6 +191,7 @@ int libmodi_deflate_decompress(
      libcerror_error_t **error );
 
 int libmodi_deflate_decompress_zlib(
+     libmodi_deflate_context_t *context,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
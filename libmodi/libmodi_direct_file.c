@@ -0,0 +1,1039 @@
+/*
+ * The direct (unbuffered) file IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_TYPES_H )
+#include <sys/types.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if !defined( WINAPI )
+#include <errno.h>
+#include <stdlib.h>
+#endif
+
+#include "libmodi_definitions.h"
+#include "libmodi_direct_file.h"
+#include "libmodi_libbfio.h"
+#include "libmodi_libcerror.h"
+#include "libmodi_libcfile.h"
+
+#if !defined( WINAPI ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && defined( HAVE_FSTAT ) && defined( HAVE_PREAD ) && defined( HAVE_POSIX_MEMALIGN )
+#define LIBMODI_HAVE_DIRECT_FILE_SUPPORT	1
+#endif
+
+#if !defined( O_CLOEXEC )
+#define O_CLOEXEC	0
+#endif
+
+/* Creates a direct file IO handle
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_direct_file_io_handle_initialize(
+     libmodi_direct_file_io_handle_t **file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_initialize";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle = memory_allocate_structure(
+	                   libmodi_direct_file_io_handle_t );
+
+	if( *file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_io_handle,
+	     0,
+	     sizeof( libmodi_direct_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handle.",
+		 function );
+
+		memory_free(
+		 *file_io_handle );
+
+		*file_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *file_io_handle )->file_descriptor = -1;
+
+	( *file_io_handle )->name = narrow_string_allocate(
+	                             name_length + 1 );
+
+	if( ( *file_io_handle )->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     ( *file_io_handle )->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_io_handle )->name[ name_length ] = 0;
+
+	( *file_io_handle )->name_size = name_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		if( ( *file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle )->name );
+		}
+		memory_free(
+		 *file_io_handle );
+
+		*file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a direct file handle
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful, 0 if direct file IO is not supported or -1 on error
+ */
+int libmodi_direct_file_initialize(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+#if defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT )
+	libmodi_direct_file_io_handle_t *file_io_handle = NULL;
+#endif
+	static char *function                           = "libmodi_direct_file_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT )
+	return( 0 );
+#else
+	if( libmodi_direct_file_io_handle_initialize(
+	     &file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libmodi_direct_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libmodi_direct_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libmodi_direct_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libmodi_direct_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libmodi_direct_file_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libmodi_direct_file_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libmodi_direct_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libmodi_direct_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libmodi_direct_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libmodi_direct_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libmodi_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+#endif /* !defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT ) */
+}
+
+/* Frees a direct file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_direct_file_io_handle_free(
+     libmodi_direct_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_free";
+	int result            = 1;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( ( *file_io_handle )->file_descriptor != -1 )
+		{
+			if( libmodi_direct_file_io_handle_close(
+			     *file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle )->name );
+		}
+		memory_free(
+		 *file_io_handle );
+
+		*file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the direct file IO handle and its attributes
+ * The clone is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_direct_file_io_handle_clone(
+     libmodi_direct_file_io_handle_t **destination_file_io_handle,
+     libmodi_direct_file_io_handle_t *source_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_clone";
+
+	if( destination_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		*destination_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libmodi_direct_file_io_handle_initialize(
+	     destination_file_io_handle,
+	     source_file_io_handle->name,
+	     source_file_io_handle->name_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the direct file IO handle
+ * The file is opened with O_DIRECT if supported, otherwise the file data is
+ * released from the page cache after it has been read
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_direct_file_io_handle_open(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+#if defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT )
+	struct stat file_statistics;
+
+	void *buffer          = NULL;
+#endif
+	static char *function = "libmodi_direct_file_io_handle_open";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT )
+#if defined( O_DIRECT )
+	file_io_handle->file_descriptor = open(
+	                                   file_io_handle->name,
+	                                   O_RDONLY | O_DIRECT | O_CLOEXEC );
+
+	/* Not all file systems support O_DIRECT, in which case the data read
+	 * is released from the page cache by posix_fadvise if available
+	 */
+	if( ( file_io_handle->file_descriptor == -1 )
+	 && ( errno == EINVAL ) )
+#endif
+	{
+		file_io_handle->file_descriptor = open(
+		                                   file_io_handle->name,
+		                                   O_RDONLY | O_CLOEXEC );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 file_io_handle->name );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_io_handle->file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_statistics.st_size < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( posix_memalign(
+	     &buffer,
+	     LIBMODI_DIRECT_FILE_BUFFER_ALIGNMENT,
+	     LIBMODI_DIRECT_FILE_BUFFER_SIZE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create aligned buffer.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle->buffer           = (uint8_t *) buffer;
+	file_io_handle->buffer_size      = LIBMODI_DIRECT_FILE_BUFFER_SIZE;
+	file_io_handle->buffer_offset    = 0;
+	file_io_handle->buffer_data_size = 0;
+	file_io_handle->size             = (size64_t) file_statistics.st_size;
+	file_io_handle->current_offset   = 0;
+	file_io_handle->access_flags     = access_flags;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle->file_descriptor != -1 )
+	{
+		close(
+		 file_io_handle->file_descriptor );
+
+		file_io_handle->file_descriptor = -1;
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct file IO not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT ) */
+}
+
+/* Closes the direct file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libmodi_direct_file_io_handle_close(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_close";
+	int result            = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT )
+	if( close(
+	     file_io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file descriptor.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	file_io_handle->file_descriptor = -1;
+
+	/* The aligned buffer is allocated by posix_memalign and must be released by free
+	 */
+	if( file_io_handle->buffer != NULL )
+	{
+		free(
+		 file_io_handle->buffer );
+
+		file_io_handle->buffer = NULL;
+	}
+	file_io_handle->buffer_size      = 0;
+	file_io_handle->buffer_offset    = 0;
+	file_io_handle->buffer_data_size = 0;
+	file_io_handle->size             = 0;
+	file_io_handle->current_offset   = 0;
+	file_io_handle->access_flags     = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the direct file IO handle
+ * The data is read in aligned blocks into the aligned buffer and copied from there
+ * The size of a read is that of the remaining requested data rounded out to
+ * the alignment and at most the aligned buffer size, unless the read continues
+ * after the data in the aligned buffer, in which case the aligned buffer is filled
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libmodi_direct_file_io_handle_read(
+         libmodi_direct_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_read";
+	size_t buffer_index   = 0;
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+
+#if defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT )
+	off64_t aligned_offset   = 0;
+	size_t aligned_read_size = 0;
+	ssize_t read_count       = 0;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_index < size )
+	{
+		if( (size64_t) file_io_handle->current_offset >= file_io_handle->size )
+		{
+			break;
+		}
+		if( ( file_io_handle->current_offset < file_io_handle->buffer_offset )
+		 || ( file_io_handle->current_offset >= (off64_t) ( file_io_handle->buffer_offset + file_io_handle->buffer_data_size ) ) )
+		{
+#if defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT )
+			aligned_offset    = file_io_handle->current_offset - ( file_io_handle->current_offset % LIBMODI_DIRECT_FILE_BUFFER_ALIGNMENT );
+			aligned_read_size = file_io_handle->buffer_size;
+
+			/* If the read continues where the data in the aligned buffer ends, such as
+			 * the consecutive element reads of a band, the aligned buffer is filled
+			 * ahead in a single read, otherwise only the requested data is read
+			 */
+			if( ( file_io_handle->current_offset != (off64_t) ( file_io_handle->buffer_offset + file_io_handle->buffer_data_size ) )
+			 && ( ( size - buffer_index ) < file_io_handle->buffer_size ) )
+			{
+				aligned_read_size  = (size_t) ( file_io_handle->current_offset - aligned_offset ) + ( size - buffer_index );
+				aligned_read_size += LIBMODI_DIRECT_FILE_BUFFER_ALIGNMENT - 1;
+				aligned_read_size -= aligned_read_size % LIBMODI_DIRECT_FILE_BUFFER_ALIGNMENT;
+
+				if( aligned_read_size > file_io_handle->buffer_size )
+				{
+					aligned_read_size = file_io_handle->buffer_size;
+				}
+			}
+			read_count = pread(
+			              file_io_handle->file_descriptor,
+			              file_io_handle->buffer,
+			              aligned_read_size,
+			              (off_t) aligned_offset );
+
+			if( read_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from file descriptor at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 aligned_offset,
+				 aligned_offset );
+
+				return( -1 );
+			}
+#if defined( HAVE_POSIX_FADVISE )
+			posix_fadvise(
+			 file_io_handle->file_descriptor,
+			 (off_t) aligned_offset,
+			 (off_t) read_count,
+			 POSIX_FADV_DONTNEED );
+#endif
+			file_io_handle->buffer_offset    = aligned_offset;
+			file_io_handle->buffer_data_size = (size_t) read_count;
+
+			if( file_io_handle->current_offset >= (off64_t) ( file_io_handle->buffer_offset + file_io_handle->buffer_data_size ) )
+			{
+				break;
+			}
+#else
+			break;
+#endif /* defined( LIBMODI_HAVE_DIRECT_FILE_SUPPORT ) */
+		}
+		data_offset = (size_t) ( file_io_handle->current_offset - file_io_handle->buffer_offset );
+		read_size   = file_io_handle->buffer_data_size - data_offset;
+
+		if( read_size > ( size - buffer_index ) )
+		{
+			read_size = size - buffer_index;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_index ] ),
+		     &( file_io_handle->buffer[ data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_index                   += read_size;
+		file_io_handle->current_offset += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_index );
+}
+
+/* Writes a buffer to the direct file IO handle
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libmodi_direct_file_io_handle_write(
+         libmodi_direct_file_io_handle_t *file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_write";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: write access not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the direct file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libmodi_direct_file_io_handle_seek_offset(
+         libmodi_direct_file_io_handle_t *file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_seek_offset";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) file_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libmodi_direct_file_io_handle_exists(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_exists";
+	int result            = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcfile_file_exists(
+	          file_io_handle->name,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if file: %s exists.",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the direct file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libmodi_direct_file_io_handle_is_open(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_is_open";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_direct_file_io_handle_get_size(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_direct_file_io_handle_get_size";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = file_io_handle->size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,146 @@
+/*
+ * The direct (unbuffered) file IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMODI_DIRECT_FILE_H )
+#define _LIBMODI_DIRECT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmodi_libbfio.h"
+#include "libmodi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmodi_direct_file_io_handle libmodi_direct_file_io_handle_t;
+
+struct libmodi_direct_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The file size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The aligned buffer
+	 */
+	uint8_t *buffer;
+
+	/* The aligned buffer size
+	 */
+	size_t buffer_size;
+
+	/* The file offset of the data in the aligned buffer
+	 */
+	off64_t buffer_offset;
+
+	/* The size of the data in the aligned buffer
+	 */
+	size_t buffer_data_size;
+};
+
+int libmodi_direct_file_io_handle_initialize(
+     libmodi_direct_file_io_handle_t **file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libmodi_direct_file_initialize(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libmodi_direct_file_io_handle_free(
+     libmodi_direct_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libmodi_direct_file_io_handle_clone(
+     libmodi_direct_file_io_handle_t **destination_file_io_handle,
+     libmodi_direct_file_io_handle_t *source_file_io_handle,
+     libcerror_error_t **error );
+
+int libmodi_direct_file_io_handle_open(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libmodi_direct_file_io_handle_close(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libmodi_direct_file_io_handle_read(
+         libmodi_direct_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libmodi_direct_file_io_handle_write(
+         libmodi_direct_file_io_handle_t *file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libmodi_direct_file_io_handle_seek_offset(
+         libmodi_direct_file_io_handle_t *file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libmodi_direct_file_io_handle_exists(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmodi_direct_file_io_handle_is_open(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmodi_direct_file_io_handle_get_size(
+     libmodi_direct_file_io_handle_t *file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMODI_DIRECT_FILE_H ) */
+
@@ -0,0 +1,81 @@
+/*
+ * Extent functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMODI_EXTENT_H )
+#define _LIBMODI_EXTENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmodi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmodi_extent libmodi_extent_t;
+
+struct libmodi_extent
+{
+	/* The (media) offset
+	 */
+	off64_t offset;
+
+	/* The (media) size
+	 */
+	size64_t size;
+
+	/* The stored size
+	 */
+	size64_t stored_size;
+
+	/* The compression method
+	 */
+	int compression_method;
+
+	/* The flags
+	 */
+	uint32_t flags;
+};
+
+int libmodi_extent_initialize(
+     libmodi_extent_t **extent,
+     libcerror_error_t **error );
+
+int libmodi_extent_free(
+     libmodi_extent_t **extent,
+     libcerror_error_t **error );
+
+int libmodi_extent_get_values(
+     libmodi_extent_t *extent,
+     off64_t *offset,
+     size64_t *size,
+     size64_t *stored_size,
+     int *compression_method,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMODI_EXTENT_H ) */
+
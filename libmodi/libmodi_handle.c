@@ -31,6 +31,8 @@
 #include "libmodi_data_block.h"
 #include "libmodi_debug.h"
 #include "libmodi_definitions.h"
+#include "libmodi_direct_file.h"
+#include "libmodi_extent.h"
 #include "libmodi_i18n.h"
 #include "libmodi_io_handle.h"
 #include "libmodi_handle.h"
@@ -44,8 +46,11 @@
 #include "libmodi_libfcache.h"
 #include "libmodi_libfdata.h"
 #include "libmodi_libfvalue.h"
+#include "libmodi_mapped_file.h"
+#include "libmodi_partition.h"
 #include "libmodi_sparse_bundle_xml_plist.h"
 #include "libmodi_sparse_image_header.h"
+#include "libmodi_statistics.h"
 #include "libmodi_system_string.h"
 #include "libmodi_udif_block_table.h"
 #include "libmodi_udif_block_table_entry.h"
@@ -760,6 +765,46 @@ int libmodi_handle_open(
 			goto on_error;
 		}
 	}
+	if( ( ( access_flags & LIBMODI_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	 && ( is_directory != 1 ) )
+	{
+		if( libmodi_internal_handle_open_mapped_file(
+		     internal_handle,
+		     filename,
+		     &file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	else if( ( ( access_flags & LIBMODI_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	      && ( is_directory != 1 ) )
+	{
+		if( libmodi_internal_handle_open_direct_file(
+		     internal_handle,
+		     filename,
+		     &file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open direct file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
 	if( libmodi_handle_open_file_io_handle(
 	     handle,
 	     file_io_handle,
@@ -857,6 +902,13 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( ( internal_handle->mapped_file != NULL )
+	 && ( internal_handle->file_io_handle == NULL ) )
+	{
+		libmodi_mapped_file_free(
+		 &( internal_handle->mapped_file ),
+		 NULL );
+	}
 	if( info_plist_path != NULL )
 	{
 		memory_free(
@@ -1071,6 +1123,46 @@ int libmodi_handle_open_wide(
 			goto on_error;
 		}
 	}
+	if( ( ( access_flags & LIBMODI_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	 && ( is_directory != 1 ) )
+	{
+		if( libmodi_internal_handle_open_mapped_file_wide(
+		     internal_handle,
+		     filename,
+		     &file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file: %ls.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	else if( ( ( access_flags & LIBMODI_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	      && ( is_directory != 1 ) )
+	{
+		if( libmodi_internal_handle_open_direct_file_wide(
+		     internal_handle,
+		     filename,
+		     &file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open direct file: %ls.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
 	if( libmodi_handle_open_file_io_handle(
 	     handle,
 	     file_io_handle,
@@ -1169,6 +1261,13 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( ( internal_handle->mapped_file != NULL )
+	 && ( internal_handle->file_io_handle == NULL ) )
+	{
+		libmodi_mapped_file_free(
+		 &( internal_handle->mapped_file ),
+		 NULL );
+	}
 	if( info_plist_path != NULL )
 	{
 		memory_free(
@@ -1185,22 +1284,20 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Opens a handle using a Basic File IO (bfio) handle
- * Returns 1 if successful or -1 on error
+/* Memory maps the image file and replaces the file IO handle with a memory range
+ * Returns 1 if successful, 0 if the image file could not be memory mapped or -1 on error
  */
-int libmodi_handle_open_file_io_handle(
-     libmodi_handle_t *handle,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+int libmodi_internal_handle_open_mapped_file(
+     libmodi_internal_handle_t *internal_handle,
+     const char *filename,
+     libbfio_handle_t **file_io_handle,
      libcerror_error_t **error )
 {
-	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library   = 0;
-	int bfio_access_flags                      = 0;
-	int file_io_handle_is_open                 = 0;
+	libbfio_handle_t *memory_range_io_handle = NULL;
+	static char *function                    = "libmodi_internal_handle_open_mapped_file";
+	int result                               = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1211,155 +1308,153 @@ int libmodi_handle_open_file_io_handle(
 
 		return( -1 );
 	}
-	internal_handle = (libmodi_internal_handle_t *) handle;
-
-	if( file_io_handle == NULL )
+	if( internal_handle->mapped_file != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - mapped file value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBMODI_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBMODI_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBMODI_ACCESS_FLAG_WRITE ) != 0 )
+	if( libmodi_mapped_file_initialize(
+	     &( internal_handle->mapped_file ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
 		 function );
 
-		return( -1 );
-	}
-	if( ( access_flags & LIBMODI_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		goto on_error;
 	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+	result = libmodi_mapped_file_open(
+	          internal_handle->mapped_file,
+	          filename,
+	          error );
 
-	if( file_io_handle_is_open == -1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 "%s: unable to open mapped file.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+	else if( result == 0 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
+		if( libmodi_mapped_file_free(
+		     &( internal_handle->mapped_file ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped file.",
 			 function );
 
 			goto on_error;
 		}
-		file_io_handle_opened_in_library = 1;
+		return( 0 );
 	}
-	if( libmodi_internal_handle_open_read(
-	     internal_handle,
-	     file_io_handle,
+	if( libbfio_memory_range_initialize(
+	     &memory_range_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory range IO handle.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
+	if( libbfio_memory_range_set(
+	     memory_range_io_handle,
+	     internal_handle->mapped_file->data,
+	     internal_handle->mapped_file->data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to set memory range in IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	internal_handle->file_io_handle                   = file_io_handle;
-	internal_handle->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
-	internal_handle->access_flags                     = access_flags;
-
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( *file_io_handle != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		if( libbfio_handle_free(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-#endif
+	*file_io_handle = memory_range_io_handle;
+
 	return( 1 );
 
 on_error:
-	if( file_io_handle_opened_in_library != 0 )
+	if( memory_range_io_handle != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libbfio_handle_free(
+		 &memory_range_io_handle,
+		 NULL );
+	}
+	if( internal_handle->mapped_file != NULL )
+	{
+		libmodi_mapped_file_free(
+		 &( internal_handle->mapped_file ),
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Opens the band data files
- * If the band data filenames were not set explicitly this function assumes the band data files
- * are in the sub directory band in the same location as the Info.plist file
- * Returns 1 if successful or -1 on error
+/* Replaces the file IO handle with a direct (unbuffered) file IO handle
+ * Returns 1 if successful, 0 if direct file IO is not supported or -1 on error
  */
-int libmodi_handle_open_band_data_files(
-     libmodi_handle_t *handle,
+int libmodi_internal_handle_open_direct_file(
+     libmodi_internal_handle_t *internal_handle,
+     const char *filename,
+     libbfio_handle_t **file_io_handle,
      libcerror_error_t **error )
 {
-        libbfio_pool_t *file_io_pool               = NULL;
-	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_open_band_data_files";
-	int band_index                             = 0;
-	int result                                 = 0;
+	libbfio_handle_t *direct_file_io_handle = NULL;
+	static char *function                   = "libmodi_internal_handle_open_direct_file";
+	size_t filename_length                  = 0;
+	int result                              = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1370,523 +1465,338 @@ int libmodi_handle_open_band_data_files(
 
 		return( -1 );
 	}
-	internal_handle = (libmodi_internal_handle_t *) handle;
-
-	if( ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) != 0 )
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
+	filename_length = narrow_string_length(
+	                   filename );
 
-		return( -1 );
-	}
-	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
-	 && ( internal_handle->io_handle->number_of_bands <= 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing number of bands.",
-		 function );
+	result = libmodi_direct_file_initialize(
+	          &direct_file_io_handle,
+	          filename,
+	          filename_length,
+	          error );
 
-		return( -1 );
-	}
-	if( internal_handle->band_data_file_io_pool != NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - band data file IO pool already exists.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	else if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-#endif
-	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	if( *file_io_handle != NULL )
 	{
-		if( libbfio_pool_initialize(
-		     &file_io_pool,
-		     internal_handle->io_handle->number_of_bands,
-		     internal_handle->maximum_number_of_open_handles,
+		if( libbfio_handle_free(
+		     file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file IO pool.",
-			 function );
-
-			goto on_error;
-		}
-		for( band_index = 0;
-		     band_index < internal_handle->io_handle->number_of_bands;
-		     band_index++ )
-		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libmodi_internal_handle_open_band_data_file_wide(
-				  internal_handle,
-				  file_io_pool,
-				  band_index,
-				  error );
-#else
-			result = libmodi_internal_handle_open_band_data_file(
-				  internal_handle,
-				  file_io_pool,
-				  band_index,
-				  error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_OPEN_FAILED,
-				 "%s: unable to open band data file: %x.",
-				 function,
-				 band_index );
-
-				goto on_error;
-			}
-		}
-		if( libmodi_internal_handle_open_band_data_files_file_io_pool(
-		     internal_handle,
-		     file_io_pool,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open band data files from file IO pool.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
 			 function );
 
 			goto on_error;
 		}
-		internal_handle->band_data_file_io_pool_created_in_library = 1;
 	}
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+	*file_io_handle = direct_file_io_handle;
 
-		return( -1 );
-	}
-#endif
 	return( 1 );
 
 on_error:
-	if( file_io_pool != NULL )
+	if( direct_file_io_handle != NULL )
 	{
-		libbfio_pool_close_all(
-		 file_io_pool,
-		 NULL );
-		libbfio_pool_free(
-		 &file_io_pool,
+		libbfio_handle_free(
+		 &direct_file_io_handle,
 		 NULL );
 	}
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
 	return( -1 );
 }
 
-/* Opens the band data files using a Basic File IO (bfio) pool
- * This function assumes the band data files are in order and
- * non-existing band data files are set to NULL
- * Returns 1 if successful or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Memory maps the image file and replaces the file IO handle with a memory range
+ * The filename is converted to a narrow string in the codepage of the system
+ * Returns 1 if successful, 0 if the image file could not be memory mapped or -1 on error
  */
-int libmodi_handle_open_band_data_files_file_io_pool(
-     libmodi_handle_t *handle,
-     libbfio_pool_t *file_io_pool,
+int libmodi_internal_handle_open_mapped_file_wide(
+     libmodi_internal_handle_t *internal_handle,
+     const wchar_t *filename,
+     libbfio_handle_t **file_io_handle,
      libcerror_error_t **error )
 {
-	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_open_band_data_files_file_io_pool";
-	int result                                 = 1;
+	char *narrow_filename       = NULL;
+	static char *function       = "libmodi_internal_handle_open_mapped_file_wide";
+	size_t filename_length      = 0;
+	size_t narrow_filename_size = 0;
+	int result                  = 0;
 
-	if( handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libmodi_internal_handle_t *) handle;
-
-	if( ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) == 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
-		 function );
+	filename_length = wide_string_length(
+	                   filename );
 
-		return( -1 );
-	}
-	if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) != 0 )
+	if( libmodi_narrow_string_size_from_wide_string(
+	     filename,
+	     filename_length + 1,
+	     &narrow_filename_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow filename size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->io_handle == NULL )
+	if( ( narrow_filename_size == 0 )
+	 || ( narrow_filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid narrow filename size value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->band_data_file_io_pool != NULL )
+	narrow_filename = narrow_string_allocate(
+	                   narrow_filename_size );
+
+	if( narrow_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - band data file IO pool already exists.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
+	if( libmodi_narrow_string_copy_from_wide_string(
+	     narrow_filename,
+	     narrow_filename_size,
+	     filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
-	{
-		if( libmodi_internal_handle_open_band_data_files_file_io_pool(
-		     internal_handle,
-		     file_io_pool,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open band data files from file IO pool.",
-			 function );
+	result = libmodi_internal_handle_open_mapped_file(
+	          internal_handle,
+	          narrow_filename,
+	          file_io_handle,
+	          error );
 
-			result = -1;
-		}
-	}
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to memory map file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
+	memory_free(
+	 narrow_filename );
+
 	return( result );
+
+on_error:
+	if( narrow_filename != NULL )
+	{
+		memory_free(
+		 narrow_filename );
+	}
+	return( -1 );
 }
 
-/* Opens the band data files using a Basic File IO (bfio) pool
- * This function assumes the band data files are in order and
- * non-existing band data files are set to NULL
- * Returns 1 if successful or -1 on error
+/* Replaces the file IO handle with a direct (unbuffered) file IO handle
+ * The filename is converted to a narrow string in the codepage of the system
+ * Returns 1 if successful, 0 if direct file IO is not supported or -1 on error
  */
-int libmodi_internal_handle_open_band_data_files_file_io_pool(
+int libmodi_internal_handle_open_direct_file_wide(
      libmodi_internal_handle_t *internal_handle,
-     libbfio_pool_t *file_io_pool,
+     const wchar_t *filename,
+     libbfio_handle_t **file_io_handle,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libmodi_internal_handle_open_band_data_files_file_io_pool";
-	size64_t band_data_size          = 0;
-	size64_t file_size               = 0;
-	size64_t media_size              = 0;
-	size64_t sparse_band_data_size   = 0;
-	int file_io_handle_index         = 0;
-	int number_of_file_io_handles    = 0;
+	char *narrow_filename       = NULL;
+	static char *function       = "libmodi_internal_handle_open_direct_file_wide";
+	size_t filename_length      = 0;
+	size_t narrow_filename_size = 0;
+	int result                  = 0;
 
-	if( internal_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->band_data_file_io_pool != NULL )
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libmodi_narrow_string_size_from_wide_string(
+	     filename,
+	     filename_length + 1,
+	     &narrow_filename_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - band data file IO pool already exists.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow filename size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->io_handle == NULL )
+	if( ( narrow_filename_size == 0 )
+	 || ( narrow_filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid narrow filename size value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->io_handle->band_data_size == 0 )
+	narrow_filename = narrow_string_allocate(
+	                   narrow_filename_size );
+
+	if( narrow_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing band data size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libbfio_pool_get_number_of_handles(
-	     file_io_pool,
-	     &number_of_file_io_handles,
+	if( libmodi_narrow_string_copy_from_wide_string(
+	     narrow_filename,
+	     narrow_filename_size,
+	     filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of handles in file IO pool.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( number_of_file_io_handles != internal_handle->io_handle->number_of_bands )
+	result = libmodi_internal_handle_open_direct_file(
+	          internal_handle,
+	          narrow_filename,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of handles in file IO pool value does not match number of bands.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open direct file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	media_size = internal_handle->io_handle->media_size;
+	memory_free(
+	 narrow_filename );
 
-	for( file_io_handle_index = 0;
-	     file_io_handle_index < number_of_file_io_handles;
-	     file_io_handle_index++ )
+	return( result );
+
+on_error:
+	if( narrow_filename != NULL )
 	{
-		if( libbfio_pool_get_handle(
-		     file_io_pool,
-		     file_io_handle_index,
-		     &file_io_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve handle: %d from file IO pool.",
-			 function,
-			 file_io_handle_index );
-
-			return( -1 );
-		}
-		if( file_io_handle == NULL )
-		{
-			band_data_size        = 0;
-			sparse_band_data_size = internal_handle->io_handle->band_data_size;
-		}
-		else
-		{
-			if( libbfio_handle_get_size(
-			     file_io_handle,
-			     &file_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file size.",
-				 function );
-
-				return( -1 );
-			}
-			if( internal_handle->io_handle->band_data_size < media_size )
-			{
-				sparse_band_data_size = internal_handle->io_handle->band_data_size;
-			}
-			else
-			{
-				sparse_band_data_size = media_size;
-			}
-			if( file_size > sparse_band_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid band data file: %d size value out of bounds.",
-				 function,
-				 file_io_handle_index );
-
-				return( -1 );
-			}
-			band_data_size         = file_size;
-			sparse_band_data_size -= file_size;
-		}
-		if( band_data_size > 0 )
-		{
-			if( libmodi_bands_data_handle_append_segment(
-			     internal_handle->bands_data_handle,
-			     file_io_handle_index,
-			     0,
-			     band_data_size,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append band data file: %d as segment to bands data handle.",
-				 function,
-				 file_io_handle_index );
-
-				return( -1 );
-			}
-		}
-		if( sparse_band_data_size > 0 )
-		{
-			if( libmodi_bands_data_handle_append_segment(
-			     internal_handle->bands_data_handle,
-			     file_io_handle_index,
-			     0,
-			     sparse_band_data_size,
-			     LIBFDATA_RANGE_FLAG_IS_SPARSE,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append band data file: %d as sparse segment to bands data handle.",
-				 function,
-				 file_io_handle_index );
-
-				return( -1 );
-			}
-		}
-		media_size -= internal_handle->io_handle->band_data_size;
+		memory_free(
+		 narrow_filename );
 	}
-	internal_handle->band_data_file_io_pool = file_io_pool;
-
-	return( 1 );
+	return( -1 );
 }
 
-/* Opens a specific band data file
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a handle using a Basic File IO (bfio) handle
  * Returns 1 if successful or -1 on error
  */
-int libmodi_internal_handle_open_band_data_file(
-     libmodi_internal_handle_t *internal_handle,
-     libbfio_pool_t *file_io_pool,
-     int band_index,
+int libmodi_handle_open_file_io_handle(
+     libmodi_handle_t *handle,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
      libcerror_error_t **error )
 {
-	char filename[ 16 ];
-
-	libbfio_handle_t *file_io_handle = NULL;
-	char *bands_file_path            = NULL;
-	static char *function            = "libmodi_internal_handle_open_band_data_file";
-	size_t bands_file_path_size      = 0;
-	size_t filename_length           = 0;
-	int bfio_access_flags            = 0;
-	int result                       = 0;
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library   = 0;
+	int bfio_access_flags                      = 0;
+	int file_io_handle_is_open                 = 0;
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1897,108 +1807,63 @@ int libmodi_internal_handle_open_band_data_file(
 
 		return( -1 );
 	}
-	if( libfvalue_utf8_string_copy_from_integer(
-	     (uint8_t *) filename,
-	     16,
-	     band_index,
-	     SIZEOF_INT * 8,
-	     LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR | LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
-	     error ) != 1 )
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy band index to string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	filename_length = narrow_string_length(
-	                   filename );
+	if( ( ( access_flags & LIBMODI_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBMODI_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-	if( libcpath_path_join(
-	     &bands_file_path,
-	     &bands_file_path_size,
-	     (char *) internal_handle->bands_directory_path,
-	     internal_handle->bands_directory_path_size - 1,
-	     filename,
-	     filename_length,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( ( access_flags & LIBMODI_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bands file: %d path.",
-		 function,
-		 band_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libcfile_file_exists(
-	          bands_file_path,
-	          error );
+	if( ( access_flags & LIBMODI_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
 
-	if( result == -1 )
+	if( file_io_handle_is_open == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if band data file exists.",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
 		 function );
+
+		goto on_error;
 	}
-	else if( result != 0 )
+	else if( file_io_handle_is_open == 0 )
 	{
-		if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) != 0 )
-		{
-			bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-		}
-		if( libbfio_file_initialize(
-		     &file_io_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file IO handle.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libbfio_handle_set_track_offsets_read(
-		     file_io_handle,
-		     1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set track offsets read in file IO handle.",
-			 function );
-
-			goto on_error;
-		}
-#endif
-		if( libbfio_file_set_name(
-		     file_io_handle,
-		     bands_file_path,
-		     bands_file_path_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set filename in file IO handle.",
-			 function );
-
-			goto on_error;
-		}
 		if( libbfio_handle_open(
 		     file_io_handle,
 		     bfio_access_flags,
@@ -2013,66 +1878,83 @@ int libmodi_internal_handle_open_band_data_file(
 
 			goto on_error;
 		}
-		if( libbfio_pool_set_handle(
-		     file_io_pool,
-		     band_index,
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set file IO handle: %d in pool.",
-			 function,
-			 band_index );
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libmodi_internal_handle_open_read(
+	     internal_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	memory_free(
-	 bands_file_path );
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+#endif
+	internal_handle->file_io_handle                   = file_io_handle;
+	internal_handle->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_handle->access_flags                     = access_flags;
 
-on_error:
-	if( file_io_handle != NULL )
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
-	if( bands_file_path != NULL )
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
 	{
-		memory_free(
-		 bands_file_path );
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
 	}
 	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a specific band data file
+/* Opens the band data files
+ * If the band data filenames were not set explicitly this function assumes the band data files
+ * are in the sub directory band in the same location as the Info.plist file
+ * The individual band data files are opened on demand when their data is first read
  * Returns 1 if successful or -1 on error
  */
-int libmodi_internal_handle_open_band_data_file_wide(
-     libmodi_internal_handle_t *internal_handle,
-     libbfio_pool_t *file_io_pool,
-     int band_index,
+int libmodi_handle_open_band_data_files(
+     libmodi_handle_t *handle,
      libcerror_error_t **error )
 {
-	wchar_t filename[ 16 ];
-
-	libbfio_handle_t *file_io_handle = NULL;
-	wchar_t *bands_file_path         = NULL;
-	static char *function            = "libmodi_internal_handle_open_band_data_file_wide";
-	size_t bands_file_path_size      = 0;
-	size_t filename_length           = 0;
-	int bfio_access_flags            = 0;
-	int result                       = 0;
+        libbfio_pool_t *file_io_pool               = NULL;
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_open_band_data_files";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2083,182 +1965,188 @@ int libmodi_internal_handle_open_band_data_file_wide(
 
 		return( -1 );
 	}
-#if ( SIZEOF_WCHAR_T == 4 )
-	result = libfvalue_utf32_string_copy_from_integer(
-	          (uint32_t *) filename,
-	          16,
-	          band_index,
-	          SIZEOF_INT * 8,
-	          LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR | LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
-	          error );
-#else
-	result = libfvalue_utf16_string_copy_from_integer(
-	          (uint16_t *) filename,
-	          16,
-	          band_index,
-	          SIZEOF_INT * 8,
-	          LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR | LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
-	          error );
-#endif
-	if( result != 1 )
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy band index to string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	filename_length = wide_string_length(
-	                   filename );
+	if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-	if( libcpath_path_join_wide(
-	     &bands_file_path,
-	     &bands_file_path_size,
-	     (wchar_t *) internal_handle->bands_directory_path,
-	     internal_handle->bands_directory_path_size - 1,
-	     filename,
-	     filename_length,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bands file path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libcfile_file_exists_wide(
-	          bands_file_path,
-	          error );
-
-	if( result == -1 )
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	 && ( internal_handle->io_handle->number_of_bands <= 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if band data file exists.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing number of bands.",
 		 function );
+
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( internal_handle->band_data_file_io_pool != NULL )
 	{
-		if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) != 0 )
-		{
-			bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-		}
-		if( libbfio_file_initialize(
-		     &file_io_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - band data file IO pool already exists.",
+		 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libbfio_handle_set_track_offsets_read(
-		     file_io_handle,
-		     1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set track offsets read in file IO handle.",
-			 function );
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
+	}
 #endif
-		if( libbfio_file_set_name_wide(
-		     file_io_handle,
-		     bands_file_path,
-		     bands_file_path_size,
+	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	{
+		if( libbfio_pool_initialize(
+		     &file_io_pool,
+		     internal_handle->io_handle->number_of_bands,
+		     internal_handle->maximum_number_of_open_handles,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set filename in file IO handle.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO pool.",
 			 function );
 
 			goto on_error;
 		}
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
+		if( libmodi_internal_handle_read_bands_directory(
+		     internal_handle,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bands directory.",
 			 function );
 
 			goto on_error;
 		}
-		if( libbfio_pool_set_handle(
+		if( libmodi_internal_handle_open_band_data_files_on_demand(
+		     internal_handle,
 		     file_io_pool,
-		     band_index,
-		     file_io_handle,
-		     bfio_access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set file IO handle: %d in pool.",
-			 function,
-			 band_index );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open band data files on demand.",
+			 function );
 
 			goto on_error;
 		}
+		internal_handle->band_data_file_io_pool_created_in_library = 1;
 	}
-	memory_free(
-	 bands_file_path );
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
-	if( file_io_handle != NULL )
+	if( internal_handle->present_band_data_files != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		memory_free(
+		 internal_handle->present_band_data_files );
+
+		internal_handle->present_band_data_files = NULL;
 	}
-	if( bands_file_path != NULL )
+	if( internal_handle->resolved_band_data_files != NULL )
 	{
 		memory_free(
-		 bands_file_path );
+		 internal_handle->resolved_band_data_files );
+
+		internal_handle->resolved_band_data_files = NULL;
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_close_all(
+		 file_io_pool,
+		 NULL );
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
 	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Closes a handle
- * Returns 0 if successful or -1 on error
+/* Opens the band data files using a Basic File IO (bfio) pool
+ * This function assumes the band data files are in order and
+ * non-existing band data files are set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int libmodi_handle_close(
+int libmodi_handle_open_band_data_files_file_io_pool(
      libmodi_handle_t *handle,
+     libbfio_pool_t *file_io_pool,
      libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_close";
-	int result                                 = 0;
+	static char *function                      = "libmodi_handle_open_band_data_files_file_io_pool";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -2273,174 +2161,78 @@ int libmodi_handle_close(
 	}
 	internal_handle = (libmodi_internal_handle_t *) handle;
 
-	if( internal_handle->file_io_handle == NULL )
+	if( ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( internal_handle->file_io_handle_created_in_library != 0 )
-		{
-			if( libmodi_debug_print_read_offsets(
-			     internal_handle->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
-
-				result = -1;
-			}
-		}
-	}
-#endif
-	if( internal_handle->band_data_file_io_pool_created_in_library != 0 )
-	{
-		if( libbfio_pool_close_all(
-		     internal_handle->band_data_file_io_pool,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close all files in band data file IO pool.",
-			 function );
-
-			result = -1;
-		}
-		if( libbfio_pool_free(
-		     &( internal_handle->band_data_file_io_pool ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free band data file IO pool.",
-			 function );
-
-			result = -1;
-		}
-		internal_handle->band_data_file_io_pool_created_in_library = 0;
-	}
-	internal_handle->band_data_file_io_pool = NULL;
-
-	if( internal_handle->file_io_handle_opened_in_library != 0 )
-	{
-		if( libbfio_handle_close(
-		     internal_handle->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_handle->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_handle->file_io_handle_created_in_library != 0 )
+	if( internal_handle->io_handle == NULL )
 	{
-		if( libbfio_handle_free(
-		     &( internal_handle->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
 
-			result = -1;
-		}
-		internal_handle->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_handle->file_io_handle = NULL;
-
-	if( libmodi_io_handle_clear(
-	     internal_handle->io_handle,
-	     error ) != 1 )
+	if( internal_handle->band_data_file_io_pool != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - band data file IO pool already exists.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libfdata_stream_free(
-	     &( internal_handle->data_stream ),
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free data stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		result = -1;
-	}
-	if( internal_handle->bands_data_handle != NULL )
-	{
-		if( libmodi_bands_data_handle_free(
-		     &( internal_handle->bands_data_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free bands data handle.",
-			 function );
-
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_handle->block_chunks_data_handle != NULL )
+#endif
+	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
 	{
-		if( libmodi_block_chunks_data_handle_free(
-		     &( internal_handle->block_chunks_data_handle ),
+		if( libmodi_internal_handle_open_band_data_files_file_io_pool(
+		     internal_handle,
+		     file_io_pool,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free block chunks data handle.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open band data files from file IO pool.",
 			 function );
 
 			result = -1;
@@ -2464,26 +2256,24 @@ int libmodi_handle_close(
 	return( result );
 }
 
-/* Opens a handle for reading
+/* Opens the band data files using a Basic File IO (bfio) pool
+ * This function assumes the band data files are in order and
+ * non-existing band data files are set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libmodi_internal_handle_open_read(
+int libmodi_internal_handle_open_band_data_files_file_io_pool(
      libmodi_internal_handle_t *internal_handle,
-     libbfio_handle_t *file_io_handle,
+     libbfio_pool_t *file_io_pool,
      libcerror_error_t **error )
 {
-	static char *function      = "libmodi_internal_handle_open_read";
-	size64_t element_size      = 0;
-	size64_t file_size         = 0;
-	size64_t mapped_size       = 0;
-	off64_t element_offset     = 0;
-	off64_t mapped_offset      = 0;
-	uint32_t element_flags     = 0;
-	int block_chunk_index      = 0;
-	int element_file_index     = 0;
-	int number_of_block_chunks = 0;
-	int result                 = 0;
-	int segment_index          = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libmodi_internal_handle_open_band_data_files_file_io_pool";
+	size64_t band_data_size          = 0;
+	size64_t file_size               = 0;
+	size64_t media_size              = 0;
+	size64_t sparse_band_data_size   = 0;
+	int file_io_handle_index         = 0;
+	int number_of_file_io_handles    = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -2496,305 +2286,196 @@ int libmodi_internal_handle_open_read(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->band_data_file_io_pool != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - band data file IO pool already exists.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->data_stream != NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - data stream value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
-	     error ) != 1 )
+	if( internal_handle->io_handle->band_data_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing band data size.",
 		 function );
 
-		goto on_error;
-	}
-	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
-	 && ( file_size >= 512 ) )
-	{
-		if( libmodi_internal_handle_open_read_udif_image(
-		     internal_handle,
-		     file_io_handle,
-		     file_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read UDIF image from file IO handle.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
-	 && ( file_size >= 4096 ) )
-	{
-		if( libmodi_internal_handle_open_read_sparse_image(
-		     internal_handle,
-		     file_io_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sparse image from file IO handle.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
-	 && ( file_size < MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
-	{
-		if( libmodi_internal_handle_open_read_sparse_bundle(
-		     internal_handle,
-		     file_io_handle,
-		     file_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sparse bundle from file IO handle.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
 	{
-		if( libmodi_bands_data_handle_initialize(
-		     &( internal_handle->bands_data_handle ),
-		     internal_handle->io_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create bands data handle.",
-			 function );
-
-			goto on_error;
-		}
-		if( libmodi_bands_data_handle_append_segment(
-		     internal_handle->bands_data_handle,
-		     0,
-		     0,
-		     file_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to bands data handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in file IO pool.",
+		 function );
 
-			goto on_error;
-		}
-		internal_handle->io_handle->image_type = LIBMODI_IMAGE_TYPE_RAW;
-		internal_handle->io_handle->media_size = file_size;
-	}
-	if( internal_handle->bands_data_handle != NULL )
-	{
-		result = libfdata_stream_initialize(
-		          &( internal_handle->data_stream ),
-		          (intptr_t *) internal_handle->bands_data_handle,
-		          NULL,
-		          NULL,
-		          NULL,
-		          (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libmodi_bands_data_handle_read_segment_data,
-		          NULL,
-		          (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libmodi_bands_data_handle_seek_segment_offset,
-		          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		          error );
-	}
-	else if( internal_handle->block_chunks_data_handle != NULL )
-	{
-		result = libfdata_stream_initialize(
-		          &( internal_handle->data_stream ),
-		          (intptr_t *) internal_handle->block_chunks_data_handle,
-		          NULL,
-		          NULL,
-		          NULL,
-		          (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libmodi_block_chunks_data_handle_read_segment_data,
-		          NULL,
-		          (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libmodi_block_chunks_data_handle_seek_segment_offset,
-		          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		          error );
-	}
-	else
-	{
-		result = libfdata_stream_initialize(
-		          &( internal_handle->data_stream ),
-		          NULL,
-		          NULL,
-		          NULL,
-		          NULL,
-		          NULL,
-		          NULL,
-		          NULL,
-		          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		          error );
+		return( -1 );
 	}
-	if( result != 1 )
+	if( number_of_file_io_handles != internal_handle->io_handle->number_of_bands )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data stream.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of handles in file IO pool value does not match number of bands.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_handle->block_chunks_data_handle != NULL )
+	media_size = internal_handle->io_handle->media_size;
+
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < number_of_file_io_handles;
+	     file_io_handle_index++ )
 	{
-		if( libfdata_list_get_number_of_elements(
-		     internal_handle->block_chunks_data_handle->block_chunks_list,
-		     &number_of_block_chunks,
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     file_io_handle_index,
+		     &file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of block chunks.",
-			 function );
+			 "%s: unable to retrieve handle: %d from file IO pool.",
+			 function,
+			 file_io_handle_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		for( block_chunk_index = 0;
-		     block_chunk_index < number_of_block_chunks;
-		     block_chunk_index++ )
+		if( file_io_handle == NULL )
 		{
-			if( libfdata_list_get_element_by_index_with_mapped_size(
-			     internal_handle->block_chunks_data_handle->block_chunks_list,
-			     block_chunk_index,
-			     &element_file_index,
-			     &element_offset,
-			     &element_size,
-			     &element_flags,
-			     &mapped_size,
+			band_data_size        = 0;
+			sparse_band_data_size = internal_handle->io_handle->band_data_size;
+		}
+		else
+		{
+			if( libbfio_handle_get_size(
+			     file_io_handle,
+			     &file_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve block chunk: %d.",
+				 "%s: unable to retrieve file size.",
+				 function );
+
+				return( -1 );
+			}
+			if( internal_handle->io_handle->band_data_size < media_size )
+			{
+				sparse_band_data_size = internal_handle->io_handle->band_data_size;
+			}
+			else
+			{
+				sparse_band_data_size = media_size;
+			}
+			if( file_size > sparse_band_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid band data file: %d size value out of bounds.",
 				 function,
-				 block_chunk_index );
+				 file_io_handle_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( libfdata_stream_append_segment(
-			     internal_handle->data_stream,
-			     &segment_index,
+			band_data_size         = file_size;
+			sparse_band_data_size -= file_size;
+		}
+		if( band_data_size > 0 )
+		{
+			if( libmodi_bands_data_handle_append_segment(
+			     internal_handle->bands_data_handle,
+			     file_io_handle_index,
+			     0,
+			     band_data_size,
 			     0,
-			     mapped_offset,
-			     mapped_size,
-			     element_flags,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append segment to data stream.",
-				 function );
+				 "%s: unable to append band data file: %d as segment to bands data handle.",
+				 function,
+				 file_io_handle_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			mapped_offset += mapped_size;
 		}
-	}
-	else
-	{
-		if( libfdata_stream_append_segment(
-		     internal_handle->data_stream,
-		     &segment_index,
-		     0,
-		     0,
-		     internal_handle->io_handle->media_size,
-		     0,
-		     error ) != 1 )
+		if( sparse_band_data_size > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to data stream.",
-			 function );
+			if( libmodi_bands_data_handle_append_segment(
+			     internal_handle->bands_data_handle,
+			     file_io_handle_index,
+			     0,
+			     sparse_band_data_size,
+			     LIBFDATA_RANGE_FLAG_IS_SPARSE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append band data file: %d as sparse segment to bands data handle.",
+				 function,
+				 file_io_handle_index );
 
-			goto on_error;
+				return( -1 );
+			}
 		}
+		media_size -= internal_handle->io_handle->band_data_size;
 	}
-	return( 1 );
+	internal_handle->band_data_file_io_pool = file_io_pool;
 
-on_error:
-	if( internal_handle->data_stream != NULL )
-	{
-		libfdata_stream_free(
-		 &( internal_handle->data_stream ),
-		 NULL );
-	}
-	if( internal_handle->block_chunks_data_handle != NULL )
-	{
-		libmodi_block_chunks_data_handle_free(
-		 &( internal_handle->block_chunks_data_handle ),
-		 NULL );
-	}
-	if( internal_handle->bands_data_handle != NULL )
-	{
-		libmodi_bands_data_handle_free(
-		 &( internal_handle->bands_data_handle ),
-		 NULL );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Opens a handle of a sparse bundle for reading
- * Returns 1 if successful or -1 on error
+/* Reads the bands directory to determine which band data files are present
+ * Returns 1 if successful, 0 if the bands directory could not be opened or -1 on error
  */
-int libmodi_internal_handle_open_read_sparse_bundle(
+int libmodi_internal_handle_read_bands_directory(
      libmodi_internal_handle_t *internal_handle,
-     libbfio_handle_t *file_io_handle,
-     size64_t file_size,
      libcerror_error_t **error )
 {
-	libmodi_sparse_bundle_xml_plist_t *sparse_bundle_xml_plist = NULL;
-	static char *function                                      = "libmodi_internal_handle_open_read_sparse_bundle";
-	int result                                                 = 0;
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	system_character_t *entry_name                   = NULL;
+	static char *function                            = "libmodi_internal_handle_read_bands_directory";
+	size_t name_index                                = 0;
+	size_t present_bitmap_size                       = 0;
+	uint64_t band_index                              = 0;
+	uint8_t character_value                          = 0;
+	uint8_t entry_type                               = 0;
+	int result                                       = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -2807,255 +2488,268 @@ int libmodi_internal_handle_open_read_sparse_bundle(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_handle->io_handle == NULL )
 	{
-		libcnotify_printf(
-		 "Reading info.plist:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libmodi_sparse_bundle_xml_plist_initialize(
-	     &sparse_bundle_xml_plist,
-	     error ) != 1 )
+	if( internal_handle->io_handle->number_of_bands <= 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sparse bundle XML plist",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing number of bands.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libmodi_sparse_bundle_xml_plist_read_file_io_handle(
-	          sparse_bundle_xml_plist,
-	          file_io_handle,
-	          0,
-	          file_size,
-	          error );
+	if( internal_handle->present_band_data_files != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - present band data files already exists.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( internal_handle->bands_directory_path == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read sparse bundle info.plist.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+	          directory,
+	          internal_handle->bands_directory_path,
+	          NULL );
+#else
+	result = libcdirectory_directory_open(
+	          directory,
+	          internal_handle->bands_directory_path,
+	          NULL );
+#endif
+	if( result != 1 )
 	{
-		if( libmodi_bands_data_handle_initialize(
-		     &( internal_handle->bands_data_handle ),
-		     internal_handle->io_handle,
+		if( libcdirectory_directory_free(
+		     &directory,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data handle.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
 			 function );
 
 			goto on_error;
 		}
-		internal_handle->io_handle->image_type      = LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE;
-		internal_handle->io_handle->band_data_size  = (size64_t) sparse_bundle_xml_plist->band_data_size;
-		internal_handle->io_handle->number_of_bands = (int) sparse_bundle_xml_plist->number_of_bands;
-		internal_handle->io_handle->media_size      = (size64_t) sparse_bundle_xml_plist->media_size;
+		return( 0 );
 	}
-	if( libmodi_sparse_bundle_xml_plist_free(
-	     &sparse_bundle_xml_plist,
-	     error ) != 1 )
+	present_bitmap_size = ( (size_t) internal_handle->io_handle->number_of_bands + 7 ) / 8;
+
+	internal_handle->present_band_data_files = (uint8_t *) memory_allocate(
+	                                                        sizeof( uint8_t ) * present_bitmap_size );
+
+	if( internal_handle->present_band_data_files == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free sparse bundle XML plist",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create present band data files.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( internal_handle->bands_data_handle != NULL )
-	{
-		libmodi_bands_data_handle_free(
-		 &( internal_handle->bands_data_handle ),
-		 NULL );
-	}
-	if( sparse_bundle_xml_plist != NULL )
-	{
-		libmodi_sparse_bundle_xml_plist_free(
-		 &sparse_bundle_xml_plist,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Opens a handle of a sparse image for reading
- * Returns 1 if successful or -1 on error
- */
-int libmodi_internal_handle_open_read_sparse_image(
-     libmodi_internal_handle_t *internal_handle,
-     libbfio_handle_t *file_io_handle,
-     libcerror_error_t **error )
-{
-	libmodi_sparse_image_header_t *sparse_image_header = NULL;
-	static char *function                              = "libmodi_internal_handle_open_read_sparse_image";
-	size64_t band_data_size                            = 0;
-	off64_t band_data_offset                           = 0;
-	uint32_t band_data_range_flags                     = 0;
-	uint32_t band_reference                            = 0;
-	uint32_t band_reference_index                      = 0;
-	int result                                         = 0;
-
-	if( internal_handle == NULL )
+	if( memory_set(
+	     internal_handle->present_band_data_files,
+	     0,
+	     sizeof( uint8_t ) * present_bitmap_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear present band data files.",
 		 function );
 
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading sparse image header:\n" );
+		goto on_error;
 	}
-#endif
-	if( libmodi_sparse_image_header_initialize(
-	     &sparse_image_header,
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sparse image header.",
+		 "%s: unable to create directory entry.",
 		 function );
 
 		goto on_error;
 	}
-	result = libmodi_sparse_image_header_read_file_io_handle(
-	          sparse_image_header,
-	          file_io_handle,
-	          0,
-	          error );
-
-	if( result == -1 )
+	do
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read sparse image header at offset: 0 (0x00000000).",
-		 function );
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          error );
 
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		if( libmodi_bands_data_handle_initialize(
-		     &( internal_handle->bands_data_handle ),
-		     internal_handle->io_handle,
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &entry_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data handle.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
 			 function );
 
 			goto on_error;
 		}
-		band_data_size = (size64_t) sparse_image_header->sectors_per_band * 512;
-
-		for( band_reference_index = 0;
-		     band_reference_index < sparse_image_header->number_of_bands;
-		     band_reference_index++ )
+		if( entry_type != LIBCDIRECTORY_ENTRY_TYPE_FILE )
 		{
-			band_reference = sparse_image_header->band_references[ band_reference_index ];
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+		          directory_entry,
+		          &entry_name,
+		          error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+		          directory_entry,
+		          &entry_name,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			goto on_error;
+		}
+		/* The band data files are named after the band index in lower case hexadecimal
+		 * without leading zeros, other directory entries are ignored
+		 */
+		band_index = 0;
+
+		for( name_index = 0;
+		     entry_name[ name_index ] != 0;
+		     name_index++ )
+		{
+			if( ( entry_name[ name_index ] >= (system_character_t) '0' )
+			 && ( entry_name[ name_index ] <= (system_character_t) '9' ) )
 			{
-				libcnotify_printf(
-				 "%s: band reference: %03" PRIu32 "\t\t: 0x%08" PRIx32 "",
-				 function,
-				 band_reference_index,
-				 band_reference );
-
-				if( band_reference == 0xffffffffUL )
-				{
-					libcnotify_printf(
-					 " (sparse)\n" );
-				}
-				else
-				{
-					libcnotify_printf(
-					 " (data offset: 0x%08" PRIx64 ")\n",
-					 4096 + ( band_reference * band_data_size ) );
-				}
+				character_value = (uint8_t) ( entry_name[ name_index ] - (system_character_t) '0' );
 			}
-#endif
-			if( band_reference == 0xffffffffUL )
+			else if( ( entry_name[ name_index ] >= (system_character_t) 'a' )
+			      && ( entry_name[ name_index ] <= (system_character_t) 'f' ) )
 			{
-				band_data_offset      = 0;
-				band_data_range_flags = LIBFDATA_RANGE_FLAG_IS_SPARSE;
+				character_value = (uint8_t) ( entry_name[ name_index ] - (system_character_t) 'a' + 10 );
 			}
 			else
 			{
-				band_data_offset      = 4096 + ( band_reference * band_data_size );
-				band_data_range_flags = 0;
+				break;
 			}
-			if( libmodi_bands_data_handle_append_segment(
-			     internal_handle->bands_data_handle,
-			     0,
-			     band_data_offset,
-			     band_data_size,
-			     band_data_range_flags,
-			     error ) != 1 )
+			if( ( name_index > 0 )
+			 && ( band_index == 0 ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append band reference: %" PRIu32 " as segment to bands data handle.",
-				 function,
-				 band_reference_index );
+				break;
+			}
+			band_index = ( band_index << 4 ) | character_value;
 
-				goto on_error;
+			if( band_index >= (uint64_t) internal_handle->io_handle->number_of_bands )
+			{
+				break;
 			}
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( ( name_index == 0 )
+		 || ( entry_name[ name_index ] != 0 ) )
 		{
-			libcnotify_printf(
-			 "\n" );
+			continue;
 		}
-#endif
-		internal_handle->io_handle->image_type = LIBMODI_IMAGE_TYPE_SPARSE_IMAGE;
-		internal_handle->io_handle->media_size = (size64_t) sparse_image_header->number_of_sectors * 512;
+		internal_handle->present_band_data_files[ band_index / 8 ] |= (uint8_t) ( 1 << ( band_index % 8 ) );
 	}
-	if( libmodi_sparse_image_header_free(
-	     &sparse_image_header,
+	while( result == 1 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to free sparse image header.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
 		 function );
 
 		goto on_error;
@@ -3063,43 +2757,49 @@ int libmodi_internal_handle_open_read_sparse_image(
 	return( 1 );
 
 on_error:
-	if( internal_handle->bands_data_handle != NULL )
+	if( directory_entry != NULL )
 	{
-		libmodi_bands_data_handle_free(
-		 &( internal_handle->bands_data_handle ),
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
 		 NULL );
 	}
-	if( sparse_image_header != NULL )
+	if( directory != NULL )
 	{
-		libmodi_sparse_image_header_free(
-		 &sparse_image_header,
+		libcdirectory_directory_close(
+		 directory,
+		 NULL );
+		libcdirectory_directory_free(
+		 &directory,
 		 NULL );
 	}
+	if( internal_handle->present_band_data_files != NULL )
+	{
+		memory_free(
+		 internal_handle->present_band_data_files );
+
+		internal_handle->present_band_data_files = NULL;
+	}
 	return( -1 );
 }
 
-/* Opens a handle of an UDIF image for reading
+/* Prepares the band data files to be opened on demand
+ * The band data files are expected to be stored in the bands directory
+ * and are opened when a read first touches their range
  * Returns 1 if successful or -1 on error
  */
-int libmodi_internal_handle_open_read_udif_image(
+int libmodi_internal_handle_open_band_data_files_on_demand(
      libmodi_internal_handle_t *internal_handle,
-     libbfio_handle_t *file_io_handle,
-     size64_t file_size,
+     libbfio_pool_t *file_io_pool,
      libcerror_error_t **error )
 {
-	libmodi_udif_block_table_t *block_table             = NULL;
-	libmodi_udif_block_table_entry_t *block_table_entry = NULL;
-	libmodi_udif_resource_file_t *udif_resource_file    = NULL;
-	libmodi_udif_xml_plist_t *udif_xml_plist            = NULL;
-	static char *function                               = "libmodi_internal_handle_open_read_udif_image";
-	uint64_t last_block_entry_sector                    = 0;
-	uint32_t compressed_entry_type                      = 0;
-	uint32_t segment_flags                              = 0;
-	int block_table_entry_index                         = 0;
-	int block_table_index                               = 0;
-	int number_of_block_table_entries                   = 0;
-	int number_of_block_tables                          = 0;
-	int result                                          = 0;
+	static char *function         = "libmodi_internal_handle_open_band_data_files_on_demand";
+	size64_t band_data_size       = 0;
+	size64_t media_size           = 0;
+	size_t resolved_bitmap_size   = 0;
+	uint32_t segment_flags        = 0;
+	uint8_t band_bit              = 0;
+	int band_index                = 0;
+	int number_of_file_io_handles = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -3112,262 +2812,2086 @@ int libmodi_internal_handle_open_read_udif_image(
 
 		return( -1 );
 	}
-	if( internal_handle->block_chunks_data_handle != NULL )
+	if( internal_handle->band_data_file_io_pool != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - block chunks data handle already exists.",
+		 "%s: invalid handle - band data file IO pool already exists.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_handle->resolved_band_data_files != NULL )
 	{
-		libcnotify_printf(
-		 "Reading Universal Disk Image Format (UDIF) resource file:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - resolved band data files already exists.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libmodi_udif_resource_file_initialize(
-	     &udif_resource_file,
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->band_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing band data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_file_io_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create UDIF resource file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in file IO pool.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libmodi_udif_resource_file_read_file_io_handle(
-	          udif_resource_file,
-	          file_io_handle,
-	          file_size - 512,
-	          error );
+	if( number_of_file_io_handles != internal_handle->io_handle->number_of_bands )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of handles in file IO pool value does not match number of bands.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	resolved_bitmap_size = ( (size_t) number_of_file_io_handles + 7 ) / 8;
+
+	internal_handle->resolved_band_data_files = (uint8_t *) memory_allocate(
+	                                                         sizeof( uint8_t ) * resolved_bitmap_size );
+
+	if( internal_handle->resolved_band_data_files == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read UDIF resource file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_size - 512,
-		 file_size - 512 );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resolved band data files.",
+		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	if( memory_set(
+	     internal_handle->resolved_band_data_files,
+	     0,
+	     sizeof( uint8_t ) * resolved_bitmap_size ) == NULL )
 	{
-		if( libmodi_block_chunks_data_handle_initialize(
-		     &( internal_handle->block_chunks_data_handle ),
-		     internal_handle->io_handle,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resolved band data files.",
+		 function );
+
+		goto on_error;
+	}
+	media_size = internal_handle->io_handle->media_size;
+
+	/* Every band is mapped as a single segment of the band data size, data beyond
+	 * the end of a band data file or of a missing band data file is read as sparse
+	 */
+	for( band_index = 0;
+	     band_index < number_of_file_io_handles;
+	     band_index++ )
+	{
+		if( media_size == 0 )
+		{
+			break;
+		}
+		band_data_size = internal_handle->io_handle->band_data_size;
+
+		if( band_data_size > media_size )
+		{
+			band_data_size = media_size;
+		}
+		segment_flags = 0;
+
+		/* Band data files that were not found when reading the bands directory
+		 * are mapped as sparse and do not need to be resolved on read
+		 */
+		if( internal_handle->present_band_data_files != NULL )
+		{
+			band_bit = (uint8_t) ( 1 << ( band_index % 8 ) );
+
+			if( ( internal_handle->present_band_data_files[ band_index / 8 ] & band_bit ) == 0 )
+			{
+				segment_flags = LIBFDATA_RANGE_FLAG_IS_SPARSE;
+
+				internal_handle->resolved_band_data_files[ band_index / 8 ] |= band_bit;
+			}
+		}
+		if( libmodi_bands_data_handle_append_segment(
+		     internal_handle->bands_data_handle,
+		     band_index,
+		     0,
+		     band_data_size,
+		     segment_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create block chunks data handle.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append band data file: %d as segment to bands data handle.",
+			 function,
+			 band_index );
 
 			goto on_error;
 		}
-		if( udif_resource_file->xml_plist_size == 0 )
-		{
-			internal_handle->io_handle->media_size = udif_resource_file->data_fork_size;
-		}
-		else
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "Reading Universal Disk Image Format (UDIF) XML plist:\n" );
-			}
-#endif
-			if( libmodi_udif_xml_plist_initialize(
-			     &udif_xml_plist,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create UDIF XML plist.",
-				 function );
+		media_size -= band_data_size;
+	}
+	internal_handle->band_data_file_io_pool = file_io_pool;
 
-				goto on_error;
-			}
-			result = libmodi_udif_xml_plist_read_file_io_handle(
-				  udif_xml_plist,
-				  file_io_handle,
-				  udif_resource_file->xml_plist_offset,
-				  udif_resource_file->xml_plist_size,
-				  error );
+	return( 1 );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read UDIF XML plist at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 udif_resource_file->xml_plist_offset,
-				 udif_resource_file->xml_plist_offset );
+on_error:
+	if( internal_handle->resolved_band_data_files != NULL )
+	{
+		memory_free(
+		 internal_handle->resolved_band_data_files );
 
-				goto on_error;
-			}
-			internal_handle->io_handle->media_size = 0;
+		internal_handle->resolved_band_data_files = NULL;
+	}
+	return( -1 );
+}
 
-			if( libmodi_udif_xml_plist_get_number_of_block_tables(
-			     udif_xml_plist,
-			     &number_of_block_tables,
-			     error ) != 1 )
+/* Opens the band data files that contain a specific range of the (media) data
+ * if they were not opened before
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_resolve_band_data_files(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_internal_handle_resolve_band_data_files";
+	size64_t end_offset   = 0;
+	uint64_t band_index   = 0;
+	uint64_t last_band    = 0;
+	uint8_t band_bit      = 0;
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->resolved_band_data_files == NULL )
+	 || ( internal_handle->io_handle->band_data_size == 0 )
+	 || ( size == 0 )
+	 || ( (size64_t) offset >= internal_handle->io_handle->media_size ) )
+	{
+		return( 1 );
+	}
+	end_offset = (size64_t) offset + size;
+
+	if( end_offset > internal_handle->io_handle->media_size )
+	{
+		end_offset = internal_handle->io_handle->media_size;
+	}
+	band_index = (uint64_t) offset / internal_handle->io_handle->band_data_size;
+	last_band  = ( end_offset - 1 ) / internal_handle->io_handle->band_data_size;
+
+	while( band_index <= last_band )
+	{
+		if( band_index >= (uint64_t) internal_handle->io_handle->number_of_bands )
+		{
+			break;
+		}
+		band_bit = (uint8_t) ( 1 << ( band_index % 8 ) );
+
+		if( ( internal_handle->resolved_band_data_files[ band_index / 8 ] & band_bit ) == 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libmodi_internal_handle_open_band_data_file_wide(
+				  internal_handle,
+				  internal_handle->band_data_file_io_pool,
+				  (int) band_index,
+				  error );
+#else
+			result = libmodi_internal_handle_open_band_data_file(
+				  internal_handle,
+				  internal_handle->band_data_file_io_pool,
+				  (int) band_index,
+				  error );
+#endif
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of block tables in UDIF XML plist.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open band data file: %" PRIx64 ".",
+				 function,
+				 band_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			for( block_table_index = 0;
-			     block_table_index < number_of_block_tables;
-			     block_table_index++ )
-			{
-				if( libmodi_udif_xml_plist_get_block_table_by_index(
-				     udif_xml_plist,
-				     block_table_index,
-				     &block_table,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve block table: %d from UDIF XML plist.",
-					 function,
-					 block_table_index );
-
-					goto on_error;
-				}
-				if( block_table->start_sector != last_block_entry_sector )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: unsupported block table: %d start sector value out of bounds.",
-					 function,
-					 block_table_index );
+			internal_handle->resolved_band_data_files[ band_index / 8 ] |= band_bit;
+		}
+		band_index++;
+	}
+	return( 1 );
+}
 
-					goto on_error;
-				}
-				if( libmodi_udif_block_table_get_number_of_entries(
-				     block_table,
-				     &number_of_block_table_entries,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve number of entries in block table: %d.",
-					 function,
-					 block_table_index );
+/* Opens a specific band data file
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_open_band_data_file(
+     libmodi_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     int band_index,
+     libcerror_error_t **error )
+{
+	char filename[ 16 ];
 
-					goto on_error;
-				}
-				for( block_table_entry_index = 0;
-				     block_table_entry_index < number_of_block_table_entries;
-				     block_table_entry_index++ )
-				{
-					if( libmodi_udif_block_table_get_entry_by_index(
-					     block_table,
-					     block_table_entry_index,
-					     &block_table_entry,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve entry: %d from block table: %d.",
-						 function,
-						 block_table_entry_index,
-						 block_table_index );
+	libbfio_handle_t *file_io_handle = NULL;
+	char *bands_file_path            = NULL;
+	static char *function            = "libmodi_internal_handle_open_band_data_file";
+	size64_t file_size               = 0;
+	size64_t maximum_file_size       = 0;
+	size_t bands_file_path_size      = 0;
+	size_t filename_length           = 0;
+	int bfio_access_flags            = 0;
+	int result                       = 0;
 
-						goto on_error;
-					}
-					if( block_table_entry->type == 0x7ffffffeUL )
-					{
-						continue;
-					}
-					if( block_table_entry->type == 0xffffffffUL )
-					{
-						break;
-					}
-					if( ( block_table_entry->number_of_sectors == 0 )
-					 || ( block_table_entry->number_of_sectors > ( (uint64_t) INT64_MAX / 512 ) ) )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: unsupported block table: %d entry: %d number of sectors value out of bounds.",
-						 function,
-						 block_table_index,
-						 block_table_entry_index );
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-						goto on_error;
-					}
-					if( block_table_entry->data_offset > (off64_t) INT64_MAX )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: unsupported block table: %d entry: %d data offset value out of bounds.",
-						 function,
-						 block_table_index,
-						 block_table_entry_index );
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
 
-						goto on_error;
-					}
-					if( ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ADC_COMPRESSED )
-					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ZLIB_COMPRESSED )
-					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_BZIP2_COMPRESSED )
-					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZFSE_COMPRESSED )
-					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZMA_COMPRESSED ) )
-					{
-						if( block_table_entry->number_of_sectors > 2048 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: unsupported compressed block table: %d entry: %d number of sectors value out of bounds.",
-							 function,
-							 block_table_index,
-							 block_table_entry_index );
+		return( -1 );
+	}
+	if( ( band_index < 0 )
+	 || ( band_index >= internal_handle->io_handle->number_of_bands ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid band index value out of bounds.",
+		 function );
 
-							goto on_error;
-						}
-						if( compressed_entry_type == 0 )
-						{
-							compressed_entry_type = block_table_entry->type;
-						}
-						else if( compressed_entry_type != block_table_entry->type )
-						{
+		return( -1 );
+	}
+	if( libfvalue_utf8_string_copy_from_integer(
+	     (uint8_t *) filename,
+	     16,
+	     band_index,
+	     SIZEOF_INT * 8,
+	     LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR | LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy band index to string.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libcpath_path_join(
+	     &bands_file_path,
+	     &bands_file_path_size,
+	     (char *) internal_handle->bands_directory_path,
+	     internal_handle->bands_directory_path_size - 1,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bands file: %d path.",
+		 function,
+		 band_index );
+
+		goto on_error;
+	}
+	/* If the bands directory was read the presence of the band data file is already known
+	 */
+	if( internal_handle->present_band_data_files != NULL )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = libcfile_file_exists(
+		          bands_file_path,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if band data file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) != 0 )
+		{
+			bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		}
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libbfio_handle_set_track_offsets_read(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set track offsets read in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     bands_file_path,
+		     bands_file_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_DIRECT_IO ) != 0 )
+		{
+			if( libmodi_internal_handle_open_direct_file(
+			     internal_handle,
+			     bands_file_path,
+			     &file_io_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open direct file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		LIBMODI_STATISTICS_ADD(
+		 internal_handle->io_handle->statistics.number_of_band_file_opens,
+		 1 );
+
+		if( libbfio_handle_get_size(
+		     file_io_handle,
+		     &file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_file_size = (size64_t) band_index * internal_handle->io_handle->band_data_size;
+
+		if( maximum_file_size < internal_handle->io_handle->media_size )
+		{
+			maximum_file_size = internal_handle->io_handle->media_size - maximum_file_size;
+		}
+		else
+		{
+			maximum_file_size = 0;
+		}
+		if( maximum_file_size > internal_handle->io_handle->band_data_size )
+		{
+			maximum_file_size = internal_handle->io_handle->band_data_size;
+		}
+		if( file_size > maximum_file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid band data file: %d size value out of bounds.",
+			 function,
+			 band_index );
+
+			goto on_error;
+		}
+		if( libbfio_pool_set_handle(
+		     file_io_pool,
+		     band_index,
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file IO handle: %d in pool.",
+			 function,
+			 band_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 bands_file_path );
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( bands_file_path != NULL )
+	{
+		memory_free(
+		 bands_file_path );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a specific band data file
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_open_band_data_file_wide(
+     libmodi_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     int band_index,
+     libcerror_error_t **error )
+{
+	wchar_t filename[ 16 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	wchar_t *bands_file_path         = NULL;
+	static char *function            = "libmodi_internal_handle_open_band_data_file_wide";
+	size64_t file_size               = 0;
+	size64_t maximum_file_size       = 0;
+	size_t bands_file_path_size      = 0;
+	size_t filename_length           = 0;
+	int bfio_access_flags            = 0;
+	int result                       = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( band_index < 0 )
+	 || ( band_index >= internal_handle->io_handle->number_of_bands ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid band index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if ( SIZEOF_WCHAR_T == 4 )
+	result = libfvalue_utf32_string_copy_from_integer(
+	          (uint32_t *) filename,
+	          16,
+	          band_index,
+	          SIZEOF_INT * 8,
+	          LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR | LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          error );
+#else
+	result = libfvalue_utf16_string_copy_from_integer(
+	          (uint16_t *) filename,
+	          16,
+	          band_index,
+	          SIZEOF_INT * 8,
+	          LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR | LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy band index to string.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libcpath_path_join_wide(
+	     &bands_file_path,
+	     &bands_file_path_size,
+	     (wchar_t *) internal_handle->bands_directory_path,
+	     internal_handle->bands_directory_path_size - 1,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bands file path.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the bands directory was read the presence of the band data file is already known
+	 */
+	if( internal_handle->present_band_data_files != NULL )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = libcfile_file_exists_wide(
+		          bands_file_path,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if band data file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_READ ) != 0 )
+		{
+			bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		}
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libbfio_handle_set_track_offsets_read(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set track offsets read in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( libbfio_file_set_name_wide(
+		     file_io_handle,
+		     bands_file_path,
+		     bands_file_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( internal_handle->access_flags & LIBMODI_ACCESS_FLAG_DIRECT_IO ) != 0 )
+		{
+			if( libmodi_internal_handle_open_direct_file_wide(
+			     internal_handle,
+			     bands_file_path,
+			     &file_io_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open direct file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		LIBMODI_STATISTICS_ADD(
+		 internal_handle->io_handle->statistics.number_of_band_file_opens,
+		 1 );
+
+		if( libbfio_handle_get_size(
+		     file_io_handle,
+		     &file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_file_size = (size64_t) band_index * internal_handle->io_handle->band_data_size;
+
+		if( maximum_file_size < internal_handle->io_handle->media_size )
+		{
+			maximum_file_size = internal_handle->io_handle->media_size - maximum_file_size;
+		}
+		else
+		{
+			maximum_file_size = 0;
+		}
+		if( maximum_file_size > internal_handle->io_handle->band_data_size )
+		{
+			maximum_file_size = internal_handle->io_handle->band_data_size;
+		}
+		if( file_size > maximum_file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid band data file: %d size value out of bounds.",
+			 function,
+			 band_index );
+
+			goto on_error;
+		}
+		if( libbfio_pool_set_handle(
+		     file_io_pool,
+		     band_index,
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file IO handle: %d in pool.",
+			 function,
+			 band_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 bands_file_path );
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( bands_file_path != NULL )
+	{
+		memory_free(
+		 bands_file_path );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Closes a handle
+ * Returns 0 if successful or -1 on error
+ */
+int libmodi_handle_close(
+     libmodi_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_close";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_handle->file_io_handle_created_in_library != 0 )
+		{
+			if( libmodi_debug_print_read_offsets(
+			     internal_handle->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_handle->band_data_file_io_pool_created_in_library != 0 )
+	{
+		if( libbfio_pool_close_all(
+		     internal_handle->band_data_file_io_pool,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close all files in band data file IO pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_pool_free(
+		     &( internal_handle->band_data_file_io_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free band data file IO pool.",
+			 function );
+
+			result = -1;
+		}
+		internal_handle->band_data_file_io_pool_created_in_library = 0;
+	}
+	internal_handle->band_data_file_io_pool = NULL;
+
+	if( internal_handle->resolved_band_data_files != NULL )
+	{
+		memory_free(
+		 internal_handle->resolved_band_data_files );
+
+		internal_handle->resolved_band_data_files = NULL;
+	}
+	if( internal_handle->present_band_data_files != NULL )
+	{
+		memory_free(
+		 internal_handle->present_band_data_files );
+
+		internal_handle->present_band_data_files = NULL;
+	}
+	if( internal_handle->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_handle->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_handle->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_handle->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_handle->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_handle->file_io_handle_created_in_library = 0;
+	}
+	internal_handle->file_io_handle = NULL;
+
+	if( internal_handle->mapped_file != NULL )
+	{
+		if( libmodi_mapped_file_free(
+		     &( internal_handle->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->extents_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_handle->extents_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmodi_extent_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extents array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->partitions_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_handle->partitions_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmodi_partition_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partitions array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libmodi_io_handle_clear(
+	     internal_handle->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libfdata_stream_free(
+	     &( internal_handle->data_stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data stream.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_handle->bands_data_handle != NULL )
+	{
+		if( libmodi_bands_data_handle_free(
+		     &( internal_handle->bands_data_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free bands data handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		if( libmodi_block_chunks_data_handle_free(
+		     &( internal_handle->block_chunks_data_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block chunks data handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a handle for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_open_read(
+     libmodi_internal_handle_t *internal_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libmodi_internal_handle_open_read";
+	size64_t element_size      = 0;
+	size64_t file_size         = 0;
+	size64_t mapped_size       = 0;
+	off64_t element_offset     = 0;
+	off64_t mapped_offset      = 0;
+	uint32_t element_flags     = 0;
+	int block_chunk_index      = 0;
+	int element_file_index     = 0;
+	int number_of_block_chunks = 0;
+	int result                 = 0;
+	int segment_index          = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->data_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - data stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
+	 && ( file_size >= 512 ) )
+	{
+		if( libmodi_internal_handle_open_read_udif_image(
+		     internal_handle,
+		     file_io_handle,
+		     file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read UDIF image from file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
+	 && ( file_size >= 4096 ) )
+	{
+		if( libmodi_internal_handle_open_read_sparse_image(
+		     internal_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sparse image from file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
+	 && ( file_size < MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		if( libmodi_internal_handle_open_read_sparse_bundle(
+		     internal_handle,
+		     file_io_handle,
+		     file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sparse bundle from file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_UNKNOWN )
+	{
+		if( libmodi_bands_data_handle_initialize(
+		     &( internal_handle->bands_data_handle ),
+		     internal_handle->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create bands data handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmodi_bands_data_handle_append_segment(
+		     internal_handle->bands_data_handle,
+		     0,
+		     0,
+		     file_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment to bands data handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->io_handle->image_type = LIBMODI_IMAGE_TYPE_RAW;
+		internal_handle->io_handle->media_size = file_size;
+	}
+	if( internal_handle->bands_data_handle != NULL )
+	{
+		result = libfdata_stream_initialize(
+		          &( internal_handle->data_stream ),
+		          (intptr_t *) internal_handle->bands_data_handle,
+		          NULL,
+		          NULL,
+		          NULL,
+		          (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libmodi_bands_data_handle_read_segment_data,
+		          NULL,
+		          (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libmodi_bands_data_handle_seek_segment_offset,
+		          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		          error );
+	}
+	else if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		result = libfdata_stream_initialize(
+		          &( internal_handle->data_stream ),
+		          (intptr_t *) internal_handle->block_chunks_data_handle,
+		          NULL,
+		          NULL,
+		          NULL,
+		          (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libmodi_block_chunks_data_handle_read_segment_data,
+		          NULL,
+		          (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libmodi_block_chunks_data_handle_seek_segment_offset,
+		          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		          error );
+	}
+	else
+	{
+		result = libfdata_stream_initialize(
+		          &( internal_handle->data_stream ),
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		if( libfdata_list_get_number_of_elements(
+		     internal_handle->block_chunks_data_handle->block_chunks_list,
+		     &number_of_block_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of block chunks.",
+			 function );
+
+			goto on_error;
+		}
+		for( block_chunk_index = 0;
+		     block_chunk_index < number_of_block_chunks;
+		     block_chunk_index++ )
+		{
+			if( libfdata_list_get_element_by_index_with_mapped_size(
+			     internal_handle->block_chunks_data_handle->block_chunks_list,
+			     block_chunk_index,
+			     &element_file_index,
+			     &element_offset,
+			     &element_size,
+			     &element_flags,
+			     &mapped_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block chunk: %d.",
+				 function,
+				 block_chunk_index );
+
+				goto on_error;
+			}
+			if( libfdata_stream_append_segment(
+			     internal_handle->data_stream,
+			     &segment_index,
+			     0,
+			     mapped_offset,
+			     mapped_size,
+			     element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment to data stream.",
+				 function );
+
+				goto on_error;
+			}
+			mapped_offset += mapped_size;
+		}
+	}
+	else
+	{
+		if( libfdata_stream_append_segment(
+		     internal_handle->data_stream,
+		     &segment_index,
+		     0,
+		     0,
+		     internal_handle->io_handle->media_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment to data stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_handle->maximum_cache_size > 0 )
+	{
+		if( libmodi_internal_handle_set_maximum_cache_size(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum cache size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( internal_handle->data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &( internal_handle->data_stream ),
+		 NULL );
+	}
+	if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		libmodi_block_chunks_data_handle_free(
+		 &( internal_handle->block_chunks_data_handle ),
+		 NULL );
+	}
+	if( internal_handle->bands_data_handle != NULL )
+	{
+		libmodi_bands_data_handle_free(
+		 &( internal_handle->bands_data_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a handle of a sparse bundle for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_open_read_sparse_bundle(
+     libmodi_internal_handle_t *internal_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	libmodi_sparse_bundle_xml_plist_t *sparse_bundle_xml_plist = NULL;
+	static char *function                                      = "libmodi_internal_handle_open_read_sparse_bundle";
+	int result                                                 = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading info.plist:\n" );
+	}
+#endif
+	if( libmodi_sparse_bundle_xml_plist_initialize(
+	     &sparse_bundle_xml_plist,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sparse bundle XML plist",
+		 function );
+
+		goto on_error;
+	}
+	result = libmodi_sparse_bundle_xml_plist_read_file_io_handle(
+	          sparse_bundle_xml_plist,
+	          file_io_handle,
+	          0,
+	          file_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sparse bundle info.plist.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libmodi_bands_data_handle_initialize(
+		     &( internal_handle->bands_data_handle ),
+		     internal_handle->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->io_handle->image_type      = LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE;
+		internal_handle->io_handle->band_data_size  = (size64_t) sparse_bundle_xml_plist->band_data_size;
+		internal_handle->io_handle->number_of_bands = (int) sparse_bundle_xml_plist->number_of_bands;
+		internal_handle->io_handle->media_size      = (size64_t) sparse_bundle_xml_plist->media_size;
+	}
+	if( libmodi_sparse_bundle_xml_plist_free(
+	     &sparse_bundle_xml_plist,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sparse bundle XML plist",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_handle->bands_data_handle != NULL )
+	{
+		libmodi_bands_data_handle_free(
+		 &( internal_handle->bands_data_handle ),
+		 NULL );
+	}
+	if( sparse_bundle_xml_plist != NULL )
+	{
+		libmodi_sparse_bundle_xml_plist_free(
+		 &sparse_bundle_xml_plist,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a handle of a sparse image for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_open_read_sparse_image(
+     libmodi_internal_handle_t *internal_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libmodi_sparse_image_header_t *sparse_image_header = NULL;
+	static char *function                              = "libmodi_internal_handle_open_read_sparse_image";
+	size64_t band_data_size                            = 0;
+	off64_t band_data_offset                           = 0;
+	uint32_t band_data_range_flags                     = 0;
+	uint32_t band_reference                            = 0;
+	uint32_t band_reference_index                      = 0;
+	int result                                         = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading sparse image header:\n" );
+	}
+#endif
+	if( libmodi_sparse_image_header_initialize(
+	     &sparse_image_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sparse image header.",
+		 function );
+
+		goto on_error;
+	}
+	result = libmodi_sparse_image_header_read_file_io_handle(
+	          sparse_image_header,
+	          file_io_handle,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sparse image header at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libmodi_bands_data_handle_initialize(
+		     &( internal_handle->bands_data_handle ),
+		     internal_handle->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data handle.",
+			 function );
+
+			goto on_error;
+		}
+		band_data_size = (size64_t) sparse_image_header->sectors_per_band * 512;
+
+		for( band_reference_index = 0;
+		     band_reference_index < sparse_image_header->number_of_bands;
+		     band_reference_index++ )
+		{
+			band_reference = sparse_image_header->band_references[ band_reference_index ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: band reference: %03" PRIu32 "\t\t: 0x%08" PRIx32 "",
+				 function,
+				 band_reference_index,
+				 band_reference );
+
+				if( band_reference == 0xffffffffUL )
+				{
+					libcnotify_printf(
+					 " (sparse)\n" );
+				}
+				else
+				{
+					libcnotify_printf(
+					 " (data offset: 0x%08" PRIx64 ")\n",
+					 4096 + ( band_reference * band_data_size ) );
+				}
+			}
+#endif
+			if( band_reference == 0xffffffffUL )
+			{
+				band_data_offset      = 0;
+				band_data_range_flags = LIBFDATA_RANGE_FLAG_IS_SPARSE;
+			}
+			else
+			{
+				band_data_offset      = 4096 + ( band_reference * band_data_size );
+				band_data_range_flags = 0;
+			}
+			if( libmodi_bands_data_handle_append_segment(
+			     internal_handle->bands_data_handle,
+			     0,
+			     band_data_offset,
+			     band_data_size,
+			     band_data_range_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append band reference: %" PRIu32 " as segment to bands data handle.",
+				 function,
+				 band_reference_index );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		internal_handle->io_handle->image_type     = LIBMODI_IMAGE_TYPE_SPARSE_IMAGE;
+		internal_handle->io_handle->band_data_size = band_data_size;
+		internal_handle->io_handle->media_size     = (size64_t) sparse_image_header->number_of_sectors * 512;
+	}
+	if( libmodi_sparse_image_header_free(
+	     &sparse_image_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to free sparse image header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_handle->bands_data_handle != NULL )
+	{
+		libmodi_bands_data_handle_free(
+		 &( internal_handle->bands_data_handle ),
+		 NULL );
+	}
+	if( sparse_image_header != NULL )
+	{
+		libmodi_sparse_image_header_free(
+		 &sparse_image_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a handle of an UDIF image for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_open_read_udif_image(
+     libmodi_internal_handle_t *internal_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	libmodi_partition_t *partition                      = NULL;
+	libmodi_udif_block_table_t *block_table             = NULL;
+	libmodi_udif_block_table_entry_t *block_table_entry = NULL;
+	libmodi_udif_resource_file_t *udif_resource_file    = NULL;
+	libmodi_udif_xml_plist_t *udif_xml_plist            = NULL;
+	static char *function                               = "libmodi_internal_handle_open_read_udif_image";
+	uint64_t last_block_entry_sector                    = 0;
+	uint32_t compressed_entry_type                      = 0;
+	uint32_t segment_flags                              = 0;
+	int block_table_entry_index                         = 0;
+	int block_table_index                               = 0;
+	int entry_index                                     = 0;
+	int number_of_block_table_entries                   = 0;
+	int number_of_block_tables                          = 0;
+	int result                                          = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - block chunks data handle already exists.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->partitions_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - partitions array already exists.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading Universal Disk Image Format (UDIF) resource file:\n" );
+	}
+#endif
+	if( libmodi_udif_resource_file_initialize(
+	     &udif_resource_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create UDIF resource file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libmodi_udif_resource_file_read_file_io_handle(
+	          udif_resource_file,
+	          file_io_handle,
+	          file_size - 512,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read UDIF resource file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_size - 512,
+		 file_size - 512 );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libmodi_block_chunks_data_handle_initialize(
+		     &( internal_handle->block_chunks_data_handle ),
+		     internal_handle->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block chunks data handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( udif_resource_file->xml_plist_size == 0 )
+		{
+			internal_handle->io_handle->media_size = udif_resource_file->data_fork_size;
+		}
+		else
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading Universal Disk Image Format (UDIF) XML plist:\n" );
+			}
+#endif
+			if( libmodi_udif_xml_plist_initialize(
+			     &udif_xml_plist,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create UDIF XML plist.",
+				 function );
+
+				goto on_error;
+			}
+			result = libmodi_udif_xml_plist_read_file_io_handle(
+				  udif_xml_plist,
+				  file_io_handle,
+				  udif_resource_file->xml_plist_offset,
+				  udif_resource_file->xml_plist_size,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read UDIF XML plist at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 udif_resource_file->xml_plist_offset,
+				 udif_resource_file->xml_plist_offset );
+
+				goto on_error;
+			}
+			internal_handle->io_handle->media_size = 0;
+
+			if( libcdata_array_initialize(
+			     &( internal_handle->partitions_array ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partitions array.",
+				 function );
+
+				goto on_error;
+			}
+			if( libmodi_udif_xml_plist_get_number_of_block_tables(
+			     udif_xml_plist,
+			     &number_of_block_tables,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of block tables in UDIF XML plist.",
+				 function );
+
+				goto on_error;
+			}
+			for( block_table_index = 0;
+			     block_table_index < number_of_block_tables;
+			     block_table_index++ )
+			{
+				if( libmodi_udif_xml_plist_get_block_table_by_index(
+				     udif_xml_plist,
+				     block_table_index,
+				     &block_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve block table: %d from UDIF XML plist.",
+					 function,
+					 block_table_index );
+
+					goto on_error;
+				}
+				if( block_table->start_sector != last_block_entry_sector )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: unsupported block table: %d start sector value out of bounds.",
+					 function,
+					 block_table_index );
+
+					goto on_error;
+				}
+				if( libmodi_udif_block_table_get_number_of_entries(
+				     block_table,
+				     &number_of_block_table_entries,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of entries in block table: %d.",
+					 function,
+					 block_table_index );
+
+					goto on_error;
+				}
+				for( block_table_entry_index = 0;
+				     block_table_entry_index < number_of_block_table_entries;
+				     block_table_entry_index++ )
+				{
+					if( libmodi_udif_block_table_get_entry_by_index(
+					     block_table,
+					     block_table_entry_index,
+					     &block_table_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve entry: %d from block table: %d.",
+						 function,
+						 block_table_entry_index,
+						 block_table_index );
+
+						goto on_error;
+					}
+					if( block_table_entry->type == 0x7ffffffeUL )
+					{
+						continue;
+					}
+					if( block_table_entry->type == 0xffffffffUL )
+					{
+						break;
+					}
+					if( ( block_table_entry->number_of_sectors == 0 )
+					 || ( block_table_entry->number_of_sectors > ( (uint64_t) INT64_MAX / 512 ) ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: unsupported block table: %d entry: %d number of sectors value out of bounds.",
+						 function,
+						 block_table_index,
+						 block_table_entry_index );
+
+						goto on_error;
+					}
+					if( block_table_entry->data_offset > (off64_t) INT64_MAX )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: unsupported block table: %d entry: %d data offset value out of bounds.",
+						 function,
+						 block_table_index,
+						 block_table_entry_index );
+
+						goto on_error;
+					}
+					if( ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ADC_COMPRESSED )
+					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ZLIB_COMPRESSED )
+					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_BZIP2_COMPRESSED )
+					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZFSE_COMPRESSED )
+					 || ( block_table_entry->type == LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZMA_COMPRESSED ) )
+					{
+						if( block_table_entry->number_of_sectors > 2048 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: unsupported compressed block table: %d entry: %d number of sectors value out of bounds.",
+							 function,
+							 block_table_index,
+							 block_table_entry_index );
+
+							goto on_error;
+						}
+						if( compressed_entry_type == 0 )
+						{
+							compressed_entry_type = block_table_entry->type;
+						}
+						else if( compressed_entry_type != block_table_entry->type )
+						{
 							libcerror_error_set(
 							 error,
 							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
@@ -3375,168 +4899,2113 @@ int libmodi_internal_handle_open_read_udif_image(
 							 "%s: mixed compressed block table entry types not supported.",
 							 function );
 
-							goto on_error;
-						}
-						segment_flags = LIBFDATA_RANGE_FLAG_IS_COMPRESSED;
-					}
-					else if( ( block_table_entry->type == 0x00000000UL )
-					      || ( block_table_entry->type == 0x00000002UL ) )
-					{
-						segment_flags = LIBFDATA_RANGE_FLAG_IS_SPARSE;
-					}
-					else if( block_table_entry->type == 0x00000001UL )
-					{
-						segment_flags = 0;
-					}
-					else
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-						 "%s: unsupported block table: %d entry: %d type.",
-						 function,
-						 block_table_index,
-						 block_table_entry_index );
+							goto on_error;
+						}
+						segment_flags = LIBFDATA_RANGE_FLAG_IS_COMPRESSED;
+					}
+					else if( ( block_table_entry->type == 0x00000000UL )
+					      || ( block_table_entry->type == 0x00000002UL ) )
+					{
+						segment_flags = LIBFDATA_RANGE_FLAG_IS_SPARSE;
+					}
+					else if( block_table_entry->type == 0x00000001UL )
+					{
+						segment_flags = 0;
+					}
+					else
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+						 "%s: unsupported block table: %d entry: %d type.",
+						 function,
+						 block_table_index,
+						 block_table_entry_index );
+
+						goto on_error;
+					}
+					if( ( block_table_entry->start_sector > ( ( (uint64_t) INT64_MAX / 512 ) - block_table->start_sector ) )
+					 || ( ( block_table->start_sector + block_table_entry->start_sector ) != last_block_entry_sector ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: unsupported block table: %d entry: %d start sector value out of bounds.",
+						 function,
+						 block_table_index,
+						 block_table_entry_index );
+
+						goto on_error;
+					}
+					if( libmodi_block_chunks_data_handle_append_segment(
+					     internal_handle->block_chunks_data_handle,
+					     0,
+					     block_table_entry->data_offset,
+					     block_table_entry->data_size,
+					     segment_flags,
+					     block_table_entry->number_of_sectors * 512,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append block table: %d entry: %d as segment to block chunks data handle.",
+						 function,
+						 block_table_index,
+						 block_table_entry_index );
+
+						goto on_error;
+					}
+					last_block_entry_sector += block_table_entry->number_of_sectors;
+				}
+				/* Every block table describes a partition, the sectors of which
+				 * are the sectors of the block table entries read above
+				 */
+				if( libmodi_partition_initialize(
+				     &partition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create partition: %d.",
+					 function,
+					 block_table_index );
+
+					goto on_error;
+				}
+				partition->offset     = (off64_t) ( block_table->start_sector * 512 );
+				partition->size       = (size64_t) ( last_block_entry_sector - block_table->start_sector ) * 512;
+				partition->identifier = block_table->identifier;
+				partition->attributes = block_table->attributes;
+
+				if( block_table->name != NULL )
+				{
+					if( libmodi_partition_set_name(
+					     partition,
+					     block_table->name,
+					     block_table->name_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set partition: %d name.",
+						 function,
+						 block_table_index );
+
+						goto on_error;
+					}
+				}
+				if( libcdata_array_append_entry(
+				     internal_handle->partitions_array,
+				     &entry_index,
+				     (intptr_t *) partition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append partition: %d to array.",
+					 function,
+					 block_table_index );
+
+					goto on_error;
+				}
+				partition = NULL;
+			}
+			internal_handle->io_handle->media_size = last_block_entry_sector * 512;
+
+			if( libmodi_udif_xml_plist_free(
+			     &udif_xml_plist,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to free UDIF XML plist.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( compressed_entry_type == 0 )
+		{
+			internal_handle->io_handle->image_type = LIBMODI_IMAGE_TYPE_UDIF_UNCOMPRESSED;
+		}
+		else
+		{
+			switch( compressed_entry_type )
+			{
+				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ADC_COMPRESSED:
+					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_ADC;
+					break;
+
+				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ZLIB_COMPRESSED:
+					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_DEFLATE;
+					break;
+
+				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_BZIP2_COMPRESSED:
+					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_BZIP2;
+					break;
+
+				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZFSE_COMPRESSED:
+					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_LZFSE;
+					break;
+
+				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZMA_COMPRESSED:
+					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_LZMA;
+					break;
+			}
+			internal_handle->io_handle->image_type = LIBMODI_IMAGE_TYPE_UDIF_COMPRESSED;
+		}
+	}
+	if( libmodi_udif_resource_file_free(
+	     &udif_resource_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to free UDIF resource file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( internal_handle->partitions_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_handle->partitions_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmodi_partition_free,
+		 NULL );
+	}
+	if( udif_xml_plist != NULL )
+	{
+		libmodi_udif_xml_plist_free(
+		 &udif_xml_plist,
+		 NULL );
+	}
+	if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		libmodi_block_chunks_data_handle_free(
+		 &( internal_handle->block_chunks_data_handle ),
+		 NULL );
+	}
+	if( udif_resource_file != NULL )
+	{
+		libmodi_udif_resource_file_free(
+		 &udif_resource_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads (media) data from the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libmodi_handle_read_buffer(
+         libmodi_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	intptr_t *file_io_handle                   = NULL;
+	static char *function                      = "libmodi_handle_read_buffer";
+	ssize_t read_count                         = 0;
+	off64_t current_offset                     = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	 && ( internal_handle->band_data_file_io_pool == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing band data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->resolved_band_data_files != NULL )
+	{
+		if( libfdata_stream_get_offset(
+		     internal_handle->data_stream,
+		     &current_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmodi_internal_handle_resolve_band_data_files(
+		     internal_handle,
+		     current_offset,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open band data files.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	{
+		file_io_handle = (intptr_t *) internal_handle->band_data_file_io_pool;
+	}
+	else
+	{
+		file_io_handle = (intptr_t *) internal_handle->file_io_handle;
+	}
+	read_count = libfdata_stream_read_buffer(
+		      internal_handle->data_stream,
+		      file_io_handle,
+		      buffer,
+		      buffer_size,
+		      0,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	LIBMODI_STATISTICS_ADD_READ(
+	 &( internal_handle->io_handle->statistics ),
+	 (size_t) read_count );
+
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads (media) data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libmodi_handle_read_buffer_at_offset(
+         libmodi_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	intptr_t *file_io_handle                   = NULL;
+	static char *function                      = "libmodi_handle_read_buffer_at_offset";
+	ssize_t read_count                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	 && ( internal_handle->band_data_file_io_pool == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing band data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmodi_internal_handle_resolve_band_data_files(
+	     internal_handle,
+	     offset,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open band data files.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	{
+		file_io_handle = (intptr_t *) internal_handle->band_data_file_io_pool;
+	}
+	else
+	{
+		file_io_handle = (intptr_t *) internal_handle->file_io_handle;
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+		      internal_handle->data_stream,
+		      file_io_handle,
+		      buffer,
+		      buffer_size,
+		      offset,
+		      0,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	LIBMODI_STATISTICS_ADD_READ(
+	 &( internal_handle->io_handle->statistics ),
+	 (size_t) read_count );
+
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the memory mapped data of the (media) data at a specific offset
+ * The data is only available if the handle was opened with LIBMODI_ACCESS_FLAG_MEMORY_MAPPED
+ * and the (media) data at the offset is stored uncompressed and non-sparse in the image file
+ * The data remains valid until the handle is closed
+ * Returns 1 if successful, 0 if no mapped data is available or -1 on error
+ */
+int libmodi_handle_get_mapped_data_at_offset(
+     libmodi_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_get_mapped_data_at_offset";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libmodi_internal_handle_get_mapped_data_at_offset(
+	          internal_handle,
+	          offset,
+	          size,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+	}
+	else if( ( result == 1 )
+	      && ( internal_handle->io_handle != NULL ) )
+	{
+		LIBMODI_STATISTICS_ADD_READ(
+		 &( internal_handle->io_handle->statistics ),
+		 *data_size );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the memory mapped data of the (media) data at a specific offset
+ * Returns 1 if successful, 0 if no mapped data is available or -1 on error
+ */
+int libmodi_internal_handle_get_mapped_data_at_offset(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libmodi_internal_handle_get_mapped_data_at_offset";
+	size64_t available_size     = 0;
+	size64_t mapped_size        = 0;
+	size64_t segment_size       = 0;
+	off64_t element_data_offset = 0;
+	off64_t file_offset         = 0;
+	off64_t segment_offset      = 0;
+	uint32_t segment_flags      = 0;
+	int element_index           = 0;
+	int segment_file_index      = 0;
+	int segment_index           = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->mapped_file == NULL )
+	 || ( internal_handle->mapped_file->data == NULL )
+	 || ( size == 0 )
+	 || ( (size64_t) offset >= internal_handle->io_handle->media_size ) )
+	{
+		return( 0 );
+	}
+	switch( internal_handle->io_handle->image_type )
+	{
+		case LIBMODI_IMAGE_TYPE_RAW:
+			file_offset    = offset;
+			available_size = internal_handle->io_handle->media_size - (size64_t) offset;
+			break;
+
+		case LIBMODI_IMAGE_TYPE_SPARSE_IMAGE:
+			if( internal_handle->io_handle->band_data_size == 0 )
+			{
+				return( 0 );
+			}
+			segment_index = (int) ( (size64_t) offset / internal_handle->io_handle->band_data_size );
+
+			if( libfdata_vector_get_segment_by_index(
+			     internal_handle->bands_data_handle->bands_vector,
+			     segment_index,
+			     &segment_file_index,
+			     &segment_offset,
+			     &segment_size,
+			     &segment_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve band: %d.",
+				 function,
+				 segment_index );
+
+				return( -1 );
+			}
+			element_data_offset = (off64_t) ( (size64_t) offset % internal_handle->io_handle->band_data_size );
+
+			if( ( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+			 || ( (size64_t) element_data_offset >= segment_size ) )
+			{
+				return( 0 );
+			}
+			file_offset    = segment_offset + element_data_offset;
+			available_size = segment_size - (size64_t) element_data_offset;
+			break;
+
+		case LIBMODI_IMAGE_TYPE_UDIF_UNCOMPRESSED:
+			if( libfdata_list_get_element_index_at_offset(
+			     internal_handle->block_chunks_data_handle->block_chunks_list,
+			     offset,
+			     &element_index,
+			     &element_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block chunk index at offset: %" PRIi64 ".",
+				 function,
+				 offset );
+
+				return( -1 );
+			}
+			if( libfdata_list_get_element_by_index_with_mapped_size(
+			     internal_handle->block_chunks_data_handle->block_chunks_list,
+			     element_index,
+			     &segment_file_index,
+			     &segment_offset,
+			     &segment_size,
+			     &segment_flags,
+			     &mapped_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block chunk: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( segment_size > mapped_size )
+			{
+				segment_size = mapped_size;
+			}
+			if( ( ( segment_flags & ( LIBFDATA_RANGE_FLAG_IS_SPARSE | LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) ) != 0 )
+			 || ( element_data_offset < 0 )
+			 || ( (size64_t) element_data_offset >= segment_size ) )
+			{
+				return( 0 );
+			}
+			file_offset    = segment_offset + element_data_offset;
+			available_size = segment_size - (size64_t) element_data_offset;
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( ( file_offset < 0 )
+	 || ( (size64_t) file_offset >= (size64_t) internal_handle->mapped_file->data_size ) )
+	{
+		return( 0 );
+	}
+	if( available_size > (size64_t) ( internal_handle->mapped_file->data_size - (size_t) file_offset ) )
+	{
+		available_size = (size64_t) ( internal_handle->mapped_file->data_size - (size_t) file_offset );
+	}
+	if( available_size > (size64_t) size )
+	{
+		available_size = (size64_t) size;
+	}
+	*data      = &( internal_handle->mapped_file->data[ file_offset ] );
+	*data_size = (size_t) available_size;
+
+	return( 1 );
+}
+
+/* Seeks a certain offset of the (media) data
+ * The whence value can be SEEK_SET, SEEK_CUR, SEEK_END, LIBMODI_SEEK_DATA or LIBMODI_SEEK_HOLE
+ * LIBMODI_SEEK_DATA and LIBMODI_SEEK_HOLE seek the next data or hole at or after the offset
+ * where the end of the (media) data is considered a hole
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libmodi_handle_seek_offset(
+         libmodi_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_seek_offset";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( whence == LIBMODI_SEEK_DATA )
+	 || ( whence == LIBMODI_SEEK_HOLE ) )
+	{
+		result = libmodi_internal_handle_get_data_or_hole_offset(
+		          internal_handle,
+		          offset,
+		          whence,
+		          &offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine data or hole offset.",
+			 function );
+
+			offset = -1;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: no data at or after offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			offset = -1;
+		}
+		whence = SEEK_SET;
+	}
+	if( offset != -1 )
+	{
+		offset = libfdata_stream_seek_offset(
+		          internal_handle->data_stream,
+		          offset,
+		          whence,
+		          error );
+
+		if( offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset of the (media) data
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_handle_get_offset(
+     libmodi_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_get_offset";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfdata_stream_get_offset(
+	     internal_handle->data_stream,
+	     offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum number of (concurrent) open file handles
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_handle_set_maximum_number_of_open_handles(
+     libmodi_handle_t *handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_set_maximum_number_of_open_handles";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->band_data_file_io_pool != NULL )
+	{
+		result = libbfio_pool_set_maximum_number_of_open_handles(
+		          internal_handle->band_data_file_io_pool,
+		          maximum_number_of_open_handles,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles in band data file IO pool.",
+			 function );
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum cache size
+ * The maximum cache size limits the combined size of the cached data blocks,
+ * a maximum cache size of 0 uses the default number of cache entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_handle_set_maximum_cache_size(
+     libmodi_handle_t *handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_set_maximum_cache_size";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->maximum_cache_size = maximum_cache_size;
+
+	if( libmodi_internal_handle_set_maximum_cache_size(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Applies the maximum cache size to the caches of the data handles
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_set_maximum_cache_size(
+     libmodi_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_internal_handle_set_maximum_cache_size";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->bands_data_handle != NULL )
+	{
+		if( libmodi_bands_data_handle_set_maximum_cache_size(
+		     internal_handle->bands_data_handle,
+		     internal_handle->maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum cache size of bands data handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		if( libmodi_block_chunks_data_handle_set_maximum_cache_size(
+		     internal_handle->block_chunks_data_handle,
+		     internal_handle->maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum cache size of block chunks data handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the path to the band data files
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_handle_set_band_data_files_path(
+     libmodi_handle_t *handle,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_set_band_data_files_path";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	{
+		if( libmodi_internal_handle_set_bands_directory_path(
+		     internal_handle,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set bands directory path.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the path to the band data files
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_handle_set_band_data_files_path_wide(
+     libmodi_handle_t *handle,
+     const wchar_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_set_band_data_files_path_wide";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	{
+		if( libmodi_internal_handle_set_bands_directory_path_wide(
+		     internal_handle,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set bands directory path.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the media size
+ * Returns the 1 if successful or -1 on error
+ */
+int libmodi_handle_get_media_size(
+     libmodi_handle_t *handle,
+     size64_t *media_size,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_get_media_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*media_size = internal_handle->io_handle->media_size;
+
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the image type
+ * Returns the 1 if successful or -1 on error
+ */
+int libmodi_handle_get_image_type(
+     libmodi_handle_t *handle,
+     int *image_type,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_get_image_type";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*image_type = internal_handle->io_handle->image_type;
+
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific statistics value
+ * The statistics are accumulated from when the handle was opened
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmodi_handle_get_statistics_value(
+     libmodi_handle_t *handle,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_get_statistics_value";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-						goto on_error;
-					}
-					if( ( block_table_entry->start_sector > ( ( (uint64_t) INT64_MAX / 512 ) - block_table->start_sector ) )
-					 || ( ( block_table->start_sector + block_table_entry->start_sector ) != last_block_entry_sector ) )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: unsupported block table: %d entry: %d start sector value out of bounds.",
-						 function,
-						 block_table_index,
-						 block_table_entry_index );
+		return( -1 );
+	}
+	internal_handle = (libmodi_internal_handle_t *) handle;
 
-						goto on_error;
-					}
-					if( libmodi_block_chunks_data_handle_append_segment(
-					     internal_handle->block_chunks_data_handle,
-					     0,
-					     block_table_entry->data_offset,
-					     block_table_entry->data_size,
-					     segment_flags,
-					     block_table_entry->number_of_sectors * 512,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append block table: %d entry: %d as segment to block chunks data handle.",
-						 function,
-						 block_table_index,
-						 block_table_entry_index );
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
 
-						goto on_error;
-					}
-					last_block_entry_sector += block_table_entry->number_of_sectors;
-				}
+		return( -1 );
+	}
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libmodi_statistics_get_value(
+	          &( internal_handle->io_handle->statistics ),
+	          value_type,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics value: %d.",
+		 function,
+		 value_type );
+	}
+#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends an extent to the extents array
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_append_extent(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     size64_t stored_size,
+     int compression_method,
+     uint32_t flags,
+     libcerror_error_t **error )
+{
+	libmodi_extent_t *extent = NULL;
+	static char *function    = "libmodi_internal_handle_append_extent";
+	int entry_index          = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmodi_extent_initialize(
+	     &extent,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent.",
+		 function );
+
+		goto on_error;
+	}
+	extent->offset             = offset;
+	extent->size               = size;
+	extent->stored_size        = stored_size;
+	extent->compression_method = compression_method;
+	extent->flags              = flags;
+
+	if( libcdata_array_append_entry(
+	     internal_handle->extents_array,
+	     &entry_index,
+	     (intptr_t *) extent,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append extent to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libmodi_extent_free(
+		 &extent,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the extents of the (media) data from the bands vector or the block chunks list
+ * Every band data segment or block chunk is represented by an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_internal_handle_read_extents(
+     libmodi_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "libmodi_internal_handle_read_extents";
+	size64_t mapped_size   = 0;
+	size64_t segment_size  = 0;
+	size64_t stored_size   = 0;
+	off64_t mapped_offset  = 0;
+	off64_t segment_offset = 0;
+	uint32_t extent_flags  = 0;
+	uint32_t segment_flags = 0;
+	int compression_method = 0;
+	int number_of_segments = 0;
+	int segment_file_index = 0;
+	int segment_index      = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->extents_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - extents array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->extents_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents array.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->bands_data_handle != NULL )
+	{
+		if( libfdata_vector_get_number_of_segments(
+		     internal_handle->bands_data_handle->bands_vector,
+		     &number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of bands.",
+			 function );
+
+			goto on_error;
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			if( (size64_t) mapped_offset >= internal_handle->io_handle->media_size )
+			{
+				break;
 			}
-			internal_handle->io_handle->media_size = last_block_entry_sector * 512;
+			if( libfdata_vector_get_segment_by_index(
+			     internal_handle->bands_data_handle->bands_vector,
+			     segment_index,
+			     &segment_file_index,
+			     &segment_offset,
+			     &segment_size,
+			     &segment_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve band: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+			/* The last band of a sparse image can extend beyond the media size
+			 */
+			mapped_size = internal_handle->io_handle->media_size - (size64_t) mapped_offset;
 
-			if( libmodi_udif_xml_plist_free(
-			     &udif_xml_plist,
+			if( segment_size < mapped_size )
+			{
+				mapped_size = segment_size;
+			}
+			/* The extents are determined from the presence of the band data files
+			 * without opening them, where the presence of a band data file opened
+			 * on demand is only known if the bands directory could be read
+			 */
+			if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+			{
+				extent_flags = LIBMODI_EXTENT_FLAG_IS_SPARSE;
+				stored_size  = 0;
+			}
+			else
+			{
+				extent_flags = 0;
+				stored_size  = mapped_size;
+			}
+			if( libmodi_internal_handle_append_extent(
+			     internal_handle,
+			     mapped_offset,
+			     mapped_size,
+			     stored_size,
+			     LIBMODI_COMPRESSION_METHOD_NONE,
+			     extent_flags,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to free UDIF XML plist.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extent of band: %d.",
+				 function,
+				 segment_index );
 
 				goto on_error;
 			}
+			mapped_offset += (off64_t) mapped_size;
 		}
-		if( compressed_entry_type == 0 )
+	}
+	else if( internal_handle->block_chunks_data_handle != NULL )
+	{
+		if( libfdata_list_get_number_of_elements(
+		     internal_handle->block_chunks_data_handle->block_chunks_list,
+		     &number_of_segments,
+		     error ) != 1 )
 		{
-			internal_handle->io_handle->image_type = LIBMODI_IMAGE_TYPE_UDIF_UNCOMPRESSED;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of block chunks.",
+			 function );
+
+			goto on_error;
 		}
-		else
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
 		{
-			switch( compressed_entry_type )
+			if( libfdata_list_get_element_by_index_with_mapped_size(
+			     internal_handle->block_chunks_data_handle->block_chunks_list,
+			     segment_index,
+			     &segment_file_index,
+			     &segment_offset,
+			     &segment_size,
+			     &segment_flags,
+			     &mapped_size,
+			     error ) != 1 )
 			{
-				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ADC_COMPRESSED:
-					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_ADC;
-					break;
-
-				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_ZLIB_COMPRESSED:
-					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_DEFLATE;
-					break;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block chunk: %d.",
+				 function,
+				 segment_index );
 
-				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_BZIP2_COMPRESSED:
-					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_BZIP2;
-					break;
+				goto on_error;
+			}
+			compression_method = LIBMODI_COMPRESSION_METHOD_NONE;
 
-				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZFSE_COMPRESSED:
-					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_LZFSE;
-					break;
+			if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+			{
+				extent_flags = LIBMODI_EXTENT_FLAG_IS_SPARSE;
+				stored_size  = 0;
+			}
+			else if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+			{
+				extent_flags       = LIBMODI_EXTENT_FLAG_IS_COMPRESSED;
+				stored_size        = segment_size;
+				compression_method = internal_handle->io_handle->compression_method;
+			}
+			else
+			{
+				extent_flags = 0;
+				stored_size  = segment_size;
+			}
+			if( libmodi_internal_handle_append_extent(
+			     internal_handle,
+			     mapped_offset,
+			     mapped_size,
+			     stored_size,
+			     compression_method,
+			     extent_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extent of block chunk: %d.",
+				 function,
+				 segment_index );
 
-				case LIBMODI_UDIF_BLOCK_TABLE_ENTRY_TYPE_LZMA_COMPRESSED:
-					internal_handle->io_handle->compression_method = LIBMODI_COMPRESSION_METHOD_LZMA;
-					break;
+				goto on_error;
 			}
-			internal_handle->io_handle->image_type = LIBMODI_IMAGE_TYPE_UDIF_COMPRESSED;
+			mapped_offset += (off64_t) mapped_size;
 		}
 	}
-	if( libmodi_udif_resource_file_free(
-	     &udif_resource_file,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to free UDIF resource file.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( udif_xml_plist != NULL )
+	if( internal_handle->extents_array != NULL )
 	{
-		libmodi_udif_xml_plist_free(
-		 &udif_xml_plist,
-		 NULL );
-	}
-	if( internal_handle->block_chunks_data_handle != NULL )
-	{
-		libmodi_block_chunks_data_handle_free(
-		 &( internal_handle->block_chunks_data_handle ),
-		 NULL );
-	}
-	if( udif_resource_file != NULL )
-	{
-		libmodi_udif_resource_file_free(
-		 &udif_resource_file,
+		libcdata_array_free(
+		 &( internal_handle->extents_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmodi_extent_free,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads (media) data from the current offset into a buffer
- * Returns the number of bytes read or -1 on error
+/* Determines the offset of the next data or hole at or after a specific offset
+ * The whence value is either LIBMODI_SEEK_DATA or LIBMODI_SEEK_HOLE
+ * The end of the (media) data is considered an implicit hole
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
  */
-ssize_t libmodi_handle_read_buffer(
-         libmodi_handle_t *handle,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libmodi_internal_handle_get_data_or_hole_offset(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     int whence,
+     off64_t *data_or_hole_offset,
+     libcerror_error_t **error )
 {
-	libmodi_internal_handle_t *internal_handle = NULL;
-	intptr_t *file_io_handle                   = NULL;
-	static char *function                      = "libmodi_handle_read_buffer";
-	ssize_t read_count                         = 0;
+	libmodi_extent_t *extent = NULL;
+	static char *function    = "libmodi_internal_handle_get_data_or_hole_offset";
+	int extent_index         = 0;
+	int is_sparse            = 0;
+	int maximum_index        = 0;
+	int minimum_index        = 0;
+	int number_of_extents    = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3547,8 +7016,6 @@ ssize_t libmodi_handle_read_buffer(
 
 		return( -1 );
 	}
-	internal_handle = (libmodi_internal_handle_t *) handle;
-
 	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -3560,25 +7027,229 @@ ssize_t libmodi_handle_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_handle->file_io_handle == NULL )
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	 && ( internal_handle->band_data_file_io_pool == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing band data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != LIBMODI_SEEK_DATA )
+	 && ( whence != LIBMODI_SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= internal_handle->io_handle->media_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_or_hole_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data or hole offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->extents_array == NULL )
+	{
+		if( libmodi_internal_handle_read_extents(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extents are contiguous and sorted by offset, hence a binary search
+	 * is used to determine the extent that contains the offset
+	 */
+	maximum_index = number_of_extents - 1;
+
+	while( minimum_index < maximum_index )
+	{
+		extent_index = minimum_index + ( ( maximum_index - minimum_index + 1 ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( offset < extent->offset )
+		{
+			maximum_index = extent_index - 1;
+		}
+		else
+		{
+			minimum_index = extent_index;
+		}
+	}
+	for( extent_index = minimum_index;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( extent->offset + (off64_t) extent->size ) <= offset )
+		{
+			continue;
+		}
+		is_sparse = (int) ( ( extent->flags & LIBMODI_EXTENT_FLAG_IS_SPARSE ) != 0 );
+
+		if( ( ( whence == LIBMODI_SEEK_DATA )
+		  &&  ( is_sparse == 0 ) )
+		 || ( ( whence == LIBMODI_SEEK_HOLE )
+		  &&  ( is_sparse != 0 ) ) )
+		{
+			if( extent->offset > offset )
+			{
+				*data_or_hole_offset = extent->offset;
+			}
+			else
+			{
+				*data_or_hole_offset = offset;
+			}
+			return( 1 );
+		}
+	}
+	if( whence == LIBMODI_SEEK_HOLE )
+	{
+		*data_or_hole_offset = (off64_t) internal_handle->io_handle->media_size;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines the offset of the next data or hole at or after a specific offset
+ * The whence value is either LIBMODI_SEEK_DATA or LIBMODI_SEEK_HOLE
+ * The end of the (media) data is considered an implicit hole
+ * Unlike libmodi_handle_seek_offset this does not change the current offset
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libmodi_handle_get_data_or_hole_offset(
+     libmodi_handle_t *handle,
+     off64_t offset,
+     int whence,
+     off64_t *data_or_hole_offset,
+     libcerror_error_t **error )
+{
+	libmodi_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libmodi_handle_get_data_or_hole_offset";
+	int result                                 = 0;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
-	 && ( internal_handle->band_data_file_io_pool == NULL ) )
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing band data file IO pool.",
+		 "%s: invalid handle - missing file IO handle.",
 		 function );
 
 		return( -1 );
@@ -3598,32 +7269,21 @@ ssize_t libmodi_handle_read_buffer(
 		return( -1 );
 	}
 #endif
-	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
-	{
-		file_io_handle = (intptr_t *) internal_handle->band_data_file_io_pool;
-	}
-	else
-	{
-		file_io_handle = (intptr_t *) internal_handle->file_io_handle;
-	}
-	read_count = libfdata_stream_read_buffer(
-		      internal_handle->data_stream,
-		      file_io_handle,
-		      buffer,
-		      buffer_size,
-		      0,
-		      error );
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          data_or_hole_offset,
+	          error );
 
-	if( read_count == -1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data or hole offset.",
 		 function );
-
-		read_count = -1;
 	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -3640,23 +7300,20 @@ ssize_t libmodi_handle_read_buffer(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads (media) data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libmodi_handle_read_buffer_at_offset(
-         libmodi_handle_t *handle,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libmodi_handle_get_number_of_extents(
+     libmodi_handle_t *handle,
+     int *number_of_extents,
+     libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	intptr_t *file_io_handle                   = NULL;
-	static char *function                      = "libmodi_handle_read_buffer_at_offset";
-	ssize_t read_count                         = 0;
+	static char *function                      = "libmodi_handle_get_number_of_extents";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -3705,6 +7362,17 @@ ssize_t libmodi_handle_read_buffer_at_offset(
 
 		return( -1 );
 	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -3720,33 +7388,38 @@ ssize_t libmodi_handle_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
-	{
-		file_io_handle = (intptr_t *) internal_handle->band_data_file_io_pool;
-	}
-	else
+	if( internal_handle->extents_array == NULL )
 	{
-		file_io_handle = (intptr_t *) internal_handle->file_io_handle;
-	}
-	read_count = libfdata_stream_read_buffer_at_offset(
-		      internal_handle->data_stream,
-		      file_io_handle,
-		      buffer,
-		      buffer_size,
-		      offset,
-		      0,
-		      error );
+		if( libmodi_internal_handle_read_extents(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extents.",
+			 function );
 
-	if( read_count == -1 )
+			result = -1;
+		}
+	}
+	if( result == 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+		if( libcdata_array_get_number_of_entries(
+		     internal_handle->extents_array,
+		     number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of extents.",
+			 function );
 
-		goto on_error;
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -3763,28 +7436,28 @@ ssize_t libmodi_handle_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( read_count );
-
-on_error:
-#if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( result );
 }
 
-/* Seeks a certain offset of the (media) data
- * Returns the offset if seek is successful or -1 on error
+/* Retrieves a specific extent
+ * The extent offset and size are relative to the start of the (media) data
+ * The stored size is the size of the extent data in the image, which is 0 for sparse extents
+ * Returns 1 if successful or -1 on error
  */
-off64_t libmodi_handle_seek_offset(
-         libmodi_handle_t *handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libmodi_handle_get_extent_by_index(
+     libmodi_handle_t *handle,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     size64_t *extent_stored_size,
+     int *extent_compression_method,
+     uint32_t *extent_flags,
+     libcerror_error_t **error )
 {
+	libmodi_extent_t *extent                   = NULL;
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_seek_offset";
+	static char *function                      = "libmodi_handle_get_extent_by_index";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -3799,6 +7472,17 @@ off64_t libmodi_handle_seek_offset(
 	}
 	internal_handle = (libmodi_internal_handle_t *) handle;
 
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_handle->file_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -3810,6 +7494,18 @@ off64_t libmodi_handle_seek_offset(
 
 		return( -1 );
 	}
+	if( ( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	 && ( internal_handle->band_data_file_io_pool == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing band data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -3825,22 +7521,62 @@ off64_t libmodi_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfdata_stream_seek_offset(
-	          internal_handle->data_stream,
-	          offset,
-	          whence,
-	          error );
+	if( internal_handle->extents_array == NULL )
+	{
+		if( libmodi_internal_handle_read_extents(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extents.",
+			 function );
 
-	if( offset == -1 )
+			result = -1;
+		}
+	}
+	if( result == 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libmodi_extent_get_values(
+		     extent,
+		     extent_offset,
+		     extent_size,
+		     extent_stored_size,
+		     extent_compression_method,
+		     extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d values.",
+			 function,
+			 extent_index );
 
-		offset = -1;
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -3857,19 +7593,19 @@ off64_t libmodi_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( result );
 }
 
-/* Retrieves the current offset of the (media) data
+/* Retrieves the number of partitions
  * Returns 1 if successful or -1 on error
  */
-int libmodi_handle_get_offset(
+int libmodi_handle_get_number_of_partitions(
      libmodi_handle_t *handle,
-     off64_t *offset,
+     int *number_of_partitions,
      libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_get_offset";
+	static char *function                      = "libmodi_handle_get_number_of_partitions";
 	int result                                 = 1;
 
 	if( handle == NULL )
@@ -3885,6 +7621,17 @@ int libmodi_handle_get_offset(
 	}
 	internal_handle = (libmodi_internal_handle_t *) handle;
 
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_handle->file_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -3896,6 +7643,17 @@ int libmodi_handle_get_offset(
 
 		return( -1 );
 	}
+	if( number_of_partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -3911,16 +7669,20 @@ int libmodi_handle_get_offset(
 		return( -1 );
 	}
 #endif
-	if( libfdata_stream_get_offset(
-	     internal_handle->data_stream,
-	     offset,
-	     error ) != 1 )
+	if( internal_handle->partitions_array == NULL )
+	{
+		*number_of_partitions = 0;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_handle->partitions_array,
+	          number_of_partitions,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve offset.",
+		 "%s: unable to retrieve number of partitions.",
 		 function );
 
 		result = -1;
@@ -3943,16 +7705,22 @@ int libmodi_handle_get_offset(
 	return( result );
 }
 
-/* Sets the maximum number of (concurrent) open file handles
+/* Retrieves a specific partition
+ * The partition offset and size are relative to the start of the (media) data
  * Returns 1 if successful or -1 on error
  */
-int libmodi_handle_set_maximum_number_of_open_handles(
+int libmodi_handle_get_partition_by_index(
      libmodi_handle_t *handle,
-     int maximum_number_of_open_handles,
+     int partition_index,
+     off64_t *partition_offset,
+     size64_t *partition_size,
+     int32_t *partition_identifier,
+     uint32_t *partition_attributes,
      libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_set_maximum_number_of_open_handles";
+	libmodi_partition_t *partition             = NULL;
+	static char *function                      = "libmodi_handle_get_partition_by_index";
 	int result                                 = 1;
 
 	if( handle == NULL )
@@ -3966,10 +7734,32 @@ int libmodi_handle_set_maximum_number_of_open_handles(
 
 		return( -1 );
 	}
-	internal_handle = (libmodi_internal_handle_t *) handle;
-
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3977,35 +7767,53 @@ int libmodi_handle_set_maximum_number_of_open_handles(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_handle->band_data_file_io_pool != NULL )
+	result = libcdata_array_get_entry_by_index(
+	          internal_handle->partitions_array,
+	          partition_index,
+	          (intptr_t **) &partition,
+	          error );
+
+	if( result != 1 )
 	{
-		result = libbfio_pool_set_maximum_number_of_open_handles(
-		          internal_handle->band_data_file_io_pool,
-		          maximum_number_of_open_handles,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
 
-		if( result != 1 )
+		result = -1;
+	}
+	else
+	{
+		if( libmodi_partition_get_values(
+		     partition,
+		     partition_offset,
+		     partition_size,
+		     partition_identifier,
+		     partition_attributes,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set maximum number of open handles in band data file IO pool.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d values.",
+			 function,
+			 partition_index );
+
+			result = -1;
 		}
 	}
-	if( result == 1 )
-	{
-		internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
-	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4013,7 +7821,7 @@ int libmodi_handle_set_maximum_number_of_open_handles(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -4022,17 +7830,19 @@ int libmodi_handle_set_maximum_number_of_open_handles(
 	return( result );
 }
 
-/* Sets the path to the band data files
- * Returns 1 if successful or -1 on error
+/* Retrieves the size of the UTF-8 encoded name of a specific partition
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libmodi_handle_set_band_data_files_path(
+int libmodi_handle_get_utf8_partition_name_size(
      libmodi_handle_t *handle,
-     const char *path,
-     size_t path_length,
+     int partition_index,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_set_band_data_files_path";
+	libmodi_partition_t *partition             = NULL;
+	static char *function                      = "libmodi_handle_get_utf8_partition_name_size";
 	int result                                 = 1;
 
 	if( handle == NULL )
@@ -4059,30 +7869,19 @@ int libmodi_handle_set_band_data_files_path(
 
 		return( -1 );
 	}
-	if( path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
-		 function );
-
-		return( -1 );
-	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( internal_handle->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4090,32 +7889,50 @@ int libmodi_handle_set_band_data_files_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	result = libcdata_array_get_entry_by_index(
+	          internal_handle->partitions_array,
+	          partition_index,
+	          (intptr_t **) &partition,
+	          error );
+
+	if( result != 1 )
 	{
-		if( libmodi_internal_handle_set_bands_directory_path(
-		     internal_handle,
-		     path,
-		     path_length,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libmodi_partition_get_utf8_name_size(
+		          partition,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set bands directory path.",
-			 function );
-
-			result = -1;
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d UTF-8 name size.",
+			 function,
+			 partition_index );
 		}
 	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4123,7 +7940,7 @@ int libmodi_handle_set_band_data_files_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -4132,19 +7949,20 @@ int libmodi_handle_set_band_data_files_path(
 	return( result );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Sets the path to the band data files
- * Returns 1 if successful or -1 on error
+/* Retrieves the UTF-8 encoded name of a specific partition
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libmodi_handle_set_band_data_files_path_wide(
+int libmodi_handle_get_utf8_partition_name(
      libmodi_handle_t *handle,
-     const wchar_t *path,
-     size_t path_length,
+     int partition_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_set_band_data_files_path_wide";
+	libmodi_partition_t *partition             = NULL;
+	static char *function                      = "libmodi_handle_get_utf8_partition_name";
 	int result                                 = 1;
 
 	if( handle == NULL )
@@ -4171,30 +7989,19 @@ int libmodi_handle_set_band_data_files_path_wide(
 
 		return( -1 );
 	}
-	if( path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
-		 function );
-
-		return( -1 );
-	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( internal_handle->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4202,32 +8009,51 @@ int libmodi_handle_set_band_data_files_path_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_handle->io_handle->image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
+	result = libcdata_array_get_entry_by_index(
+	          internal_handle->partitions_array,
+	          partition_index,
+	          (intptr_t **) &partition,
+	          error );
+
+	if( result != 1 )
 	{
-		if( libmodi_internal_handle_set_bands_directory_path_wide(
-		     internal_handle,
-		     path,
-		     path_length,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libmodi_partition_get_utf8_name(
+		          partition,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set bands directory path.",
-			 function );
-
-			result = -1;
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d UTF-8 name.",
+			 function,
+			 partition_index );
 		}
 	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4235,7 +8061,7 @@ int libmodi_handle_set_band_data_files_path_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -4244,18 +8070,20 @@ int libmodi_handle_set_band_data_files_path_wide(
 	return( result );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Retrieves the media size
- * Returns the 1 if successful or -1 on error
+/* Retrieves the size of the UTF-16 encoded name of a specific partition
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libmodi_handle_get_media_size(
+int libmodi_handle_get_utf16_partition_name_size(
      libmodi_handle_t *handle,
-     size64_t *media_size,
+     int partition_index,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_get_media_size";
+	libmodi_partition_t *partition             = NULL;
+	static char *function                      = "libmodi_handle_get_utf16_partition_name_size";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -4292,17 +8120,6 @@ int libmodi_handle_get_media_size(
 
 		return( -1 );
 	}
-	if( media_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media size.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -4318,8 +8135,42 @@ int libmodi_handle_get_media_size(
 		return( -1 );
 	}
 #endif
-	*media_size = internal_handle->io_handle->media_size;
+	result = libcdata_array_get_entry_by_index(
+	          internal_handle->partitions_array,
+	          partition_index,
+	          (intptr_t **) &partition,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libmodi_partition_get_utf16_name_size(
+		          partition,
+		          utf16_string_size,
+		          error );
 
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d UTF-16 name size.",
+			 function,
+			 partition_index );
+		}
+	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -4335,19 +8186,24 @@ int libmodi_handle_get_media_size(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the image type
- * Returns the 1 if successful or -1 on error
+/* Retrieves the UTF-16 encoded name of a specific partition
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libmodi_handle_get_image_type(
+int libmodi_handle_get_utf16_partition_name(
      libmodi_handle_t *handle,
-     int *image_type,
+     int partition_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
 	libmodi_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libmodi_handle_get_image_type";
+	libmodi_partition_t *partition             = NULL;
+	static char *function                      = "libmodi_handle_get_utf16_partition_name";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -4384,17 +8240,6 @@ int libmodi_handle_get_image_type(
 
 		return( -1 );
 	}
-	if( image_type == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid image type.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -4410,8 +8255,43 @@ int libmodi_handle_get_image_type(
 		return( -1 );
 	}
 #endif
-	*image_type = internal_handle->io_handle->image_type;
+	result = libcdata_array_get_entry_by_index(
+	          internal_handle->partitions_array,
+	          partition_index,
+	          (intptr_t **) &partition,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
 
+		result = -1;
+	}
+	else
+	{
+		result = libmodi_partition_get_utf16_name(
+		          partition,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d UTF-16 name.",
+			 function,
+			 partition_index );
+		}
+	}
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -4427,6 +8307,6 @@ int libmodi_handle_get_image_type(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
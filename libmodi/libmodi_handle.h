@@ -30,11 +30,13 @@
 #include "libmodi_extern.h"
 #include "libmodi_io_handle.h"
 #include "libmodi_libbfio.h"
+#include "libmodi_libcdata.h"
 #include "libmodi_libcdirectory.h"
 #include "libmodi_libcerror.h"
 #include "libmodi_libcthreads.h"
 #include "libmodi_libfcache.h"
 #include "libmodi_libfdata.h"
+#include "libmodi_mapped_file.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -68,6 +70,10 @@ struct libmodi_internal_handle
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The memory mapped image file
+	 */
+	libmodi_mapped_file_t *mapped_file;
+
 	/* The band data file IO pool
 	 */
 	libbfio_pool_t *band_data_file_io_pool;
@@ -76,6 +82,16 @@ struct libmodi_internal_handle
 	 */
 	uint8_t band_data_file_io_pool_created_in_library;
 
+	/* The resolved band data files bitmap
+	 * Band data files created inside the library are opened on demand
+	 */
+	uint8_t *resolved_band_data_files;
+
+	/* The present band data files bitmap
+	 * Determined by reading the bands directory once
+	 */
+	uint8_t *present_band_data_files;
+
 	/* The access flags
 	 */
 	int access_flags;
@@ -92,10 +108,22 @@ struct libmodi_internal_handle
 	 */
 	libfdata_stream_t *data_stream;
 
+	/* The extents array
+	 */
+	libcdata_array_t *extents_array;
+
+	/* The partitions array
+	 */
+	libcdata_array_t *partitions_array;
+
 	/* The maximum number of open handles in the pool
 	 */
 	int maximum_number_of_open_handles;
 
+	/* The maximum cache size or 0 for the default number of cache entries
+	 */
+	size64_t maximum_cache_size;
+
 #if defined( HAVE_LIBMODI_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -152,6 +180,34 @@ int libmodi_handle_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int libmodi_internal_handle_open_mapped_file(
+     libmodi_internal_handle_t *internal_handle,
+     const char *filename,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_open_direct_file(
+     libmodi_internal_handle_t *internal_handle,
+     const char *filename,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libmodi_internal_handle_open_mapped_file_wide(
+     libmodi_internal_handle_t *internal_handle,
+     const wchar_t *filename,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_open_direct_file_wide(
+     libmodi_internal_handle_t *internal_handle,
+     const wchar_t *filename,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 LIBMODI_EXTERN \
 int libmodi_handle_open_file_io_handle(
      libmodi_handle_t *handle,
@@ -175,6 +231,21 @@ int libmodi_internal_handle_open_band_data_files_file_io_pool(
      libbfio_pool_t *file_io_pool,
      libcerror_error_t **error );
 
+int libmodi_internal_handle_read_bands_directory(
+     libmodi_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_open_band_data_files_on_demand(
+     libmodi_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_resolve_band_data_files(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
 int libmodi_internal_handle_open_band_data_file(
      libmodi_internal_handle_t *internal_handle,
      libbfio_pool_t *file_io_pool,
@@ -233,6 +304,23 @@ ssize_t libmodi_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBMODI_EXTERN \
+int libmodi_handle_get_mapped_data_at_offset(
+     libmodi_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_get_mapped_data_at_offset(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBMODI_EXTERN \
 off64_t libmodi_handle_seek_offset(
          libmodi_handle_t *handle,
@@ -252,6 +340,16 @@ int libmodi_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBMODI_EXTERN \
+int libmodi_handle_set_maximum_cache_size(
+     libmodi_handle_t *handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_set_maximum_cache_size(
+     libmodi_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 LIBMODI_EXTERN \
 int libmodi_handle_set_band_data_files_path(
      libmodi_handle_t *handle,
@@ -282,6 +380,104 @@ int libmodi_handle_get_image_type(
      int *image_type,
      libcerror_error_t **error );
 
+LIBMODI_EXTERN \
+int libmodi_handle_get_statistics_value(
+     libmodi_handle_t *handle,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_append_extent(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     size64_t stored_size,
+     int compression_method,
+     uint32_t flags,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_read_extents(
+     libmodi_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libmodi_internal_handle_get_data_or_hole_offset(
+     libmodi_internal_handle_t *internal_handle,
+     off64_t offset,
+     int whence,
+     off64_t *data_or_hole_offset,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_data_or_hole_offset(
+     libmodi_handle_t *handle,
+     off64_t offset,
+     int whence,
+     off64_t *data_or_hole_offset,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_number_of_extents(
+     libmodi_handle_t *handle,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_extent_by_index(
+     libmodi_handle_t *handle,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     size64_t *extent_stored_size,
+     int *extent_compression_method,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_number_of_partitions(
+     libmodi_handle_t *handle,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_partition_by_index(
+     libmodi_handle_t *handle,
+     int partition_index,
+     off64_t *partition_offset,
+     size64_t *partition_size,
+     int32_t *partition_identifier,
+     uint32_t *partition_attributes,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_utf8_partition_name_size(
+     libmodi_handle_t *handle,
+     int partition_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_utf8_partition_name(
+     libmodi_handle_t *handle,
+     int partition_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_utf16_partition_name_size(
+     libmodi_handle_t *handle,
+     int partition_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBMODI_EXTERN \
+int libmodi_handle_get_utf16_partition_name(
+     libmodi_handle_t *handle,
+     int partition_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
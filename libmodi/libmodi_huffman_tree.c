@@ -245,22 +245,30 @@ int libmodi_huffman_tree_free(
 }
 
 /* Builds the Huffman tree
+ * The lookup table is built for the bit order of the bit stream storage type
  * Returns 1 on success, 0 if the tree is empty or -1 on error
  */
 int libmodi_huffman_tree_build(
      libmodi_huffman_tree_t *huffman_tree,
      const uint8_t *code_sizes_array,
      int number_of_code_sizes,
+     uint8_t storage_type,
      libcerror_error_t **error )
 {
-	int *symbol_offsets   = NULL;
-	static char *function = "libmodi_huffman_tree_build";
-	size_t array_size     = 0;
-	uint16_t symbol       = 0;
-	uint8_t bit_index     = 0;
-	uint8_t code_size     = 0;
-	int code_offset       = 0;
-	int left_value        = 0;
+	int *symbol_offsets     = NULL;
+	static char *function   = "libmodi_huffman_tree_build";
+	size_t array_size       = 0;
+	uint16_t lookup_index   = 0;
+	uint16_t lookup_value   = 0;
+	uint16_t reversed_code  = 0;
+	uint16_t symbol         = 0;
+	uint8_t bit_index       = 0;
+	uint8_t code_size       = 0;
+	int code_index          = 0;
+	int code_offset         = 0;
+	int huffman_code        = 0;
+	int left_value          = 0;
+	int lookup_table_offset = 0;
 
 	if( huffman_tree == NULL )
 	{
@@ -307,6 +315,34 @@ int libmodi_huffman_tree_build(
 
 		return( -1 );
 	}
+	if( ( storage_type != LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( storage_type != LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported storage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     huffman_tree->lookup_table,
+	     0,
+	     sizeof( uint16_t ) * ( 1 << LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	huffman_tree->storage_type = storage_type;
+
 	/* Determine the code size frequencies
 	 */
 	array_size = sizeof( int ) * ( huffman_tree->maximum_code_size + 1 );
@@ -448,6 +484,64 @@ int libmodi_huffman_tree_build(
 	memory_free(
 	 symbol_offsets );
 
+	symbol_offsets = NULL;
+
+	/* Fill the lookup table with the canonical Huffman codes that fit in the lookup table bits
+	 * A code of code size N occupies every lookup table entry of which the first N bits,
+	 * in bit stream order, match the code
+	 */
+	code_offset = 0;
+
+	for( code_size = 1;
+	     ( code_size <= huffman_tree->maximum_code_size ) && ( code_size <= LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS );
+	     code_size++ )
+	{
+		for( code_index = 0;
+		     code_index < huffman_tree->code_size_counts[ code_size ];
+		     code_index++ )
+		{
+			symbol = huffman_tree->symbols[ code_offset ];
+
+			lookup_value = (uint16_t) ( ( symbol << 4 ) | code_size );
+
+			if( storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+			{
+				/* The first bit of the code is stored in the least significant bit
+				 */
+				reversed_code = 0;
+
+				for( bit_index = 0;
+				     bit_index < code_size;
+				     bit_index++ )
+				{
+					reversed_code <<= 1;
+					reversed_code  |= (uint16_t) ( ( huffman_code >> bit_index ) & 0x00000001UL );
+				}
+				for( lookup_index = reversed_code;
+				     lookup_index < ( 1 << LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS );
+				     lookup_index += (uint16_t) ( 1 << code_size ) )
+				{
+					huffman_tree->lookup_table[ lookup_index ] = lookup_value;
+				}
+			}
+			else
+			{
+				/* The first bit of the code is stored in the most significant bit
+				 */
+				lookup_table_offset = huffman_code << ( LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS - code_size );
+
+				for( lookup_index = 0;
+				     lookup_index < (uint16_t) ( 1 << ( LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS - code_size ) );
+				     lookup_index++ )
+				{
+					huffman_tree->lookup_table[ lookup_table_offset + lookup_index ] = lookup_value;
+				}
+			}
+			huffman_code++;
+			code_offset++;
+		}
+		huffman_code <<= 1;
+	}
 	return( 1 );
 
 on_error:
@@ -463,20 +557,21 @@ on_error:
  * Returns 1 on success or -1 on error
  */
 int libmodi_huffman_tree_get_symbol_from_bit_stream(
-     libmodi_huffman_tree_t *huffman_tree,
+     const libmodi_huffman_tree_t *huffman_tree,
      libmodi_bit_stream_t *bit_stream,
      uint16_t *symbol,
      libcerror_error_t **error )
 {
 	static char *function  = "libmodi_huffman_tree_get_symbol_from_bit_stream";
 	uint32_t value_32bit   = 0;
+	uint16_t lookup_value  = 0;
 	uint16_t safe_symbol   = 0;
 	uint8_t bit_index      = 0;
+	uint8_t code_size      = 0;
 	int code_size_count    = 0;
 	int first_huffman_code = 0;
 	int first_index        = 0;
 	int huffman_code       = 0;
-	int result             = 0;
 
 	if( huffman_tree == NULL )
 	{
@@ -500,6 +595,17 @@ int libmodi_huffman_tree_get_symbol_from_bit_stream(
 
 		return( -1 );
 	}
+	if( bit_stream->storage_type != huffman_tree->storage_type )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bit stream storage type.",
+		 function );
+
+		return( -1 );
+	}
 	if( symbol == NULL )
 	{
 		libcerror_error_set(
@@ -511,15 +617,36 @@ int libmodi_huffman_tree_get_symbol_from_bit_stream(
 
 		return( -1 );
 	}
-/* TODO get maximum_code_size of bits into local bit buffer */
+	if( libmodi_bit_stream_peek_value(
+	     bit_stream,
+	     LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to peek value from bit stream.",
+		 function );
 
-	for( bit_index = 1;
-	     bit_index <= huffman_tree->maximum_code_size;
-	     bit_index++ )
+		return( -1 );
+	}
+	lookup_value = huffman_tree->lookup_table[ value_32bit ];
+
+	if( lookup_value != 0 )
 	{
-		if( libmodi_bit_stream_get_value(
+		safe_symbol = lookup_value >> 4;
+		code_size   = (uint8_t) ( lookup_value & 0x000f );
+	}
+	else
+	{
+		/* The code is larger than the lookup table bits or invalid
+		 * walk the canonical code ranges using the peeked bits
+		 */
+		if( libmodi_bit_stream_peek_value(
 		     bit_stream,
-		     1,
+		     huffman_tree->maximum_code_size,
 		     &value_32bit,
 		     error ) != 1 )
 		{
@@ -527,37 +654,62 @@ int libmodi_huffman_tree_get_symbol_from_bit_stream(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from bit stream.",
+			 "%s: unable to peek value from bit stream.",
 			 function );
 
 			return( -1 );
 		}
-		huffman_code <<= 1;
-		huffman_code  |= (int) value_32bit;
-
-		code_size_count = huffman_tree->code_size_counts[ bit_index ];
-
-		if( ( huffman_code - code_size_count ) < first_huffman_code )
+		for( bit_index = 1;
+		     bit_index <= huffman_tree->maximum_code_size;
+		     bit_index++ )
 		{
-			safe_symbol = huffman_tree->symbols[ first_index + ( huffman_code - first_huffman_code ) ];
-
-			result = 1;
+			huffman_code <<= 1;
+
+			if( huffman_tree->storage_type == LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+			{
+				huffman_code |= (int) ( ( value_32bit >> ( bit_index - 1 ) ) & 0x00000001UL );
+			}
+			else
+			{
+				huffman_code |= (int) ( ( value_32bit >> ( huffman_tree->maximum_code_size - bit_index ) ) & 0x00000001UL );
+			}
+			code_size_count = huffman_tree->code_size_counts[ bit_index ];
+
+			if( ( huffman_code - code_size_count ) < first_huffman_code )
+			{
+				safe_symbol = huffman_tree->symbols[ first_index + ( huffman_code - first_huffman_code ) ];
+				code_size   = bit_index;
+
+				break;
+			}
+			first_huffman_code  += code_size_count;
+			first_huffman_code <<= 1;
+			first_index         += code_size_count;
+		}
+		if( code_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+			 function,
+			 huffman_code );
 
-			break;
+			return( -1 );
 		}
-		first_huffman_code  += code_size_count;
-		first_huffman_code <<= 1;
-		first_index         += code_size_count;
 	}
-	if( result != 1 )
+	if( libmodi_bit_stream_skip_bits(
+	     bit_stream,
+	     code_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
-		 function,
-		 huffman_code );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to skip bits in bit stream.",
+		 function );
 
 		return( -1 );
 	}
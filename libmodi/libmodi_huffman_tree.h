@@ -32,6 +32,10 @@
 extern "C" {
 #endif
 
+/* The number of bits of the Huffman code lookup table
+ */
+#define LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS	10
+
 typedef struct libmodi_huffman_tree libmodi_huffman_tree_t;
 
 struct libmodi_huffman_tree
@@ -47,6 +51,17 @@ struct libmodi_huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The bit stream storage type the lookup table was built for
+	 */
+	uint8_t storage_type;
+
+	/* The lookup table
+	 * Contains the symbol and code size of the Huffman codes that fit in
+	 * the lookup table bits, indexed by the next bits in the bit stream
+	 * An entry of 0 indicates the code is larger than the lookup table bits
+	 */
+	uint16_t lookup_table[ 1 << LIBMODI_HUFFMAN_TREE_LOOKUP_TABLE_NUMBER_OF_BITS ];
 };
 
 int libmodi_huffman_tree_initialize(
@@ -63,10 +78,11 @@ int libmodi_huffman_tree_build(
      libmodi_huffman_tree_t *huffman_tree,
      const uint8_t *code_sizes_array,
      int number_of_code_sizes,
+     uint8_t storage_type,
      libcerror_error_t **error );
 
 int libmodi_huffman_tree_get_symbol_from_bit_stream(
-     libmodi_huffman_tree_t *huffman_tree,
+     const libmodi_huffman_tree_t *huffman_tree,
      libmodi_bit_stream_t *bit_stream,
      uint16_t *symbol,
      libcerror_error_t **error );
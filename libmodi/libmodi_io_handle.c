@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libmodi_compression.h"
 #include "libmodi_definitions.h"
 #include "libmodi_io_handle.h"
 #include "libmodi_libcerror.h"
@@ -110,6 +111,7 @@ int libmodi_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libmodi_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -124,12 +126,28 @@ int libmodi_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->decompression_context != NULL )
+		{
+			if( libmodi_decompression_context_free(
+			     &( ( *io_handle )->decompression_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decompression context.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears the IO handle
@@ -152,6 +170,22 @@ int libmodi_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->decompression_context != NULL )
+	{
+		if( libmodi_decompression_context_free(
+		     &( io_handle->decompression_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decompression context.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -25,8 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libmodi_compression.h"
+#include "libmodi_definitions.h"
 #include "libmodi_extern.h"
 #include "libmodi_libcerror.h"
+#include "libmodi_statistics.h"
+#include "libmodi_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -60,6 +64,14 @@ struct libmodi_io_handle
 	 */
 	int compression_method;
 
+	/* The decompression context
+	 */
+	libmodi_decompression_context_t *decompression_context;
+
+	/* The statistics
+	 */
+	libmodi_statistics_t statistics;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
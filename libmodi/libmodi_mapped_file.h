@@ -0,0 +1,69 @@
+/*
+ * The memory mapped file functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMODI_MAPPED_FILE_H )
+#define _LIBMODI_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmodi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmodi_mapped_file libmodi_mapped_file_t;
+
+struct libmodi_mapped_file
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+};
+
+int libmodi_mapped_file_initialize(
+     libmodi_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libmodi_mapped_file_free(
+     libmodi_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libmodi_mapped_file_open(
+     libmodi_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libmodi_mapped_file_close(
+     libmodi_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMODI_MAPPED_FILE_H ) */
+
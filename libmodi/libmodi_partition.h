@@ -0,0 +1,112 @@
+/*
+ * Partition functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMODI_PARTITION_H )
+#define _LIBMODI_PARTITION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmodi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmodi_partition libmodi_partition_t;
+
+struct libmodi_partition
+{
+	/* The (media) offset
+	 */
+	off64_t offset;
+
+	/* The (media) size
+	 */
+	size64_t size;
+
+	/* The identifier
+	 */
+	int32_t identifier;
+
+	/* The attributes
+	 */
+	uint32_t attributes;
+
+	/* The UTF-8 encoded name
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+};
+
+int libmodi_partition_initialize(
+     libmodi_partition_t **partition,
+     libcerror_error_t **error );
+
+int libmodi_partition_free(
+     libmodi_partition_t **partition,
+     libcerror_error_t **error );
+
+int libmodi_partition_set_name(
+     libmodi_partition_t *partition,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libmodi_partition_get_values(
+     libmodi_partition_t *partition,
+     off64_t *offset,
+     size64_t *size,
+     int32_t *identifier,
+     uint32_t *attributes,
+     libcerror_error_t **error );
+
+int libmodi_partition_get_utf8_name_size(
+     libmodi_partition_t *partition,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libmodi_partition_get_utf8_name(
+     libmodi_partition_t *partition,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libmodi_partition_get_utf16_name_size(
+     libmodi_partition_t *partition,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libmodi_partition_get_utf16_name(
+     libmodi_partition_t *partition,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMODI_PARTITION_H ) */
+
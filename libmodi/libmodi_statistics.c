@@ -0,0 +1,214 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_CLOCK_GETTIME ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libmodi_libcerror.h"
+#include "libmodi_statistics.h"
+
+/* Retrieves the current value of a monotonic clock
+ * Returns the current time in nanoseconds or 0 if not available
+ */
+uint64_t libmodi_statistics_get_current_time(
+          void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER frequency;
+
+	LARGE_INTEGER counter;
+
+	if( frequency.QuadPart == 0 )
+	{
+		if( QueryPerformanceFrequency(
+		     &frequency ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	      + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Adds a read to the statistics
+ */
+void libmodi_statistics_add_read(
+      libmodi_statistics_t *statistics,
+      size_t read_size )
+{
+	size_t range_size = 8192;
+	int range_index   = 0;
+
+	if( statistics == NULL )
+	{
+		return;
+	}
+	while( range_index < ( LIBMODI_STATISTICS_NUMBER_OF_READ_SIZE_RANGES - 1 ) )
+	{
+		if( read_size < range_size )
+		{
+			break;
+		}
+		range_size  *= 2;
+		range_index += 1;
+	}
+	LIBMODI_STATISTICS_ADD(
+	 statistics->number_of_reads,
+	 1 );
+
+	LIBMODI_STATISTICS_ADD(
+	 statistics->number_of_reads_per_size[ range_index ],
+	 1 );
+
+	LIBMODI_STATISTICS_ADD(
+	 statistics->number_of_bytes_read,
+	 read_size );
+}
+
+/* Retrieves a specific statistics value
+ * The value type is a LIBMODI_STATISTICS_VALUE_* definition, where the read size range index
+ * or compression method is added to the value types of values per range or method
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmodi_statistics_get_value(
+     libmodi_statistics_t *statistics,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_statistics_get_value";
+
+#if defined( HAVE_STATISTICS )
+	uint64_t *counter     = NULL;
+#endif
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_STATISTICS )
+	if( ( value_type >= LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS_PER_SIZE_RANGE )
+	 && ( value_type < ( LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS_PER_SIZE_RANGE + LIBMODI_STATISTICS_NUMBER_OF_READ_SIZE_RANGES ) ) )
+	{
+		counter = &( statistics->number_of_reads_per_size[ value_type - LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS_PER_SIZE_RANGE ] );
+	}
+	else if( ( value_type >= LIBMODI_STATISTICS_VALUE_NUMBER_OF_DECOMPRESSED_CHUNKS )
+	      && ( value_type < ( LIBMODI_STATISTICS_VALUE_NUMBER_OF_DECOMPRESSED_CHUNKS + LIBMODI_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ) ) )
+	{
+		counter = &( statistics->number_of_decompressed_chunks[ value_type - LIBMODI_STATISTICS_VALUE_NUMBER_OF_DECOMPRESSED_CHUNKS ] );
+	}
+	else if( ( value_type >= LIBMODI_STATISTICS_VALUE_DECOMPRESSION_TIME )
+	      && ( value_type < ( LIBMODI_STATISTICS_VALUE_DECOMPRESSION_TIME + LIBMODI_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ) ) )
+	{
+		counter = &( statistics->decompression_time[ value_type - LIBMODI_STATISTICS_VALUE_DECOMPRESSION_TIME ] );
+	}
+	else
+	{
+		switch( value_type )
+		{
+			case LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS:
+				counter = &( statistics->number_of_reads );
+				break;
+
+			case LIBMODI_STATISTICS_VALUE_NUMBER_OF_BYTES_READ:
+				counter = &( statistics->number_of_bytes_read );
+				break;
+
+			case LIBMODI_STATISTICS_VALUE_NUMBER_OF_BYTES_READ_FROM_STORAGE:
+				counter = &( statistics->number_of_bytes_read_from_storage );
+				break;
+
+			case LIBMODI_STATISTICS_VALUE_NUMBER_OF_SPARSE_BYTES:
+				counter = &( statistics->number_of_sparse_bytes );
+				break;
+
+			case LIBMODI_STATISTICS_VALUE_NUMBER_OF_CACHE_HITS:
+				counter = &( statistics->number_of_cache_hits );
+				break;
+
+			case LIBMODI_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES:
+				counter = &( statistics->number_of_cache_misses );
+				break;
+
+			case LIBMODI_STATISTICS_VALUE_IO_TIME:
+				counter = &( statistics->io_time );
+				break;
+
+			case LIBMODI_STATISTICS_VALUE_NUMBER_OF_BAND_FILE_OPENS:
+				counter = &( statistics->number_of_band_file_opens );
+				break;
+
+			default:
+				return( 0 );
+		}
+	}
+	*value = LIBMODI_STATISTICS_GET( *counter );
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,149 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMODI_STATISTICS_H )
+#define _LIBMODI_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmodi_definitions.h"
+#include "libmodi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmodi_statistics libmodi_statistics_t;
+
+struct libmodi_statistics
+{
+	/* The number of read calls
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of read calls per read size range
+	 */
+	uint64_t number_of_reads_per_size[ LIBMODI_STATISTICS_NUMBER_OF_READ_SIZE_RANGES ];
+
+	/* The number of bytes returned by the read calls
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of bytes read from storage
+	 */
+	uint64_t number_of_bytes_read_from_storage;
+
+	/* The number of bytes of sparse data that was filled with 0-byte values
+	 */
+	uint64_t number_of_sparse_bytes;
+
+	/* The number of chunk cache hits
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of chunk cache misses
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The number of chunks decompressed per compression method
+	 */
+	uint64_t number_of_decompressed_chunks[ LIBMODI_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ];
+
+	/* The time spent decompressing chunks per compression method
+	 */
+	uint64_t decompression_time[ LIBMODI_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ];
+
+	/* The time spent reading from storage
+	 */
+	uint64_t io_time;
+
+	/* The number of band data files opened
+	 */
+	uint64_t number_of_band_file_opens;
+};
+
+/* The statistics are updated atomically where supported by the compiler,
+ * otherwise they are only updated while the read/write lock of the handle is held
+ */
+#if defined( HAVE_STATISTICS )
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define LIBMODI_STATISTICS_ADD( counter, value ) \
+	__atomic_fetch_add( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define LIBMODI_STATISTICS_GET( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#elif defined( _MSC_VER )
+#define LIBMODI_STATISTICS_ADD( counter, value ) \
+	InterlockedExchangeAdd64( (LONG64 volatile *) &( counter ), (LONG64) ( value ) )
+
+#define LIBMODI_STATISTICS_GET( counter ) \
+	(uint64_t) InterlockedCompareExchange64( (LONG64 volatile *) &( counter ), 0, 0 )
+
+#else
+#define LIBMODI_STATISTICS_ADD( counter, value ) \
+	( counter ) += (uint64_t) ( value )
+
+#define LIBMODI_STATISTICS_GET( counter ) \
+	( counter )
+
+#endif /* defined( __GNUC__ ) || defined( __clang__ ) */
+
+#define LIBMODI_STATISTICS_ADD_READ( statistics, read_size ) \
+	libmodi_statistics_add_read( statistics, read_size )
+
+#define LIBMODI_STATISTICS_SET_START_TIME( start_time ) \
+	( start_time ) = libmodi_statistics_get_current_time()
+
+#define LIBMODI_STATISTICS_ADD_ELAPSED_TIME( counter, start_time ) \
+	LIBMODI_STATISTICS_ADD( counter, libmodi_statistics_get_current_time() - ( start_time ) )
+
+#else
+#define LIBMODI_STATISTICS_ADD( counter, value )
+
+#define LIBMODI_STATISTICS_ADD_READ( statistics, read_size )
+
+#define LIBMODI_STATISTICS_SET_START_TIME( start_time )
+
+#define LIBMODI_STATISTICS_ADD_ELAPSED_TIME( counter, start_time )
+
+#endif /* defined( HAVE_STATISTICS ) */
+
+uint64_t libmodi_statistics_get_current_time(
+          void );
+
+void libmodi_statistics_add_read(
+      libmodi_statistics_t *statistics,
+      size_t read_size );
+
+int libmodi_statistics_get_value(
+     libmodi_statistics_t *statistics,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMODI_STATISTICS_H ) */
+
@@ -1013,5 +1013,132 @@ int libmodi_system_string_copy_from_wide_string(
 	return( 1 );
 }
 
+/* Determines the size of a narrow string from a wide string
+ * The narrow string is in the codepage of the system or UTF-8 if not set
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_narrow_string_size_from_wide_string(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *narrow_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_narrow_string_size_from_wide_string";
+	int result            = 0;
+
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) wide_string,
+		          wide_string_size,
+		          narrow_string_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) wide_string,
+		          wide_string_size,
+		          narrow_string_size,
+		          error );
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) wide_string,
+		          wide_string_size,
+		          libclocale_codepage,
+		          narrow_string_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) wide_string,
+		          wide_string_size,
+		          libclocale_codepage,
+		          narrow_string_size,
+		          error );
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a narrow string from a wide string
+ * The narrow string is in the codepage of the system or UTF-8 if not set
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_narrow_string_copy_from_wide_string(
+     char *narrow_string,
+     size_t narrow_string_size,
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmodi_narrow_string_copy_from_wide_string";
+	int result            = 0;
+
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) narrow_string,
+		          narrow_string_size,
+		          (libuna_utf32_character_t *) wide_string,
+		          wide_string_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) narrow_string,
+		          narrow_string_size,
+		          (libuna_utf16_character_t *) wide_string,
+		          wide_string_size,
+		          error );
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) narrow_string,
+		          narrow_string_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) wide_string,
+		          wide_string_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) narrow_string,
+		          narrow_string_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) wide_string,
+		          wide_string_size,
+		          error );
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
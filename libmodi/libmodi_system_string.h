@@ -85,6 +85,19 @@ int libmodi_system_string_copy_from_wide_string(
      size_t wide_string_size,
      libcerror_error_t **error );
 
+int libmodi_narrow_string_size_from_wide_string(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *narrow_string_size,
+     libcerror_error_t **error );
+
+int libmodi_narrow_string_copy_from_wide_string(
+     char *narrow_string,
+     size_t narrow_string_size,
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #if defined( __cplusplus )
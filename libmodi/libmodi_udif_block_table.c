@@ -165,6 +165,11 @@ int libmodi_udif_block_table_free(
 
 			result = -1;
 		}
+		if( ( *block_table )->name != NULL )
+		{
+			memory_free(
+			 ( *block_table )->name );
+		}
 		memory_free(
 		 *block_table );
 
@@ -42,6 +42,22 @@ struct libmodi_udif_block_table
 	 */
 	uint64_t start_sector;
 
+	/* The identifier
+	 */
+	int32_t identifier;
+
+	/* The attributes
+	 */
+	uint32_t attributes;
+
+	/* The name
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
 	/* The entries array
 	 */
 	libcdata_array_t *entries_array;
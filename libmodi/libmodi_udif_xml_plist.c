@@ -27,6 +27,7 @@
 #include "libmodi_libcerror.h"
 #include "libmodi_libcnotify.h"
 #include "libmodi_libfplist.h"
+#include "libmodi_libfvalue.h"
 #include "libmodi_udif_block_table.h"
 #include "libmodi_udif_xml_plist.h"
 
@@ -397,6 +398,20 @@ int libmodi_udif_xml_plist_read_blkx_array_entry_property(
 
 			goto on_error;
 		}
+		if( libmodi_udif_xml_plist_read_blkx_array_entry_values(
+		     block_table,
+		     array_entry_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read blkx array entry values.",
+			 function );
+
+			goto on_error;
+		}
 		/* block_table->entries_array takes over management of block_table_entry
 		 */
 		if( libcdata_array_append_entry(
@@ -458,6 +473,326 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the name, identifier and attributes of an UDIF XML plist blkx array entry property
+ * Returns 1 if successful or -1 on error
+ */
+int libmodi_udif_xml_plist_read_blkx_array_entry_values(
+     libmodi_udif_block_table_t *block_table,
+     libfplist_property_t *array_entry_property,
+     libcerror_error_t **error )
+{
+	libfplist_property_t *sub_property = NULL;
+	uint8_t *string                    = NULL;
+	static char *function              = "libmodi_udif_xml_plist_read_blkx_array_entry_values";
+	size_t string_size                 = 0;
+	uint64_t value_64bit               = 0;
+	int result                         = 0;
+
+	if( block_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block table.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_table->name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block table - name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The blkx array entry name is stored in the Name string, older
+	 * images only have the CFName string
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          array_entry_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libfplist_property_get_sub_property_by_utf8_name(
+		          array_entry_property,
+		          (uint8_t *) "CFName",
+		          6,
+		          &sub_property,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Name sub property.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 1 )
+	{
+		if( libfplist_property_get_value_string(
+		     sub_property,
+		     &( block_table->name ),
+		     &( block_table->name_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Name value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfplist_property_free(
+		     &sub_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Name sub property.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          array_entry_property,
+	          (uint8_t *) "ID",
+	          2,
+	          &sub_property,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ID sub property.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 1 )
+	{
+		if( libfplist_property_get_value_string(
+		     sub_property,
+		     &string,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve ID value.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( string == NULL )
+		 || ( string_size < 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ID value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_utf8_string_copy_to_integer(
+		     string,
+		     string_size - 1,
+		     &value_64bit,
+		     32,
+		     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_SIGNED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy ID value to integer.",
+			 function );
+
+			goto on_error;
+		}
+		block_table->identifier = (int32_t) value_64bit;
+
+		memory_free(
+		 string );
+
+		string = NULL;
+
+		if( libfplist_property_free(
+		     &sub_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free ID sub property.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          array_entry_property,
+	          (uint8_t *) "Attributes",
+	          10,
+	          &sub_property,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Attributes sub property.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 1 )
+	{
+		if( libfplist_property_get_value_string(
+		     sub_property,
+		     &string,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Attributes value.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( string == NULL )
+		 || ( string_size < 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Attributes value.",
+			 function );
+
+			goto on_error;
+		}
+		/* The attributes are stored as a hexadecimal string, e.g. 0x0050
+		 */
+		if( libfvalue_utf8_string_copy_to_integer(
+		     string,
+		     string_size - 1,
+		     &value_64bit,
+		     32,
+		     LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy Attributes value to integer.",
+			 function );
+
+			goto on_error;
+		}
+		block_table->attributes = (uint32_t) value_64bit;
+
+		memory_free(
+		 string );
+
+		string = NULL;
+
+		if( libfplist_property_free(
+		     &sub_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Attributes sub property.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( block_table->name != NULL )
+		{
+			libcnotify_printf(
+			 "%s: name\t\t\t\t\t: %s\n",
+			 function,
+			 (char *) block_table->name );
+		}
+		libcnotify_printf(
+		 "%s: identifier\t\t\t\t: %" PRIi32 "\n",
+		 function,
+		 block_table->identifier );
+
+		libcnotify_printf(
+		 "%s: attributes\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 block_table->attributes );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( block_table->name != NULL )
+	{
+		memory_free(
+		 block_table->name );
+
+		block_table->name = NULL;
+	}
+	block_table->name_size = 0;
+
+	return( -1 );
+}
+
 /* Reads an UDIF XML plist
  * Returns 1 if successful or -1 on error
  */
@@ -62,6 +62,11 @@ int libmodi_udif_xml_plist_read_blkx_array_entry_property(
      libfplist_property_t *array_entry_property,
      libcerror_error_t **error );
 
+int libmodi_udif_xml_plist_read_blkx_array_entry_values(
+     libmodi_udif_block_table_t *block_table,
+     libfplist_property_t *array_entry_property,
+     libcerror_error_t **error );
+
 int libmodi_udif_xml_plist_read_data(
      libmodi_udif_xml_plist_t *udif_xml_plist,
      const uint8_t *data,
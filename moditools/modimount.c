@@ -59,6 +59,22 @@
 mount_handle_t *modimount_mount_handle = NULL;
 int modimount_abort                    = 0;
 
+/* The maximum number of open file handles divided between the handles of the source images
+ */
+#define MODIMOUNT_MAXIMUM_NUMBER_OF_OPEN_HANDLES	1024
+
+/* The minimum number of open file handles per handle of a source image
+ */
+#define MODIMOUNT_MINIMUM_NUMBER_OF_OPEN_HANDLES	1
+
+/* The maximum cache size divided between the handles of the source images
+ */
+#define MODIMOUNT_MAXIMUM_CACHE_SIZE		( 256 * 1024 * 1024 )
+
+/* The maximum number of threads, every thread opens an additional handle of every source image
+ */
+#define MODIMOUNT_MAXIMUM_NUMBER_OF_THREADS	64
+
 /* Signal handler for modimount
  */
 void modimount_signal_handler(
@@ -103,6 +119,70 @@ void modimount_signal_handler(
 	}
 }
 
+/* Determines the number of threads from a string containing a decimal value
+ * Returns 1 if successful, 0 if the string is not supported or -1 on error
+ */
+int modimount_get_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "modimount_get_number_of_threads";
+	size_t string_index   = 0;
+	int value             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value > MODIMOUNT_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	if( value == 0 )
+	{
+		return( 0 );
+	}
+	*number_of_threads = value;
+
+	return( 1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -116,46 +196,56 @@ int main( int argc, char * const argv[] )
 
 	moditools_option_t options[ ] = {
 		{ 'h', NULL, "shows this help" },
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) || defined( HAVE_LIBDOKAN )
+		{ 't', "number_of_threads", "number of threads used to read the source images concurrently, the default is 1" },
+#endif
 		{ 'v', NULL, "verbose output to stderr, while modimount will remain running in the foreground" },
 		{ 'V', NULL, "print version" },
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 		{ 'X', "extended_options", "extended options to pass to sub system" },
 #endif
-		{ 0, "image", "a Mac OS disk image file" },
+		{ 0, "image", "one or more Mac OS disk image files, exposed as modi1 up to modiN" },
 		{ 0, "mount_point", "the directory to serve as mount point" },
 	};
 	system_character_t options_string[ 32 ];
 
-	libmodi_error_t *error                      = NULL;
-	const system_character_t *path_prefix       = NULL;
-	system_character_t *source                  = NULL;
-	char *program                               = "modimount";
-	system_integer_t option                     = 0;
-	size_t path_prefix_size                     = 0;
-	int number_of_options                       = (int) ( sizeof( options ) / sizeof( moditools_option_t ) );
-	int verbose                                 = 0;
+	libmodi_error_t *error                       = NULL;
+	const system_character_t *path_prefix        = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "modimount";
+	system_integer_t option                      = 0;
+	size_t path_prefix_size                      = 0;
+	int first_source_index                       = 0;
+	int maximum_number_of_open_handles           = 0;
+	int number_of_image_handles                  = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( moditools_option_t ) );
+	int number_of_sources                        = 0;
+	int number_of_threads                        = 1;
+	int source_index                             = 0;
+	int verbose                                  = 0;
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) || defined( HAVE_LIBDOKAN )
-	system_character_t *mount_point             = NULL;
-	int result                                  = 0;
+	system_character_t *mount_point              = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	int result                                   = 0;
 #endif
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 	struct fuse_operations modimount_fuse_operations;
 
-	system_character_t *option_extended_options = NULL;
+	system_character_t *option_extended_options  = NULL;
 
 #if defined( HAVE_LIBFUSE3 )
 	/* Need to set this to 1 even if there no arguments, otherwise this causes
 	 * fuse: empty argv passed to fuse_session_new()
 	 */
-	char *fuse_argv[ 2 ]                        = { program, NULL };
-	struct fuse_args modimount_fuse_arguments   = FUSE_ARGS_INIT(1, fuse_argv);
+	char *fuse_argv[ 2 ]                         = { program, NULL };
+	struct fuse_args modimount_fuse_arguments    = FUSE_ARGS_INIT(1, fuse_argv);
 #else
-	struct fuse_args modimount_fuse_arguments   = FUSE_ARGS_INIT(0, NULL);
-	struct fuse_chan *modimount_fuse_channel    = NULL;
+	struct fuse_args modimount_fuse_arguments    = FUSE_ARGS_INIT(0, NULL);
+	struct fuse_chan *modimount_fuse_channel     = NULL;
 #endif
-	struct fuse *modimount_fuse_handle          = NULL;
+	struct fuse *modimount_fuse_handle           = NULL;
 
 #elif defined( HAVE_LIBDOKAN )
 	DOKAN_OPERATIONS modimount_dokan_operations;
@@ -242,6 +332,13 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) || defined( HAVE_LIBDOKAN )
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+#endif
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -276,9 +373,10 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind++ ];
+	first_source_index = optind;
+	number_of_sources  = argc - optind - 1;
 
-	if( optind == argc )
+	if( number_of_sources <= 0 )
 	{
 		fprintf(
 		 stderr,
@@ -294,8 +392,54 @@ int main( int argc, char * const argv[] )
 		return( EXIT_FAILURE );
 	}
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) || defined( HAVE_LIBDOKAN )
-	mount_point = argv[ optind ];
+	mount_point = argv[ argc - 1 ];
+
+	if( option_number_of_threads != NULL )
+	{
+		result = modimount_get_number_of_threads(
+		          option_number_of_threads,
+		          &number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+			 option_number_of_threads );
+
+			moditools_getopt_usage_fprint(
+			 stdout,
+			 program,
+			 description,
+			 options,
+			 number_of_options );
+
+			return( EXIT_FAILURE );
+		}
+	}
+#if !defined( LIBMODI_HAVE_MULTI_THREAD_SUPPORT )
+	/* Concurrent requests require the handles to be thread-safe
+	 */
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multiple threads not supported, libmodi was built without multi-thread support.\n" );
+
+		return( EXIT_FAILURE );
+	}
 #endif
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) || defined( HAVE_LIBDOKAN ) */
+
 	libcnotify_verbose_set(
 	 verbose );
 	libmodi_notify_set_stream(
@@ -334,25 +478,126 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( mount_handle_open(
+	if( mount_handle_set_number_of_threads(
 	     modimount_mount_handle,
-	     source,
+	     number_of_threads,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to open source image\n" );
+		 "Unable to set number of threads.\n" );
 
 		goto on_error;
 	}
-#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
-	if( option_extended_options != NULL )
+	/* Divide the open file handle and cache budgets between the handles of the source images,
+	 * so that mounting many images or using many threads does not exhaust the file descriptors or memory
+	 */
+	number_of_image_handles = number_of_sources * number_of_threads;
+
+	if( number_of_image_handles > ( MODIMOUNT_MAXIMUM_NUMBER_OF_OPEN_HANDLES / MODIMOUNT_MINIMUM_NUMBER_OF_OPEN_HANDLES ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of source images: %d with number of threads: %d, the maximum number of open handles: %d would be exceeded.\n",
+		 number_of_sources,
+		 number_of_threads,
+		 MODIMOUNT_MAXIMUM_NUMBER_OF_OPEN_HANDLES );
+
+		goto on_error;
+	}
+	if( number_of_image_handles > 1 )
 	{
+		maximum_number_of_open_handles = MODIMOUNT_MAXIMUM_NUMBER_OF_OPEN_HANDLES / number_of_image_handles;
+
+		if( mount_handle_set_maximum_number_of_open_handles(
+		     modimount_mount_handle,
+		     maximum_number_of_open_handles,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of open handles.\n" );
+
+			goto on_error;
+		}
+		/* The cache size of each image is at least a single data block
+		 */
+		if( mount_handle_set_maximum_cache_size(
+		     modimount_mount_handle,
+		     (size64_t) ( MODIMOUNT_MAXIMUM_CACHE_SIZE / number_of_image_handles ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum cache size.\n" );
+
+			goto on_error;
+		}
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		source = argv[ first_source_index + source_index ];
+
+		if( mount_handle_open(
+		     modimount_mount_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source image: %" PRIs_SYSTEM "\n",
+			 source );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 #if defined( HAVE_LIBFUSE3 )
-		// fuse_opt_add_arg: Assertion `!args->argv || args->allocated' failed.
-		modimount_fuse_arguments.argc = 0;
-		modimount_fuse_arguments.argv = NULL;
+	// fuse_opt_add_arg: Assertion `!args->argv || args->allocated' failed.
+	modimount_fuse_arguments.argc = 0;
+	modimount_fuse_arguments.argv = NULL;
+
+	/* This argument is required but ignored
+	 */
+	if( fuse_opt_add_arg(
+	     &modimount_fuse_arguments,
+	     "" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	/* The cache options are added before the extended options
+	 * so that the extended options override them
+	 */
+	if( fuse_opt_add_arg(
+	     &modimount_fuse_arguments,
+	     "-o" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &modimount_fuse_arguments,
+	     MOUNT_FUSE_CACHE_OPTIONS ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
 #endif
+	if( option_extended_options != NULL )
+	{
+#if !defined( HAVE_LIBFUSE3 )
 		/* This argument is required but ignored
 		 */
 		if( fuse_opt_add_arg(
@@ -365,6 +610,7 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+#endif
 		if( fuse_opt_add_arg(
 		     &modimount_fuse_arguments,
 		     "-o" ) != 0 )
@@ -404,8 +650,17 @@ int main( int argc, char * const argv[] )
 	modimount_fuse_operations.readdir    = &mount_fuse_readdir;
 	modimount_fuse_operations.releasedir = &mount_fuse_releasedir;
 	modimount_fuse_operations.getattr    = &mount_fuse_getattr;
+	modimount_fuse_operations.init       = &mount_fuse_init;
 	modimount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( HAVE_MOUNT_FUSE_READ_BUF )
+	modimount_fuse_operations.read_buf   = &mount_fuse_read_buf;
+#endif
+
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+	modimount_fuse_operations.lseek      = &mount_fuse_lseek;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	modimount_fuse_handle = fuse_new(
 	                         &modimount_fuse_arguments,
@@ -475,8 +730,25 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = fuse_loop(
-	          modimount_fuse_handle );
+	/* The multi-threaded loop creates the threads on demand, the number
+	 * of threads that read an image concurrently is bound by its handles
+	 */
+	if( number_of_threads > 1 )
+	{
+#if defined( HAVE_LIBFUSE3 )
+		result = fuse_loop_mt(
+		          modimount_fuse_handle,
+		          0 );
+#else
+		result = fuse_loop_mt(
+		          modimount_fuse_handle );
+#endif
+	}
+	else
+	{
+		result = fuse_loop(
+		          modimount_fuse_handle );
+	}
 
 	if( result != 0 )
 	{
@@ -521,9 +793,23 @@ int main( int argc, char * const argv[] )
 	modimount_dokan_options.MountPoint = mount_point;
 
 #if DOKAN_MINIMUM_COMPATIBLE_VERSION >= 200
-	modimount_dokan_options.SingleThread = TRUE;
+	if( number_of_threads > 1 )
+	{
+		modimount_dokan_options.SingleThread = FALSE;
+	}
+	else
+	{
+		modimount_dokan_options.SingleThread = TRUE;
+	}
 #else
-	modimount_dokan_options.ThreadCount  = 0;
+	if( number_of_threads > 1 )
+	{
+		modimount_dokan_options.ThreadCount = (USHORT) number_of_threads;
+	}
+	else
+	{
+		modimount_dokan_options.ThreadCount = 0;
+	}
 #endif
 	if( verbose != 0 )
 	{
@@ -53,9 +53,12 @@ int mount_file_entry_initialize(
      const system_character_t *name,
      size_t name_length,
      libmodi_handle_t *modi_handle,
+     int partition_index,
      libcerror_error_t **error )
 {
-	static char *function = "mount_file_entry_initialize";
+	static char *function         = "mount_file_entry_initialize";
+	uint32_t partition_attributes = 0;
+	int32_t partition_identifier  = 0;
 
 	if( file_entry == NULL )
 	{
@@ -173,8 +176,48 @@ int mount_file_entry_initialize(
 
 		( *file_entry )->name_size = name_length + 1;
 	}
-	( *file_entry )->modi_handle = modi_handle;
+	( *file_entry )->modi_handle     = modi_handle;
+	( *file_entry )->partition_index = partition_index;
 
+	if( modi_handle != NULL )
+	{
+		if( partition_index >= 0 )
+		{
+			if( libmodi_handle_get_partition_by_index(
+			     modi_handle,
+			     partition_index,
+			     &( ( *file_entry )->data_offset ),
+			     &( ( *file_entry )->data_size ),
+			     &partition_identifier,
+			     &partition_attributes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition: %d from handle.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		else if( libmodi_handle_get_media_size(
+		          modi_handle,
+		          &( ( *file_entry )->data_size ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve media size from handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -193,6 +236,61 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a file entry of the statistics file
+ * The statistics are retrieved when the file entry is created
+ * Make sure the value file_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_initialize_statistics(
+     mount_file_entry_t **file_entry,
+     mount_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	static char *function       = "mount_file_entry_initialize_statistics";
+	size_t statistics_data_size = 0;
+
+	if( mount_file_entry_initialize(
+	     file_entry,
+	     file_system,
+	     MOUNT_FILE_SYSTEM_STATISTICS_NAME,
+	     MOUNT_FILE_SYSTEM_STATISTICS_NAME_LENGTH,
+	     NULL,
+	     -1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_statistics_data(
+	     file_system,
+	     &( ( *file_entry )->statistics_data ),
+	     &statistics_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics data.",
+		 function );
+
+		mount_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+	( *file_entry )->data_size = (size64_t) statistics_data_size;
+
+	return( 1 );
+}
+
 /* Frees a file entry
  * Returns 1 if successful or -1 on error
  */
@@ -215,6 +313,11 @@ int mount_file_entry_free(
 	}
 	if( *file_entry != NULL )
 	{
+		if( ( *file_entry )->statistics_data != NULL )
+		{
+			memory_free(
+			 ( *file_entry )->statistics_data );
+		}
 		if( ( *file_entry )->name != NULL )
 		{
 			memory_free(
@@ -271,7 +374,8 @@ int mount_file_entry_get_parent_file_entry(
 
 		return( -1 );
 	}
-	if( file_entry->modi_handle != NULL )
+	if( ( file_entry->modi_handle != NULL )
+	 || ( file_entry->statistics_data != NULL ) )
 	{
 		if( mount_file_entry_initialize(
 		     parent_file_entry,
@@ -279,6 +383,7 @@ int mount_file_entry_get_parent_file_entry(
 		     _SYSTEM_STRING( "" ),
 		     0,
 		     NULL,
+		     -1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -455,6 +560,34 @@ int mount_file_entry_get_inode_change_time(
 	return( 1 );
 }
 
+/* Determines if the file entry represents the statistics file
+ * The data of the statistics file changes while mounted
+ * Returns 1 if the file entry represents the statistics file, 0 if not or -1 on error
+ */
+int mount_file_entry_is_statistics(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_is_statistics";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->statistics_data == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the file mode
  * Returns 1 if successful or -1 on error
  */
@@ -487,7 +620,8 @@ int mount_file_entry_get_file_mode(
 
 		return( -1 );
 	}
-	if( file_entry->modi_handle == NULL )
+	if( ( file_entry->modi_handle == NULL )
+	 && ( file_entry->statistics_data == NULL ) )
 	{
 		*file_mode = S_IFDIR | 0555;
 	}
@@ -631,7 +765,7 @@ int mount_file_entry_get_number_of_sub_file_entries(
      libcerror_error_t **error )
 {
 	static char *function = "mount_file_entry_get_number_of_sub_file_entries";
-	int number_of_handles = 0;
+	int number_of_files   = 0;
 
 	if( file_entry == NULL )
 	{
@@ -655,36 +789,28 @@ int mount_file_entry_get_number_of_sub_file_entries(
 
 		return( -1 );
 	}
-	if( file_entry->modi_handle == NULL )
+	if( ( file_entry->modi_handle == NULL )
+	 && ( file_entry->statistics_data == NULL ) )
 	{
-		if( mount_file_system_get_number_of_handles(
+		if( mount_file_system_get_number_of_files(
 		     file_entry->file_system,
-		     &number_of_handles,
+		     &number_of_files,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of handles.",
-			 function );
-
-			return( -1 );
-		}
-		if( ( number_of_handles < 0 )
-		 || ( number_of_handles > 999 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported number of handles.",
+			 "%s: unable to retrieve number of files.",
 			 function );
 
 			return( -1 );
 		}
+		/* The statistics file follows the files of the handles
+		 */
+		number_of_files += 1;
 	}
-	*number_of_sub_file_entries = number_of_handles;
+	*number_of_sub_file_entries = number_of_files;
 
 	return( 1 );
 }
@@ -703,7 +829,9 @@ int mount_file_entry_get_sub_file_entry_by_index(
 	libmodi_handle_t *modi_handle  = NULL;
 	static char *function          = "mount_file_entry_get_sub_file_entry_by_index";
 	size_t path_length             = 0;
+	int handle_index               = 0;
 	int number_of_sub_file_entries = 0;
+	int partition_index            = 0;
 
 	if( file_entry == NULL )
 	{
@@ -764,9 +892,45 @@ int mount_file_entry_get_sub_file_entry_by_index(
 
 		return( -1 );
 	}
-	if( mount_file_system_get_path_from_handle_index(
+	if( sub_file_entry_index == ( number_of_sub_file_entries - 1 ) )
+	{
+		if( mount_file_entry_initialize_statistics(
+		     sub_file_entry,
+		     file_entry->file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize statistics sub file entry.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( mount_file_system_get_file_by_index(
 	     file_entry->file_system,
 	     sub_file_entry_index,
+	     &handle_index,
+	     &partition_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d from file system.",
+		 function,
+		 sub_file_entry_index );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_path_from_handle_index(
+	     file_entry->file_system,
+	     handle_index,
+	     partition_index,
 	     path,
 	     32,
 	     error ) != 1 )
@@ -783,7 +947,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 	}
 	if( mount_file_system_get_handle_by_index(
 	     file_entry->file_system,
-	     sub_file_entry_index,
+	     handle_index,
 	     &modi_handle,
 	     error ) != 1 )
 	{
@@ -793,7 +957,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve handle: %d from file system.",
 		 function,
-		 sub_file_entry_index );
+		 handle_index );
 
 		return( -1 );
 	}
@@ -805,7 +969,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: missing handle: %d.",
 		 function,
-		 sub_file_entry_index );
+		 handle_index );
 
 		return( -1 );
 	}
@@ -818,6 +982,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 	     &( path[ 1 ] ),
 	     path_length - 1,
 	     modi_handle,
+	     partition_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -843,8 +1008,9 @@ ssize_t mount_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function = "mount_file_entry_read_buffer_at_offset";
-	ssize_t read_count    = 0;
+	libmodi_handle_t *modi_handle = NULL;
+	static char *function         = "mount_file_entry_read_buffer_at_offset";
+	ssize_t read_count            = 0;
 
 	if( file_entry == NULL )
 	{
@@ -857,11 +1023,78 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->statistics_data != NULL )
+	{
+		if( (size64_t) offset >= file_entry->data_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) buffer_size > ( file_entry->data_size - (size64_t) offset ) )
+		{
+			buffer_size = (size_t) ( file_entry->data_size - (size64_t) offset );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( file_entry->statistics_data[ offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy statistics data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+	/* A partition is read as a range of the (media) data
+	 */
+	if( file_entry->partition_index >= 0 )
+	{
+		if( (size64_t) offset >= file_entry->data_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) buffer_size > ( file_entry->data_size - (size64_t) offset ) )
+		{
+			buffer_size = (size_t) ( file_entry->data_size - (size64_t) offset );
+		}
+	}
+	/* Concurrent reads of the same image are spread over the read handles of the image
+	 */
+	if( mount_file_system_get_read_handle(
+	     file_entry->file_system,
+	     file_entry->modi_handle,
+	     &modi_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read handle.",
+		 function );
+
+		return( -1 );
+	}
 	read_count = libmodi_handle_read_buffer_at_offset(
-	              file_entry->modi_handle,
+	              modi_handle,
 	              buffer,
 	              buffer_size,
-	              offset,
+	              file_entry->data_offset + offset,
 	              error );
 
 	if( read_count < 0 )
@@ -901,38 +1134,198 @@ int mount_file_entry_get_size(
 
 		return( -1 );
 	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data size is 0 for the root directory, the media size for an image,
+	 * the partition size for a partition and the size of the statistics data
+	 * for the statistics file
+	 */
+	*size = file_entry->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the allocated size
+ * The allocated size is the size of the data that is not sparse
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_allocated_size(
+     mount_file_entry_t *file_entry,
+     size64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_allocated_size";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size = 0;
+
+	if( file_entry->statistics_data != NULL )
+	{
+		*allocated_size = file_entry->data_size;
+
+		return( 1 );
+	}
 	if( file_entry->modi_handle == NULL )
 	{
-		if( size == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid size.",
-			 function );
+		return( 1 );
+	}
+	if( mount_file_system_get_allocated_size(
+	     file_entry->file_system,
+	     file_entry->modi_handle,
+	     file_entry->partition_index,
+	     allocated_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve allocated size from file system.",
+		 function );
 
-			return( -1 );
-		}
-		*size = 0;
+		return( -1 );
 	}
-	else
+	return( 1 );
+}
+
+/* Seeks the next data or hole at or after a specific offset
+ * The whence value is either LIBMODI_SEEK_DATA or LIBMODI_SEEK_HOLE
+ * This does not change the current offset of the handle
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int mount_file_entry_seek_data_or_hole(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     int whence,
+     off64_t *data_or_hole_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_seek_data_or_hole";
+	int result            = 0;
+
+	if( file_entry == NULL )
 	{
-		if( libmodi_handle_get_media_size(
-		     file_entry->modi_handle,
-		     size,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != LIBMODI_SEEK_DATA )
+	 && ( whence != LIBMODI_SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= file_entry->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_or_hole_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data or hole offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The statistics file contains no holes
+	 */
+	if( file_entry->statistics_data != NULL )
+	{
+		if( whence == LIBMODI_SEEK_HOLE )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve media size from handle.",
-			 function );
+			*data_or_hole_offset = (off64_t) file_entry->data_size;
+		}
+		else
+		{
+			*data_or_hole_offset = offset;
+		}
+		return( 1 );
+	}
+	result = libmodi_handle_get_data_or_hole_offset(
+	          file_entry->modi_handle,
+	          file_entry->data_offset + offset,
+	          whence,
+	          data_or_hole_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data or hole offset from handle.",
+		 function );
 
-			return( -1 );
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	*data_or_hole_offset -= file_entry->data_offset;
+
+	/* The end of a partition is considered a hole
+	 */
+	if( (size64_t) *data_or_hole_offset >= file_entry->data_size )
+	{
+		if( whence == LIBMODI_SEEK_DATA )
+		{
+			return( 0 );
 		}
+		*data_or_hole_offset = (off64_t) file_entry->data_size;
 	}
 	return( 1 );
 }
-
@@ -52,6 +52,23 @@ struct mount_file_entry
 	/* The handle
 	 */
 	libmodi_handle_t *modi_handle;
+
+	/* The partition index or -1 if the file entry represents the entire image
+	 */
+	int partition_index;
+
+	/* The (media) offset of the data
+	 */
+	off64_t data_offset;
+
+	/* The size of the data
+	 */
+	size64_t data_size;
+
+	/* The statistics data or NULL if the file entry does not represent
+	 * the statistics file
+	 */
+	uint8_t *statistics_data;
 };
 
 int mount_file_entry_initialize(
@@ -60,6 +77,12 @@ int mount_file_entry_initialize(
      const system_character_t *name,
      size_t name_length,
      libmodi_handle_t *modi_handle,
+     int partition_index,
+     libcerror_error_t **error );
+
+int mount_file_entry_initialize_statistics(
+     mount_file_entry_t **file_entry,
+     mount_file_system_t *file_system,
      libcerror_error_t **error );
 
 int mount_file_entry_free(
@@ -91,6 +114,10 @@ int mount_file_entry_get_inode_change_time(
      uint64_t *inode_change_time,
      libcerror_error_t **error );
 
+int mount_file_entry_is_statistics(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_file_mode(
      mount_file_entry_t *file_entry,
      uint16_t *file_mode,
@@ -130,6 +157,18 @@ int mount_file_entry_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+int mount_file_entry_get_allocated_size(
+     mount_file_entry_t *file_entry,
+     size64_t *allocated_size,
+     libcerror_error_t **error );
+
+int mount_file_entry_seek_data_or_hole(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     int whence,
+     off64_t *data_or_hole_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
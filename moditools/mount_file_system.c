@@ -41,6 +41,43 @@
 #include "moditools_libmodi.h"
 #include "mount_file_system.h"
 
+/* The read handle counter is incremented atomically where supported by the compiler,
+ * otherwise concurrent reads can pick the same handle, which is safe since
+ * the handle serializes the reads
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define MOUNT_FILE_SYSTEM_INCREMENT_READ_HANDLE_COUNTER( file_system ) \
+	__atomic_fetch_add( &( ( file_system )->read_handle_counter ), 1, __ATOMIC_RELAXED )
+
+#elif defined( _MSC_VER )
+#define MOUNT_FILE_SYSTEM_INCREMENT_READ_HANDLE_COUNTER( file_system ) \
+	(uint32_t) InterlockedIncrement( (LONG volatile *) &( ( file_system )->read_handle_counter ) )
+
+#else
+#define MOUNT_FILE_SYSTEM_INCREMENT_READ_HANDLE_COUNTER( file_system ) \
+	( file_system )->read_handle_counter++
+
+#endif
+
+/* The allocated size is set before the value that indicates it was determined,
+ * so that concurrent requests never see a partially determined allocated size
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define MOUNT_FILE_SYSTEM_GET_ALLOCATED_SIZE_IS_SET( allocated_size ) \
+	__atomic_load_n( &( ( allocated_size )->allocated_size_is_set ), __ATOMIC_ACQUIRE )
+
+#define MOUNT_FILE_SYSTEM_SET_ALLOCATED_SIZE_IS_SET( allocated_size ) \
+	__atomic_store_n( &( ( allocated_size )->allocated_size_is_set ), 1, __ATOMIC_RELEASE )
+
+#else
+#define MOUNT_FILE_SYSTEM_GET_ALLOCATED_SIZE_IS_SET( allocated_size ) \
+	( (volatile mount_file_system_allocated_size_t *) ( allocated_size ) )->allocated_size_is_set
+
+#define MOUNT_FILE_SYSTEM_SET_ALLOCATED_SIZE_IS_SET( allocated_size ) \
+	( (volatile mount_file_system_allocated_size_t *) ( allocated_size ) )->allocated_size_is_set = 1
+
+#endif
+
 /* Creates a file system
  * Make sure the value file_system is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -134,6 +171,20 @@ int mount_file_system_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( ( *file_system )->read_handles_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read handles array.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( WINAPI )
 	if( memory_set(
 	     &systemtime,
@@ -213,6 +264,13 @@ int mount_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+		if( ( *file_system )->handles_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *file_system )->handles_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *file_system );
 
@@ -249,6 +307,11 @@ int mount_file_system_free(
 			memory_free(
 			 ( *file_system )->path_prefix );
 		}
+		if( ( *file_system )->allocated_sizes != NULL )
+		{
+			memory_free(
+			 ( *file_system )->allocated_sizes );
+		}
 		if( libcdata_array_free(
 		     &( ( *file_system )->handles_array ),
 		     NULL,
@@ -263,6 +326,20 @@ int mount_file_system_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *file_system )->read_handles_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read handles array.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *file_system );
 
@@ -343,6 +420,55 @@ int mount_file_system_signal_abort(
 			return( -1 );
 		}
 	}
+	if( libcdata_array_get_number_of_entries(
+	     file_system->read_handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of read handles.",
+		 function );
+
+		return( -1 );
+	}
+	for( handle_index = number_of_handles - 1;
+	     handle_index >= 0;
+	     handle_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system->read_handles_array,
+		     handle_index,
+		     (intptr_t **) &modi_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+		if( libmodi_handle_signal_abort(
+		     modi_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal read handle: %d to abort.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -577,7 +703,8 @@ int mount_file_system_get_handle_by_index(
 	return( 1 );
 }
 
-/* Retrieves the handle for a specific path
+/* Retrieves the handle and partition index for a specific path
+ * The partition index is -1 if the path refers to the entire image
  * Returns 1 if successful, 0 if no such handle or -1 on error
  */
 int mount_file_system_get_handle_by_path(
@@ -585,12 +712,15 @@ int mount_file_system_get_handle_by_path(
      const system_character_t *path,
      size_t path_length,
      libmodi_handle_t **modi_handle,
+     int *partition_index,
      libcerror_error_t **error )
 {
 	static char *function        = "mount_file_system_get_handle_by_path";
 	system_character_t character = 0;
 	size_t path_index            = 0;
+	size_t number_of_digits      = 0;
 	int handle_index             = 0;
+	int number_of_partitions     = 0;
 	int result                   = 0;
 
 	if( file_system == NULL )
@@ -648,18 +778,33 @@ int mount_file_system_get_handle_by_path(
 
 		return( -1 );
 	}
+	if( partition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition index.",
+		 function );
+
+		return( -1 );
+	}
 	path_length = system_string_length(
 	               path );
 
 	if( ( path_length == 1 )
 	 && ( path[ 0 ] == file_system->path_prefix[ 0 ] ) )
 	{
-		*modi_handle = NULL;
+		*modi_handle     = NULL;
+		*partition_index = -1;
 
 		return( 1 );
 	}
+	/* The path consists of the path prefix, a handle number of up to 3 digits
+	 * and optionally 'p' followed by a partition number of up to 3 digits
+	 */
 	if( ( path_length < file_system->path_prefix_size )
-	 || ( path_length > ( file_system->path_prefix_size + 3 ) ) )
+	 || ( path_length > ( file_system->path_prefix_size + 6 ) ) )
 	{
 		return( 0 );
 	}
@@ -678,29 +823,73 @@ int mount_file_system_get_handle_by_path(
 	{
 		return( 0 );
 	}
-	handle_index = 0;
+	handle_index     = 0;
+	number_of_digits = 0;
 
 	path_index = file_system->path_prefix_size - 1;
 
 	while( path_index < path_length )
 	{
-		character = path[ path_index++ ];
+		character = path[ path_index ];
 
 		if( ( character < (system_character_t) '0' )
 		 || ( character > (system_character_t) '9' ) )
 		{
-			return( 0 );
+			break;
 		}
 		handle_index *= 10;
 		handle_index += character - (system_character_t) '0';
+
+		number_of_digits++;
+		path_index++;
+	}
+	if( ( number_of_digits == 0 )
+	 || ( number_of_digits > 3 ) )
+	{
+		return( 0 );
 	}
 	handle_index -= 1;
 
-	if( libcdata_array_get_entry_by_index(
-	     file_system->handles_array,
-	     handle_index,
-	     (intptr_t **) modi_handle,
-	     error ) != 1 )
+	*partition_index = -1;
+
+	if( path_index < path_length )
+	{
+		if( path[ path_index++ ] != (system_character_t) 'p' )
+		{
+			return( 0 );
+		}
+		*partition_index = 0;
+		number_of_digits = 0;
+
+		while( path_index < path_length )
+		{
+			character = path[ path_index++ ];
+
+			if( ( character < (system_character_t) '0' )
+			 || ( character > (system_character_t) '9' ) )
+			{
+				return( 0 );
+			}
+			*partition_index *= 10;
+			*partition_index += character - (system_character_t) '0';
+
+			number_of_digits++;
+		}
+		if( ( number_of_digits == 0 )
+		 || ( number_of_digits > 3 )
+		 || ( *partition_index == 0 ) )
+		{
+			return( 0 );
+		}
+		*partition_index -= 1;
+	}
+	result = libcdata_array_get_entry_by_index(
+	          file_system->handles_array,
+	          handle_index,
+	          (intptr_t **) modi_handle,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -712,19 +901,46 @@ int mount_file_system_get_handle_by_path(
 
 		return( -1 );
 	}
+	if( *partition_index != -1 )
+	{
+		if( libmodi_handle_get_number_of_partitions(
+		     *modi_handle,
+		     &number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of partitions of handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+		if( ( *partition_index < 0 )
+		 || ( *partition_index >= number_of_partitions ) )
+		{
+			return( 0 );
+		}
+	}
 	return( 1 );
 }
 
-/* Appends a handle to the file system
+/* Retrieves the number of files
+ * Every handle is published as a file, followed by a file per partition
  * Returns 1 if successful or -1 on error
  */
-int mount_file_system_append_handle(
+int mount_file_system_get_number_of_files(
      mount_file_system_t *file_system,
-     libmodi_handle_t *modi_handle,
+     int *number_of_files,
      libcerror_error_t **error )
 {
-	static char *function = "mount_file_system_append_handle";
-	int entry_index       = 0;
+	libmodi_handle_t *modi_handle = NULL;
+	static char *function         = "mount_file_system_get_number_of_files";
+	int handle_index              = 0;
+	int number_of_handles         = 0;
+	int number_of_partitions      = 0;
 
 	if( file_system == NULL )
 	{
@@ -737,38 +953,102 @@ int mount_file_system_append_handle(
 
 		return( -1 );
 	}
-	if( libcdata_array_append_entry(
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
 	     file_system->handles_array,
-	     &entry_index,
-	     (intptr_t *) modi_handle,
+	     &number_of_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append handle to array.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_files = 0;
+
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system->handles_array,
+		     handle_index,
+		     (intptr_t **) &modi_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+		if( libmodi_handle_get_number_of_partitions(
+		     modi_handle,
+		     &number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of partitions of handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+		if( ( number_of_partitions < 0 )
+		 || ( number_of_partitions > 999 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported number of partitions of handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+		*number_of_files += 1 + number_of_partitions;
+	}
 	return( 1 );
 }
 
-/* Retrieves the path from a handle index.
+/* Retrieves the handle and partition index of a specific file
+ * The partition index is -1 if the file represents the entire image
  * Returns 1 if successful or -1 on error
  */
-int mount_file_system_get_path_from_handle_index(
+int mount_file_system_get_file_by_index(
      mount_file_system_t *file_system,
-     int handle_index,
-     system_character_t *path,
-     size_t path_size,
+     int file_index,
+     int *handle_index,
+     int *partition_index,
      libcerror_error_t **error )
 {
-	static char *function     = "mount_file_system_get_path_from_handle_index";
-	size_t path_index         = 0;
-	size_t required_path_size = 0;
-	int handle_number         = 0;
+	libmodi_handle_t *modi_handle = NULL;
+	static char *function         = "mount_file_system_get_file_by_index";
+	int number_of_handles         = 0;
+	int number_of_partitions      = 0;
+	int safe_handle_index         = 0;
 
 	if( file_system == NULL )
 	{
@@ -781,80 +1061,853 @@ int mount_file_system_get_path_from_handle_index(
 
 		return( -1 );
 	}
-	if( file_system->path_prefix == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system - missing path prefix.",
-		 function );
-
-		return( -1 );
-	}
-	if( path == NULL )
+	if( file_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_size > (size_t) SSIZE_MAX )
+	if( handle_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle index.",
 		 function );
 
 		return( -1 );
 	}
-        required_path_size = file_system->path_prefix_size;
-
-	handle_number = handle_index + 1;
-
-	while( handle_number > 0 )
-	{
-		required_path_size++;
-
-		handle_number /= 10;
-	}
-	if( path_size <= required_path_size )
+	if( partition_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid path size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition index.",
 		 function );
 
 		return( -1 );
 	}
-	if( system_string_copy(
-	     path,
-	     file_system->path_prefix,
-	     file_system->path_prefix_size ) == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     file_system->handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy path prefix.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_handle_index = 0;
+	     safe_handle_index < number_of_handles;
+	     safe_handle_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system->handles_array,
+		     safe_handle_index,
+		     (intptr_t **) &modi_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 safe_handle_index );
+
+			return( -1 );
+		}
+		if( libmodi_handle_get_number_of_partitions(
+		     modi_handle,
+		     &number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of partitions of handle: %d.",
+			 function,
+			 safe_handle_index );
+
+			return( -1 );
+		}
+		if( file_index <= number_of_partitions )
+		{
+			*handle_index    = safe_handle_index;
+			*partition_index = file_index - 1;
+
+			return( 1 );
+		}
+		file_index -= 1 + number_of_partitions;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid file index value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends a handle to the file system
+ * The allocated sizes of the entire image and its partitions are determined on first use
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_append_handle(
+     mount_file_system_t *file_system,
+     libmodi_handle_t *modi_handle,
+     libcerror_error_t **error )
+{
+	mount_file_system_allocated_size_t *allocated_sizes = NULL;
+	static char *function                               = "mount_file_system_append_handle";
+	size_t allocated_sizes_size                         = 0;
+	int allocated_size_index                            = 0;
+	int entry_index                                     = 0;
+	int number_of_partitions                            = 0;
+	int partition_index                                 = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmodi_handle_get_number_of_partitions(
+	     modi_handle,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_partitions < 0 )
+	 || ( number_of_partitions > 999 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	allocated_sizes_size = sizeof( mount_file_system_allocated_size_t ) * ( file_system->number_of_allocated_sizes + 1 + number_of_partitions );
+
+	allocated_sizes = (mount_file_system_allocated_size_t *) memory_reallocate(
+	                                                          file_system->allocated_sizes,
+	                                                          allocated_sizes_size );
+
+	if( allocated_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize allocated sizes.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->allocated_sizes = allocated_sizes;
+
+	allocated_size_index = file_system->number_of_allocated_sizes;
+
+	for( partition_index = -1;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		allocated_sizes[ allocated_size_index ].modi_handle           = modi_handle;
+		allocated_sizes[ allocated_size_index ].partition_index       = partition_index;
+		allocated_sizes[ allocated_size_index ].allocated_size        = 0;
+		allocated_sizes[ allocated_size_index ].allocated_size_is_set = 0;
+
+		allocated_size_index++;
+	}
+	if( libcdata_array_append_entry(
+	     file_system->handles_array,
+	     &entry_index,
+	     (intptr_t *) modi_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append handle to array.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->number_of_allocated_sizes = allocated_size_index;
+
+	return( 1 );
+}
+
+/* Sets the number of read handles per image
+ * The read handles are additional handles of the same image that allow
+ * the data of the image to be read concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_number_of_read_handles(
+     mount_file_system_t *file_system,
+     int number_of_read_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_set_number_of_read_handles";
+	int number_of_handles = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_read_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of read handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     file_system->handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_handles != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - handles already set.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->number_of_read_handles = number_of_read_handles;
+
+	return( 1 );
+}
+
+/* Appends a read handle to the file system
+ * The read handles of an image are appended after its handle
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_append_read_handle(
+     mount_file_system_t *file_system,
+     libmodi_handle_t *modi_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_append_read_handle";
+	int entry_index       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( modi_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     file_system->read_handles_array,
+	     &entry_index,
+	     (intptr_t *) modi_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append read handle to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the handle to read the data of an image
+ * Consecutive calls alternate between the handle and the read handles of the image,
+ * so that concurrent reads of the same image are spread over separate handles
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_read_handle(
+     mount_file_system_t *file_system,
+     libmodi_handle_t *modi_handle,
+     libmodi_handle_t **read_handle,
+     libcerror_error_t **error )
+{
+	libmodi_handle_t *safe_modi_handle = NULL;
+	static char *function              = "mount_file_system_get_read_handle";
+	uint32_t read_handle_counter       = 0;
+	int handle_index                   = 0;
+	int number_of_handles              = 0;
+	int read_handle_index              = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( modi_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->number_of_read_handles == 0 )
+	{
+		*read_handle = modi_handle;
+
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     file_system->handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		return( -1 );
+	}
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system->handles_array,
+		     handle_index,
+		     (intptr_t **) &safe_modi_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+		if( safe_modi_handle == modi_handle )
+		{
+			break;
+		}
+	}
+	if( handle_index >= number_of_handles )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_handle_counter = MOUNT_FILE_SYSTEM_INCREMENT_READ_HANDLE_COUNTER(
+	                       file_system );
+
+	read_handle_index = (int) ( read_handle_counter % (uint32_t) ( file_system->number_of_read_handles + 1 ) );
+
+	if( read_handle_index == 0 )
+	{
+		*read_handle = modi_handle;
+
+		return( 1 );
+	}
+	read_handle_index += ( handle_index * file_system->number_of_read_handles ) - 1;
+
+	if( libcdata_array_get_entry_by_index(
+	     file_system->read_handles_array,
+	     read_handle_index,
+	     (intptr_t **) read_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read handle: %d.",
+		 function,
+		 read_handle_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the allocated size of the entire image or a partition
+ * The allocated size is the size of the data that is not sparse
+ * The partition index is -1 for the entire image
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_determine_allocated_size(
+     libmodi_handle_t *modi_handle,
+     int partition_index,
+     size64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "mount_file_system_determine_allocated_size";
+	size64_t data_size            = 0;
+	size64_t extent_size          = 0;
+	size64_t stored_size          = 0;
+	off64_t data_end              = 0;
+	off64_t data_offset           = 0;
+	off64_t extent_end            = 0;
+	off64_t extent_offset         = 0;
+	uint32_t extent_flags         = 0;
+	uint32_t partition_attributes = 0;
+	int32_t partition_identifier  = 0;
+	int compression_method        = 0;
+	int extent_index              = 0;
+	int number_of_extents         = 0;
+
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_index >= 0 )
+	{
+		if( libmodi_handle_get_partition_by_index(
+		     modi_handle,
+		     partition_index,
+		     &data_offset,
+		     &data_size,
+		     &partition_identifier,
+		     &partition_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d from handle.",
+			 function,
+			 partition_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libmodi_handle_get_media_size(
+		     modi_handle,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve media size from handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	data_end = data_offset + (off64_t) data_size;
+
+	if( libmodi_handle_get_number_of_extents(
+	     modi_handle,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents from handle.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size = 0;
+
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libmodi_handle_get_extent_by_index(
+		     modi_handle,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
+		     &stored_size,
+		     &compression_method,
+		     &extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d from handle.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( extent_flags & LIBMODI_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			continue;
+		}
+		/* Only count the part of the extent that overlaps with the data
+		 */
+		extent_end = extent_offset + (off64_t) extent_size;
+
+		if( extent_offset < data_offset )
+		{
+			extent_offset = data_offset;
+		}
+		if( extent_end > data_end )
+		{
+			extent_end = data_end;
+		}
+		if( extent_offset < extent_end )
+		{
+			*allocated_size += (size64_t) ( extent_end - extent_offset );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the allocated size of the entire image or a partition
+ * The allocated size is determined on first use and cached since it does not
+ * change after the handle has been opened
+ * The partition index is -1 for the entire image
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_allocated_size(
+     mount_file_system_t *file_system,
+     libmodi_handle_t *modi_handle,
+     int partition_index,
+     size64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "mount_file_system_get_allocated_size";
+	size64_t safe_allocated_size = 0;
+	int allocated_size_index     = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	for( allocated_size_index = 0;
+	     allocated_size_index < file_system->number_of_allocated_sizes;
+	     allocated_size_index++ )
+	{
+		if( ( file_system->allocated_sizes[ allocated_size_index ].modi_handle == modi_handle )
+		 && ( file_system->allocated_sizes[ allocated_size_index ].partition_index == partition_index ) )
+		{
+			if( MOUNT_FILE_SYSTEM_GET_ALLOCATED_SIZE_IS_SET(
+			     &( file_system->allocated_sizes[ allocated_size_index ] ) ) == 0 )
+			{
+				/* Concurrent requests can determine the same allocated size
+				 */
+				if( mount_file_system_determine_allocated_size(
+				     modi_handle,
+				     partition_index,
+				     &safe_allocated_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine allocated size of partition: %d.",
+					 function,
+					 partition_index );
+
+					return( -1 );
+				}
+				file_system->allocated_sizes[ allocated_size_index ].allocated_size = safe_allocated_size;
+
+				MOUNT_FILE_SYSTEM_SET_ALLOCATED_SIZE_IS_SET(
+				 &( file_system->allocated_sizes[ allocated_size_index ] ) );
+			}
+			*allocated_size = file_system->allocated_sizes[ allocated_size_index ].allocated_size;
+
+			return( 1 );
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing allocated size of partition: %d.",
+	 function,
+	 partition_index );
+
+	return( -1 );
+}
+
+/* Retrieves the path from a handle index and partition index
+ * The partition index is -1 for the path of the entire image
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_path_from_handle_index(
+     mount_file_system_t *file_system,
+     int handle_index,
+     int partition_index,
+     system_character_t *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "mount_file_system_get_path_from_handle_index";
+	size_t path_index         = 0;
+	size_t required_path_size = 0;
+	int handle_number         = 0;
+	int partition_number      = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( handle_index < 0 )
+	 || ( handle_index > 998 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition_index < -1 )
+	 || ( partition_index > 998 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+        required_path_size = file_system->path_prefix_size;
+
+	handle_number = handle_index + 1;
+
+	while( handle_number > 0 )
+	{
+		required_path_size++;
+
+		handle_number /= 10;
+	}
+	if( partition_index >= 0 )
+	{
+		/* The 'p' separator
+		 */
+		required_path_size++;
+
+		partition_number = partition_index + 1;
+
+		while( partition_number > 0 )
+		{
+			required_path_size++;
+
+			partition_number /= 10;
+		}
+	}
+	if( path_size <= required_path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     path,
+	     file_system->path_prefix,
+	     file_system->path_prefix_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path prefix.",
 		 function );
 
 		return( -1 );
 	}
 	path_index = required_path_size - 1;
 
-	handle_number = handle_index + 1;
-
 	path[ path_index-- ] = 0;
 
+	if( partition_index >= 0 )
+	{
+		partition_number = partition_index + 1;
+
+		while( partition_number > 0 )
+		{
+			path[ path_index-- ] = (system_character_t) '0' + ( partition_number % 10 );
+
+			partition_number /= 10;
+		}
+		path[ path_index-- ] = (system_character_t) 'p';
+	}
+	handle_number = handle_index + 1;
+
 	while( handle_number > 0 )
 	{
 		path[ path_index-- ] = (system_character_t) '0' + ( handle_number % 10 );
@@ -864,3 +1917,533 @@ int mount_file_system_get_path_from_handle_index(
 	return( 1 );
 }
 
+/* Determines if a path refers to the statistics file
+ * Returns 1 if the path refers to the statistics file, 0 if not or -1 on error
+ */
+int mount_file_system_is_statistics_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_is_statistics_path";
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	/* The statistics file is stored in the root directory
+	 */
+	if( ( path_length != ( MOUNT_FILE_SYSTEM_STATISTICS_NAME_LENGTH + 1 ) )
+	 || ( path[ 0 ] != file_system->path_prefix[ 0 ] ) )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	result = system_string_compare_no_case(
+	          &( path[ 1 ] ),
+	          MOUNT_FILE_SYSTEM_STATISTICS_NAME,
+	          MOUNT_FILE_SYSTEM_STATISTICS_NAME_LENGTH );
+#else
+	result = system_string_compare(
+	          &( path[ 1 ] ),
+	          MOUNT_FILE_SYSTEM_STATISTICS_NAME,
+	          MOUNT_FILE_SYSTEM_STATISTICS_NAME_LENGTH );
+#endif
+	if( result != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific statistics value of an image
+ * The value is the sum of the values of the handle and the read handles of the image
+ * A value that is not available, such as when libmodi was built without
+ * statistics support, is returned as 0
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_statistics_value(
+     mount_file_system_t *file_system,
+     int handle_index,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libmodi_handle_t *modi_handle = NULL;
+	static char *function         = "mount_file_system_get_statistics_value";
+	uint64_t handle_value         = 0;
+	int read_handle_index         = 0;
+	int result                    = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	*value = 0;
+
+	for( read_handle_index = -1;
+	     read_handle_index < file_system->number_of_read_handles;
+	     read_handle_index++ )
+	{
+		if( read_handle_index == -1 )
+		{
+			result = libcdata_array_get_entry_by_index(
+			          file_system->handles_array,
+			          handle_index,
+			          (intptr_t **) &modi_handle,
+			          error );
+		}
+		else
+		{
+			result = libcdata_array_get_entry_by_index(
+			          file_system->read_handles_array,
+			          ( handle_index * file_system->number_of_read_handles ) + read_handle_index,
+			          (intptr_t **) &modi_handle,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+		result = libmodi_handle_get_statistics_value(
+		          modi_handle,
+		          value_type,
+		          &handle_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics value: %d.",
+			 function,
+			 value_type );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*value += handle_value;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistics data
+ * The statistics data contains the statistics of every handle as text and
+ * is allocated by this function, the caller is responsible for freeing it
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_statistics_data(
+     mount_file_system_t *file_system,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	system_character_t path[ 32 ];
+
+	const char *compression_method_names[ LIBMODI_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ] = {
+		"uncompressed", "ADC", "bzip2", "deflate", "LZFSE", "LZMA" };
+
+	uint64_t values[ 8 ];
+
+	char *statistics_string       = NULL;
+	static char *function         = "mount_file_system_get_statistics_data";
+	size_t statistics_string_size = 0;
+	size_t string_index           = 0;
+	uint64_t decompression_time   = 0;
+	uint64_t value                = 0;
+	int compression_method        = 0;
+	int handle_index              = 0;
+	int number_of_handles         = 0;
+	int print_count               = 0;
+	int range_index               = 0;
+	int value_index               = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     file_system->handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_handles < 0 )
+	 || ( number_of_handles > 999 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of handles.",
+		 function );
+
+		goto on_error;
+	}
+	statistics_string_size = 1 + ( (size_t) number_of_handles * MOUNT_FILE_SYSTEM_MAXIMUM_STATISTICS_SIZE_PER_HANDLE );
+
+	statistics_string = narrow_string_allocate(
+	                     statistics_string_size );
+
+	if( statistics_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics string.",
+		 function );
+
+		goto on_error;
+	}
+	statistics_string[ 0 ] = 0;
+
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		/* The values from number of reads up to number of band file opens
+		 */
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			if( mount_file_system_get_statistics_value(
+			     file_system,
+			     handle_index,
+			     LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS + value_index,
+			     &( values[ value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve statistics of handle: %d.",
+				 function,
+				 handle_index );
+
+				goto on_error;
+			}
+		}
+		if( mount_file_system_get_path_from_handle_index(
+		     file_system,
+		     handle_index,
+		     -1,
+		     path,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path of handle: %d.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+		print_count = narrow_string_snprintf(
+		               &( statistics_string[ string_index ] ),
+		               statistics_string_size - string_index,
+		               "%" PRIs_SYSTEM ":\n"
+		               "\tnumber of reads: %" PRIu64 "\n"
+		               "\tnumber of bytes read: %" PRIu64 "\n"
+		               "\tnumber of bytes read from storage: %" PRIu64 "\n"
+		               "\tnumber of sparse bytes: %" PRIu64 "\n"
+		               "\tnumber of cache hits: %" PRIu64 "\n"
+		               "\tnumber of cache misses: %" PRIu64 "\n",
+		               &( path[ 1 ] ),
+		               values[ 0 ],
+		               values[ 1 ],
+		               values[ 2 ],
+		               values[ 3 ],
+		               values[ 4 ],
+		               values[ 5 ] );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= ( statistics_string_size - string_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set statistics string.",
+			 function );
+
+			goto on_error;
+		}
+		string_index += (size_t) print_count;
+
+		for( range_index = 0;
+		     range_index < LIBMODI_STATISTICS_NUMBER_OF_READ_SIZE_RANGES;
+		     range_index++ )
+		{
+			if( mount_file_system_get_statistics_value(
+			     file_system,
+			     handle_index,
+			     LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS_PER_SIZE_RANGE + range_index,
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve statistics of handle: %d.",
+				 function,
+				 handle_index );
+
+				goto on_error;
+			}
+			if( range_index == 0 )
+			{
+				print_count = narrow_string_snprintf(
+				               &( statistics_string[ string_index ] ),
+				               statistics_string_size - string_index,
+				               "\tnumber of reads of less than 8 KiB: %" PRIu64 "\n",
+				               value );
+			}
+			else if( range_index == ( LIBMODI_STATISTICS_NUMBER_OF_READ_SIZE_RANGES - 1 ) )
+			{
+				print_count = narrow_string_snprintf(
+				               &( statistics_string[ string_index ] ),
+				               statistics_string_size - string_index,
+				               "\tnumber of reads of %d KiB or more: %" PRIu64 "\n",
+				               4 << range_index,
+				               value );
+			}
+			else
+			{
+				print_count = narrow_string_snprintf(
+				               &( statistics_string[ string_index ] ),
+				               statistics_string_size - string_index,
+				               "\tnumber of reads of %d KiB up to %d KiB: %" PRIu64 "\n",
+				               4 << range_index,
+				               8 << range_index,
+				               value );
+			}
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= ( statistics_string_size - string_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set statistics string.",
+				 function );
+
+				goto on_error;
+			}
+			string_index += (size_t) print_count;
+		}
+		for( compression_method = LIBMODI_COMPRESSION_METHOD_ADC;
+		     compression_method < LIBMODI_STATISTICS_NUMBER_OF_COMPRESSION_METHODS;
+		     compression_method++ )
+		{
+			if( mount_file_system_get_statistics_value(
+			     file_system,
+			     handle_index,
+			     LIBMODI_STATISTICS_VALUE_NUMBER_OF_DECOMPRESSED_CHUNKS + compression_method,
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve statistics of handle: %d.",
+				 function,
+				 handle_index );
+
+				goto on_error;
+			}
+			if( mount_file_system_get_statistics_value(
+			     file_system,
+			     handle_index,
+			     LIBMODI_STATISTICS_VALUE_DECOMPRESSION_TIME + compression_method,
+			     &decompression_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve statistics of handle: %d.",
+				 function,
+				 handle_index );
+
+				goto on_error;
+			}
+			print_count = narrow_string_snprintf(
+			               &( statistics_string[ string_index ] ),
+			               statistics_string_size - string_index,
+			               "\tnumber of %s decompressed chunks: %" PRIu64 "\n"
+			               "\t%s decompression time: %" PRIu64 " ns\n",
+			               compression_method_names[ compression_method ],
+			               value,
+			               compression_method_names[ compression_method ],
+			               decompression_time );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= ( statistics_string_size - string_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set statistics string.",
+				 function );
+
+				goto on_error;
+			}
+			string_index += (size_t) print_count;
+		}
+		print_count = narrow_string_snprintf(
+		               &( statistics_string[ string_index ] ),
+		               statistics_string_size - string_index,
+		               "\tIO time: %" PRIu64 " ns\n"
+		               "\tnumber of band file opens: %" PRIu64 "\n",
+		               values[ 6 ],
+		               values[ 7 ] );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= ( statistics_string_size - string_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set statistics string.",
+			 function );
+
+			goto on_error;
+		}
+		string_index += (size_t) print_count;
+	}
+	/* The data does not contain the end of string character
+	 */
+	*data      = (uint8_t *) statistics_string;
+	*data_size = string_index;
+
+	return( 1 );
+
+on_error:
+	if( statistics_string != NULL )
+	{
+		memory_free(
+		 statistics_string );
+	}
+	return( -1 );
+}
+
@@ -32,6 +32,36 @@
 extern "C" {
 #endif
 
+/* The name of the statistics file in the root directory
+ */
+#define MOUNT_FILE_SYSTEM_STATISTICS_NAME			_SYSTEM_STRING( ".modi_stats" )
+#define MOUNT_FILE_SYSTEM_STATISTICS_NAME_LENGTH		11
+
+/* The maximum size of the statistics text of a single handle
+ */
+#define MOUNT_FILE_SYSTEM_MAXIMUM_STATISTICS_SIZE_PER_HANDLE	2048
+
+typedef struct mount_file_system_allocated_size mount_file_system_allocated_size_t;
+
+struct mount_file_system_allocated_size
+{
+	/* The handle
+	 */
+	libmodi_handle_t *modi_handle;
+
+	/* The partition index or -1 for the entire image
+	 */
+	int partition_index;
+
+	/* The allocated size
+	 */
+	size64_t allocated_size;
+
+	/* Value to indicate the allocated size was determined
+	 */
+	uint8_t allocated_size_is_set;
+};
+
 typedef struct mount_file_system mount_file_system_t;
 
 struct mount_file_system
@@ -51,6 +81,27 @@ struct mount_file_system
 	/* The handles array
 	 */
 	libcdata_array_t *handles_array;
+
+	/* The read handles array, contains additional handles of the images
+	 * so that the data of an image can be read concurrently
+	 */
+	libcdata_array_t *read_handles_array;
+
+	/* The number of read handles per image
+	 */
+	int number_of_read_handles;
+
+	/* The value used to distribute the reads over the handles of an image
+	 */
+	uint32_t read_handle_counter;
+
+	/* The allocated sizes of the files, which are determined on first use
+	 */
+	mount_file_system_allocated_size_t *allocated_sizes;
+
+	/* The number of allocated sizes
+	 */
+	int number_of_allocated_sizes;
 };
 
 int mount_file_system_initialize(
@@ -92,6 +143,19 @@ int mount_file_system_get_handle_by_path(
      const system_character_t *path,
      size_t path_length,
      libmodi_handle_t **modi_handle,
+     int *partition_index,
+     libcerror_error_t **error );
+
+int mount_file_system_get_number_of_files(
+     mount_file_system_t *file_system,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+int mount_file_system_get_file_by_index(
+     mount_file_system_t *file_system,
+     int file_index,
+     int *handle_index,
+     int *partition_index,
      libcerror_error_t **error );
 
 int mount_file_system_append_handle(
@@ -99,13 +163,62 @@ int mount_file_system_append_handle(
      libmodi_handle_t *modi_handle,
      libcerror_error_t **error );
 
+int mount_file_system_set_number_of_read_handles(
+     mount_file_system_t *file_system,
+     int number_of_read_handles,
+     libcerror_error_t **error );
+
+int mount_file_system_append_read_handle(
+     mount_file_system_t *file_system,
+     libmodi_handle_t *modi_handle,
+     libcerror_error_t **error );
+
+int mount_file_system_get_read_handle(
+     mount_file_system_t *file_system,
+     libmodi_handle_t *modi_handle,
+     libmodi_handle_t **read_handle,
+     libcerror_error_t **error );
+
+int mount_file_system_determine_allocated_size(
+     libmodi_handle_t *modi_handle,
+     int partition_index,
+     size64_t *allocated_size,
+     libcerror_error_t **error );
+
+int mount_file_system_get_allocated_size(
+     mount_file_system_t *file_system,
+     libmodi_handle_t *modi_handle,
+     int partition_index,
+     size64_t *allocated_size,
+     libcerror_error_t **error );
+
 int mount_file_system_get_path_from_handle_index(
      mount_file_system_t *file_system,
      int handle_index,
+     int partition_index,
      system_character_t *path,
      size_t path_size,
      libcerror_error_t **error );
 
+int mount_file_system_is_statistics_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int mount_file_system_get_statistics_value(
+     mount_file_system_t *file_system,
+     int handle_index,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int mount_file_system_get_statistics_data(
+     mount_file_system_t *file_system,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -55,22 +55,25 @@ extern mount_handle_t *modimount_mount_handle;
 #endif
 
 /* Sets the values in a stat info structure
+ * The allocated size is used to determine the number of 512-byte blocks
  * The time values are a signed 64-bit POSIX date and time value in number of nanoseconds
  * Returns 1 if successful or -1 on error
  */
 int mount_fuse_set_stat_info(
      mount_fuse_stat_t *stat_info,
      size64_t size,
+     size64_t allocated_size,
      uint16_t file_mode,
      int64_t access_time,
      int64_t inode_change_time,
      int64_t modification_time,
      libcerror_error_t **error )
 {
-	static char *function = "mount_fuse_set_stat_info";
-	int group_identifier  = 0;
-	int number_of_links   = 0;
-	int owner_identifier  = 0;
+	static char *function     = "mount_fuse_set_stat_info";
+	size64_t number_of_blocks = 0;
+	int group_identifier      = 0;
+	int number_of_links       = 0;
+	int owner_identifier      = 0;
 
 	if( stat_info == NULL )
 	{
@@ -98,6 +101,19 @@ int mount_fuse_set_stat_info(
 
 		return( -1 );
 	}
+	if( allocated_size > size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocated size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = ( allocated_size + 511 ) / 512;
+
 	if( ( file_mode & 0x4000 ) != 0 )
 	{
 		number_of_links = 2;
@@ -113,11 +129,12 @@ int mount_fuse_set_stat_info(
 	group_identifier = getegid();
 #endif
 #if defined( __APPLE__ )
-	stat_info->size  = (off_t) size;
-	stat_info->mode  = file_mode;
-	stat_info->nlink = number_of_links;
-	stat_info->uid   = owner_identifier;
-	stat_info->gid   = group_identifier;
+	stat_info->size   = (off_t) size;
+	stat_info->blocks = number_of_blocks;
+	stat_info->mode   = file_mode;
+	stat_info->nlink  = number_of_links;
+	stat_info->uid    = owner_identifier;
+	stat_info->gid    = group_identifier;
 
 	stat_info->atimespec.tv_sec  = access_time / 1000000000;
 	stat_info->atimespec.tv_nsec = access_time % 1000000000;
@@ -128,11 +145,12 @@ int mount_fuse_set_stat_info(
 	stat_info->mtimespec.tv_sec  = modification_time / 1000000000;
 	stat_info->mtimespec.tv_nsec = modification_time % 1000000000;
 #else
-	stat_info->st_size  = (off_t) size;
-	stat_info->st_mode  = file_mode;
-	stat_info->st_nlink = number_of_links;
-	stat_info->st_uid   = owner_identifier;
-	stat_info->st_gid   = group_identifier;
+	stat_info->st_size   = (off_t) size;
+	stat_info->st_blocks = number_of_blocks;
+	stat_info->st_mode   = file_mode;
+	stat_info->st_nlink  = number_of_links;
+	stat_info->st_uid    = owner_identifier;
+	stat_info->st_gid    = group_identifier;
 
 	stat_info->st_atime = access_time / 1000000000;
 	stat_info->st_ctime = inode_change_time / 1000000000;
@@ -160,6 +178,7 @@ int mount_fuse_filldir(
      libcerror_error_t **error )
 {
 	static char *function      = "mount_fuse_filldir";
+	size64_t allocated_size    = 0;
 	size64_t file_size         = 0;
 	uint64_t access_time       = 0;
 	uint64_t inode_change_time = 0;
@@ -193,6 +212,20 @@ int mount_fuse_filldir(
 
 			return( -1 );
 		}
+		if( mount_file_entry_get_allocated_size(
+		     file_entry,
+		     &allocated_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry allocated size.",
+			 function );
+
+			return( -1 );
+		}
 		if( mount_file_entry_get_file_mode(
 		     file_entry,
 		     &file_mode,
@@ -267,6 +300,7 @@ int mount_fuse_filldir(
 	if( mount_fuse_set_stat_info(
 	     stat_info,
 	     file_size,
+	     allocated_size,
 	     file_mode,
 	     (int64_t) access_time,
 	     (int64_t) inode_change_time,
@@ -399,6 +433,41 @@ int mount_fuse_open(
 
 		goto on_error;
 	}
+	result = mount_file_entry_is_statistics(
+	          (mount_file_entry_t *) file_info->fh,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file entry is the statistics file.",
+		 function );
+
+		mount_file_entry_free(
+		 (mount_file_entry_t **) &( file_info->fh ),
+		 NULL );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The statistics change while mounted, hence the kernel should bypass
+		 * its page cache and the size it cached for the file
+		 */
+		file_info->direct_io = 1;
+	}
+	else
+	{
+		/* The image is read-only and does not change while mounted, hence the kernel
+		 * can keep the cached pages of the file across opens
+		 */
+		file_info->keep_cache = 1;
+	}
 	return( 0 );
 
 on_error:
@@ -521,6 +590,390 @@ on_error:
 	return( result );
 }
 
+#if defined( HAVE_MOUNT_FUSE_READ_BUF )
+
+/* Reads a buffer of data at the specified offset into a buffer vector
+ * The buffer vector and its buffer are allocated with malloc since libfuse
+ * frees them after the reply. The buffer is owned by the request, which
+ * allows concurrent requests without a shared buffer. It is sized to the
+ * data remaining at the offset instead of the requested size.
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_read_buf(
+     const char *path,
+     struct fuse_bufvec **buffer_vector,
+     size_t size,
+     off_t offset,
+     struct fuse_file_info *file_info )
+{
+	struct fuse_bufvec *safe_buffer_vector = NULL;
+	libcerror_error_t *error               = NULL;
+	void *buffer                           = NULL;
+	static char *function                  = "mount_fuse_read_buf";
+	size64_t file_size                     = 0;
+	ssize_t read_count                     = 0;
+	int result                             = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( buffer_vector == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer vector.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( size > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_size(
+	     (mount_file_entry_t *) file_info->fh,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( (size64_t) offset >= file_size )
+	{
+		size = 0;
+	}
+	else if( (size64_t) size > ( file_size - (size64_t) offset ) )
+	{
+		size = (size_t) ( file_size - (size64_t) offset );
+	}
+	safe_buffer_vector = (struct fuse_bufvec *) malloc(
+	                                             sizeof( struct fuse_bufvec ) );
+
+	if( safe_buffer_vector == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer vector.",
+		 function );
+
+		result = -ENOMEM;
+
+		goto on_error;
+	}
+	*safe_buffer_vector = FUSE_BUFVEC_INIT( 0 );
+
+	if( size > 0 )
+	{
+		buffer = malloc(
+		          size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			result = -ENOMEM;
+
+			goto on_error;
+		}
+		read_count = mount_file_entry_read_buffer_at_offset(
+		              (mount_file_entry_t *) file_info->fh,
+		              buffer,
+		              size,
+		              (off64_t) offset,
+		              &error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file entry.",
+			 function );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+		safe_buffer_vector->buf[ 0 ].mem  = buffer;
+		safe_buffer_vector->buf[ 0 ].size = (size_t) read_count;
+	}
+	*buffer_vector = safe_buffer_vector;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		free(
+		 buffer );
+	}
+	if( safe_buffer_vector != NULL )
+	{
+		free(
+		 safe_buffer_vector );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MOUNT_FUSE_READ_BUF ) */
+
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+
+/* Seeks the next data or hole at or after the specified offset
+ * Returns the data or hole offset if successful or a negative errno value otherwise
+ */
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_lseek";
+	size64_t file_size       = 0;
+	off64_t seek_offset      = 0;
+	off_t result             = 0;
+	int modi_whence          = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( whence == SEEK_DATA )
+	{
+		modi_whence = LIBMODI_SEEK_DATA;
+	}
+	else if( whence == SEEK_HOLE )
+	{
+		modi_whence = LIBMODI_SEEK_HOLE;
+	}
+	else
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_size(
+	     (mount_file_entry_t *) file_info->fh,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	/* Like lseek, SEEK_DATA and SEEK_HOLE fail with ENXIO at or beyond the end of the file
+	 */
+	if( (size64_t) offset >= file_size )
+	{
+		return( -ENXIO );
+	}
+	result = mount_file_entry_seek_data_or_hole(
+	          (mount_file_entry_t *) file_info->fh,
+	          (off64_t) offset,
+	          modi_whence,
+	          &seek_offset,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek data or hole in file entry.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* The remainder of the file is a hole
+		 */
+		return( -ENXIO );
+	}
+	return( (off_t) seek_offset );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MOUNT_FUSE_LSEEK ) */
+
 /* Releases a file entry
  * Returns 0 if successful or a negative errno value otherwise
  */
@@ -1108,6 +1561,7 @@ int mount_fuse_getattr(
 	libcerror_error_t *error       = NULL;
 	mount_file_entry_t *file_entry = NULL;
 	static char *function          = "mount_fuse_getattr";
+	size64_t allocated_size        = 0;
 	size64_t file_size             = 0;
 	uint64_t access_time           = 0;
 	uint64_t inode_change_time     = 0;
@@ -1210,6 +1664,22 @@ int mount_fuse_getattr(
 
 		goto on_error;
 	}
+	if( mount_file_entry_get_allocated_size(
+	     file_entry,
+	     &allocated_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry allocated size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
 	if( mount_file_entry_get_file_mode(
 	     file_entry,
 	     &file_mode,
@@ -1277,6 +1747,7 @@ int mount_fuse_getattr(
 	if( mount_fuse_set_stat_info(
 	     stat_info,
 	     file_size,
+	     allocated_size,
 	     file_mode,
 	     (int64_t) access_time,
 	     (int64_t) inode_change_time,
@@ -1328,6 +1799,63 @@ on_error:
 	return( result );
 }
 
+/* Initializes the fuse connection
+ * Returns the private data
+ */
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration MODITOOLS_ATTRIBUTE_UNUSED )
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information )
+#endif
+{
+	struct fuse_context *context = NULL;
+	static char *function        = "mount_fuse_init";
+
+#if defined( HAVE_LIBFUSE3 )
+	MODITOOLS_UNREFERENCED_PARAMETER( configuration )
+#endif
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s\n",
+		 function );
+	}
+#endif
+	if( connection_information != NULL )
+	{
+		/* Ask the kernel for large read requests, libfuse caps the maximum
+		 * write size to its buffer size, which also determines the maximum
+		 * number of pages per request
+		 */
+		if( connection_information->max_readahead < MOUNT_FUSE_MAXIMUM_REQUEST_SIZE )
+		{
+			connection_information->max_readahead = MOUNT_FUSE_MAXIMUM_REQUEST_SIZE;
+		}
+		if( connection_information->max_write < MOUNT_FUSE_MAXIMUM_REQUEST_SIZE )
+		{
+			connection_information->max_write = MOUNT_FUSE_MAXIMUM_REQUEST_SIZE;
+		}
+#if defined( FUSE_CAP_ASYNC_READ )
+		if( ( connection_information->capable & FUSE_CAP_ASYNC_READ ) != 0 )
+		{
+			connection_information->want |= FUSE_CAP_ASYNC_READ;
+		}
+#endif
+	}
+	context = fuse_get_context();
+
+	if( context == NULL )
+	{
+		return( NULL );
+	}
+	return( context->private_data );
+}
+
 /* Cleans up when fuse is done
  */
 void mount_fuse_destroy(
@@ -47,6 +47,44 @@
 #include <osxfuse/fuse.h>
 #endif
 
+/* The FUSE lseek operation is supported by libfuse 3.8 or later
+ */
+#if defined( HAVE_LIBFUSE3 ) && defined( FUSE_MAJOR_VERSION ) && defined( FUSE_MINOR_VERSION )
+#if ( FUSE_MAJOR_VERSION > 3 ) || ( ( FUSE_MAJOR_VERSION == 3 ) && ( FUSE_MINOR_VERSION >= 8 ) )
+
+/* SEEK_DATA and SEEK_HOLE are not defined by glibc without _GNU_SOURCE
+ */
+#if defined( __linux__ ) && !defined( SEEK_DATA )
+#define SEEK_DATA	3
+#endif
+
+#if defined( __linux__ ) && !defined( SEEK_HOLE )
+#define SEEK_HOLE	4
+#endif
+
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+#define HAVE_MOUNT_FUSE_LSEEK
+#endif
+
+#endif
+#endif /* defined( HAVE_LIBFUSE3 ) && defined( FUSE_MAJOR_VERSION ) && defined( FUSE_MINOR_VERSION ) */
+
+/* The FUSE read_buf operation is used with libfuse 3 so that every read
+ * request reads into a buffer it owns
+ */
+#if defined( HAVE_LIBFUSE3 )
+#define HAVE_MOUNT_FUSE_READ_BUF
+#endif
+
+/* The maximum read request size negotiated with the kernel
+ */
+#define MOUNT_FUSE_MAXIMUM_REQUEST_SIZE		( 1024 * 1024 )
+
+/* The image does not change while mounted, hence the kernel can cache
+ * the file data and cache the entries and attributes for an hour
+ */
+#define MOUNT_FUSE_CACHE_OPTIONS		"kernel_cache,entry_timeout=3600,attr_timeout=3600,negative_timeout=3600"
+
 #endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
 
 #include "moditools_libcerror.h"
@@ -77,6 +115,7 @@ typedef struct stat mount_fuse_stat_t;
 int mount_fuse_set_stat_info(
      mount_fuse_stat_t *stat_info,
      size64_t size,
+     size64_t allocated_size,
      uint16_t file_mode,
      int64_t access_time,
      int64_t inode_change_time,
@@ -102,6 +141,23 @@ int mount_fuse_read(
      off_t offset,
      struct fuse_file_info *file_info );
 
+#if defined( HAVE_MOUNT_FUSE_READ_BUF )
+int mount_fuse_read_buf(
+     const char *path,
+     struct fuse_bufvec **buffer_vector,
+     size_t size,
+     off_t offset,
+     struct fuse_file_info *file_info );
+#endif
+
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
@@ -142,6 +198,15 @@ int mount_fuse_getattr(
      mount_fuse_stat_t *stat_info );
 #endif
 
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration );
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information );
+#endif
+
 void mount_fuse_destroy(
       void *private_data );
 
@@ -239,18 +239,136 @@ int mount_handle_set_path_prefix(
 	return( 1 );
 }
 
-/* Opens the mount handle
- * Returns 1 if successful, 0 if not or -1 on error
+/* Sets the maximum number of open file handles of each image
+ * A value of 0 represents no limit
+ * Returns 1 if successful or -1 on error
  */
-int mount_handle_open(
+int mount_handle_set_maximum_number_of_open_handles(
+     mount_handle_t *mount_handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_maximum_number_of_open_handles";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	return( 1 );
+}
+
+/* Sets the maximum cache size of each image
+ * A value of 0 represents the default cache size
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_maximum_cache_size(
+     mount_handle_t *mount_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_maximum_cache_size";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Every image is opened once per thread so that the threads can read
+ * the same image concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_number_of_threads(
+     mount_handle_t *mount_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_number_of_threads";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_set_number_of_read_handles(
+	     mount_handle->file_system,
+	     number_of_threads - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of read handles.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Opens a handle of an image
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_open_modi_handle(
      mount_handle_t *mount_handle,
      const system_character_t *filename,
+     libmodi_handle_t **modi_handle,
      libcerror_error_t **error )
 {
-	libmodi_handle_t *modi_handle = NULL;
-	static char *function         = "mount_handle_open";
-	int image_type                = 0;
-	int result                    = 0;
+	static char *function = "mount_handle_open_modi_handle";
+	int image_type        = 0;
+	int result            = 0;
 
 	if( mount_handle == NULL )
 	{
@@ -274,8 +392,19 @@ int mount_handle_open(
 
 		return( -1 );
 	}
+	if( modi_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( libmodi_handle_initialize(
-	     &modi_handle,
+	     modi_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -287,15 +416,32 @@ int mount_handle_open(
 
 		goto on_error;
 	}
+	if( mount_handle->maximum_cache_size > 0 )
+	{
+		if( libmodi_handle_set_maximum_cache_size(
+		     *modi_handle,
+		     mount_handle->maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum cache size.",
+			 function );
+
+			goto on_error;
+		}
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libmodi_handle_open_wide(
-	          modi_handle,
+	          *modi_handle,
 	          filename,
 	          LIBMODI_OPEN_READ,
 	          error );
 #else
 	result = libmodi_handle_open(
-	          modi_handle,
+	          *modi_handle,
 	          filename,
 	          LIBMODI_OPEN_READ,
 	          error );
@@ -312,7 +458,7 @@ int mount_handle_open(
 		goto on_error;
 	}
 	if( libmodi_handle_get_image_type(
-	     modi_handle,
+	     *modi_handle,
 	     &image_type,
 	     error ) != 1 )
 	{
@@ -327,8 +473,25 @@ int mount_handle_open(
 	}
 	if( image_type == LIBMODI_IMAGE_TYPE_SPARSE_BUNDLE )
 	{
+		if( mount_handle->maximum_number_of_open_handles > 0 )
+		{
+			if( libmodi_handle_set_maximum_number_of_open_handles(
+			     *modi_handle,
+			     mount_handle->maximum_number_of_open_handles,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set maximum number of open handles.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libmodi_handle_open_band_data_files(
-		     modi_handle,
+		     *modi_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -341,6 +504,57 @@ int mount_handle_open(
 			goto on_error;
 		}
 	}
+	return( 1 );
+
+on_error:
+	if( *modi_handle != NULL )
+	{
+		libmodi_handle_free(
+		 modi_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the mount handle
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int mount_handle_open(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libmodi_handle_t *modi_handle = NULL;
+	libmodi_handle_t *read_handle = NULL;
+	static char *function         = "mount_handle_open";
+	int read_handle_index         = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle_open_modi_handle(
+	     mount_handle,
+	     filename,
+	     &modi_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
 	if( mount_file_system_append_handle(
 	     mount_handle->file_system,
 	     modi_handle,
@@ -355,9 +569,56 @@ int mount_handle_open(
 
 		goto on_error;
 	}
+	/* The handle is now managed by the file system
+	 */
+	modi_handle = NULL;
+
+	for( read_handle_index = 0;
+	     read_handle_index < ( mount_handle->number_of_threads - 1 );
+	     read_handle_index++ )
+	{
+		if( mount_handle_open_modi_handle(
+		     mount_handle,
+		     filename,
+		     &read_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open read handle: %d.",
+			 function,
+			 read_handle_index );
+
+			goto on_error;
+		}
+		if( mount_file_system_append_read_handle(
+		     mount_handle->file_system,
+		     read_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append read handle: %d to file system.",
+			 function,
+			 read_handle_index );
+
+			goto on_error;
+		}
+		read_handle = NULL;
+	}
 	return( 1 );
 
 on_error:
+	if( read_handle != NULL )
+	{
+		libmodi_handle_free(
+		 &read_handle,
+		 NULL );
+	}
 	if( modi_handle != NULL )
 	{
 		libmodi_handle_free(
@@ -474,6 +735,7 @@ int mount_handle_get_file_entry_by_path(
 	size_t filename_length             = 0;
 	size_t path_index                  = 0;
 	size_t path_length                 = 0;
+	int partition_index                = -1;
 	int result                         = 0;
 
 	if( mount_handle == NULL )
@@ -539,11 +801,47 @@ int mount_handle_get_file_entry_by_path(
 		filename        = &( path[ path_index + 1 ] );
 		filename_length = path_length - ( path_index + 1 );
 	}
+	result = mount_file_system_is_statistics_path(
+	          mount_handle->file_system,
+	          path,
+	          path_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if path is the statistics file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( mount_file_entry_initialize_statistics(
+		     file_entry,
+		     mount_handle->file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize statistics file entry.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
 	result = mount_file_system_get_handle_by_path(
 	          mount_handle->file_system,
 	          path,
 	          path_length,
 	          &modi_handle,
+	          &partition_index,
 	          error );
 
 	if( result == -1 )
@@ -565,6 +863,7 @@ int mount_handle_get_file_entry_by_path(
 		     filename,
 		     filename_length,
 		     modi_handle,
+		     partition_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
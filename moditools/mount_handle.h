@@ -46,6 +46,18 @@ struct mount_handle
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
+
+	/* The maximum number of open file handles of each image
+	 */
+	int maximum_number_of_open_handles;
+
+	/* The maximum cache size of each image
+	 */
+	size64_t maximum_cache_size;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
 };
 
 int mount_handle_initialize(
@@ -66,6 +78,27 @@ int mount_handle_set_path_prefix(
      size_t path_prefix_size,
      libcerror_error_t **error );
 
+int mount_handle_set_maximum_number_of_open_handles(
+     mount_handle_t *mount_handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+int mount_handle_set_maximum_cache_size(
+     mount_handle_t *mount_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int mount_handle_set_number_of_threads(
+     mount_handle_t *mount_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int mount_handle_open_modi_handle(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libmodi_handle_t **modi_handle,
+     libcerror_error_t **error );
+
 int mount_handle_open(
      mount_handle_t *mount_handle,
      const system_character_t *filename,
@@ -161,6 +161,44 @@ PyMethodDef pymodi_handle_object_methods[] = {
 	  "\n"
 	  "Retrieves the size of the data." },
 
+	/* Functions to access the extents */
+
+	{ "get_number_of_extents",
+	  (PyCFunction) pymodi_handle_get_number_of_extents,
+	  METH_NOARGS,
+	  "get_number_of_extents() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of extents." },
+
+	{ "get_extent",
+	  (PyCFunction) pymodi_handle_get_extent,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_extent(extent_index) -> Tuple(Integer, Integer, Integer, Integer, Integer)\n"
+	  "\n"
+	  "Retrieves a specific extent.\n"
+	  "\n"
+	  "The extent is represented as a tuple of offset, size, stored size,\n"
+	  "compression method and flags." },
+
+	/* Functions to access the partitions */
+
+	{ "get_number_of_partitions",
+	  (PyCFunction) pymodi_handle_get_number_of_partitions,
+	  METH_NOARGS,
+	  "get_number_of_partitions() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of partitions." },
+
+	{ "get_partition",
+	  (PyCFunction) pymodi_handle_get_partition,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_partition(partition_index) -> Tuple(Integer, Integer, Integer, Integer, Unicode string or None)\n"
+	  "\n"
+	  "Retrieves a specific partition.\n"
+	  "\n"
+	  "The partition is represented as a tuple of offset, size, identifier,\n"
+	  "attributes and name." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -173,6 +211,18 @@ PyGetSetDef pymodi_handle_object_get_set_definitions[] = {
 	  "The media size.",
 	  NULL },
 
+	{ "number_of_extents",
+	  (getter) pymodi_handle_get_number_of_extents,
+	  (setter) 0,
+	  "The number of extents.",
+	  NULL },
+
+	{ "number_of_partitions",
+	  (getter) pymodi_handle_get_number_of_partitions,
+	  (setter) 0,
+	  "The number of partitions.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -1627,3 +1677,542 @@ PyObject *pymodi_handle_get_media_size(
 	return( integer_object );
 }
 
+/* Retrieves the number of extents
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymodi_handle_get_number_of_extents(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments PYMODI_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *integer_object = NULL;
+	static char *function    = "pymodi_handle_get_number_of_extents";
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	PYMODI_UNREFERENCED_PARAMETER( arguments )
+
+	if( pymodi_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmodi_handle_get_number_of_extents(
+	          pymodi_handle->handle,
+	          &number_of_extents,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymodi_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_extents );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_extents );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific extent by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymodi_handle_get_extent_by_index(
+           pymodi_handle_t *pymodi_handle,
+           int extent_index )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *integer_object = NULL;
+	PyObject *tuple_object   = NULL;
+	static char *function    = "pymodi_handle_get_extent_by_index";
+	size64_t extent_size     = 0;
+	size64_t stored_size     = 0;
+	off64_t extent_offset    = 0;
+	uint32_t extent_flags    = 0;
+	int compression_method   = 0;
+	int result               = 0;
+
+	if( pymodi_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmodi_handle_get_extent_by_index(
+	          pymodi_handle->handle,
+	          extent_index,
+	          &extent_offset,
+	          &extent_size,
+	          &stored_size,
+	          &compression_method,
+	          &extent_flags,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymodi_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve extent: %d.",
+		 function,
+		 extent_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                5 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	integer_object = pymodi_integer_signed_new_from_64bit(
+	                  (int64_t) extent_offset );
+
+	/* Tuple set item steals the reference of the integer object, also on failure
+	 */
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     0,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pymodi_integer_unsigned_new_from_64bit(
+	                  (uint64_t) extent_size );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     1,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pymodi_integer_unsigned_new_from_64bit(
+	                  (uint64_t) stored_size );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     2,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) compression_method );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) compression_method );
+#endif
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     3,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pymodi_integer_unsigned_new_from_64bit(
+	                  (uint64_t) extent_flags );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     4,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	return( tuple_object );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) tuple_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific extent
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymodi_handle_get_extent(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *tuple_object      = NULL;
+	static char *keyword_list[] = { "extent_index", NULL };
+	int extent_index            = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &extent_index ) == 0 )
+	{
+		return( NULL );
+	}
+	tuple_object = pymodi_handle_get_extent_by_index(
+	                pymodi_handle,
+	                extent_index );
+
+	return( tuple_object );
+}
+
+/* Retrieves the number of partitions
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymodi_handle_get_number_of_partitions(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments PYMODI_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *integer_object = NULL;
+	static char *function    = "pymodi_handle_get_number_of_partitions";
+	int number_of_partitions = 0;
+	int result               = 0;
+
+	PYMODI_UNREFERENCED_PARAMETER( arguments )
+
+	if( pymodi_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmodi_handle_get_number_of_partitions(
+	          pymodi_handle->handle,
+	          &number_of_partitions,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymodi_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_partitions );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_partitions );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific partition by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymodi_handle_get_partition_by_index(
+           pymodi_handle_t *pymodi_handle,
+           int partition_index )
+{
+	libcerror_error_t *error      = NULL;
+	PyObject *integer_object      = NULL;
+	PyObject *string_object       = NULL;
+	PyObject *tuple_object        = NULL;
+	uint8_t *name                 = NULL;
+	static char *function         = "pymodi_handle_get_partition_by_index";
+	size64_t partition_size       = 0;
+	size_t name_size              = 0;
+	off64_t partition_offset      = 0;
+	uint32_t partition_attributes = 0;
+	int32_t partition_identifier  = 0;
+	int result                    = 0;
+
+	if( pymodi_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmodi_handle_get_partition_by_index(
+	          pymodi_handle->handle,
+	          partition_index,
+	          &partition_offset,
+	          &partition_size,
+	          &partition_identifier,
+	          &partition_attributes,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymodi_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmodi_handle_get_utf8_partition_name_size(
+	          pymodi_handle->handle,
+	          partition_index,
+	          &name_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pymodi_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve partition: %d name size.",
+		 function,
+		 partition_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( name_size > 0 ) )
+	{
+		name = (uint8_t *) PyMem_Malloc(
+		                    sizeof( uint8_t ) * name_size );
+
+		if( name == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libmodi_handle_get_utf8_partition_name(
+		          pymodi_handle->handle,
+		          partition_index,
+		          name,
+		          name_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pymodi_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve partition: %d name.",
+			 function,
+			 partition_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		/* Pass the string length to PyUnicode_DecodeUTF8
+		 * otherwise it makes the end of string character is part
+		 * of the string
+		 */
+		string_object = PyUnicode_DecodeUTF8(
+		                 (char *) name,
+		                 (Py_ssize_t) name_size - 1,
+		                 NULL );
+
+		if( string_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to convert UTF-8 name into Unicode object.",
+			 function );
+
+			goto on_error;
+		}
+		PyMem_Free(
+		 name );
+
+		name = NULL;
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		string_object = Py_None;
+	}
+	tuple_object = PyTuple_New(
+	                5 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	integer_object = pymodi_integer_signed_new_from_64bit(
+	                  (int64_t) partition_offset );
+
+	/* Tuple set item steals the reference of the integer object, also on failure
+	 */
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     0,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pymodi_integer_unsigned_new_from_64bit(
+	                  (uint64_t) partition_size );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     1,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pymodi_integer_signed_new_from_64bit(
+	                  (int64_t) partition_identifier );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     2,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pymodi_integer_unsigned_new_from_64bit(
+	                  (uint64_t) partition_attributes );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     3,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	/* Tuple set item steals the reference of the string object, also on failure
+	 */
+	result = PyTuple_SetItem(
+	          tuple_object,
+	          4,
+	          string_object );
+
+	string_object = NULL;
+
+	if( result != 0 )
+	{
+		goto on_error;
+	}
+	return( tuple_object );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) tuple_object );
+	}
+	if( string_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) string_object );
+	}
+	if( name != NULL )
+	{
+		PyMem_Free(
+		 name );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific partition
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymodi_handle_get_partition(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *tuple_object      = NULL;
+	static char *keyword_list[] = { "partition_index", NULL };
+	int partition_index         = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &partition_index ) == 0 )
+	{
+		return( NULL );
+	}
+	tuple_object = pymodi_handle_get_partition_by_index(
+	                pymodi_handle,
+	                partition_index );
+
+	return( tuple_object );
+}
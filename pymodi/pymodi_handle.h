@@ -113,6 +113,32 @@ PyObject *pymodi_handle_get_media_size(
            pymodi_handle_t *pymodi_handle,
            PyObject *arguments );
 
+PyObject *pymodi_handle_get_number_of_extents(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments );
+
+PyObject *pymodi_handle_get_extent_by_index(
+           pymodi_handle_t *pymodi_handle,
+           int extent_index );
+
+PyObject *pymodi_handle_get_extent(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pymodi_handle_get_number_of_partitions(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments );
+
+PyObject *pymodi_handle_get_partition_by_index(
+           pymodi_handle_t *pymodi_handle,
+           int partition_index );
+
+PyObject *pymodi_handle_get_partition(
+           pymodi_handle_t *pymodi_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
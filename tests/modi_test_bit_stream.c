@@ -435,10 +435,10 @@ int modi_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 0 );
 
-	MODI_TEST_ASSERT_EQUAL_UINT32(
+	MODI_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x00000000UL );
 
 	MODI_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -470,10 +470,10 @@ int modi_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 1 );
 
-	MODI_TEST_ASSERT_EQUAL_UINT32(
+	MODI_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000007UL );
+	 (uint64_t) 0x00000007UL );
 
 	MODI_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -505,10 +505,10 @@ int modi_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	MODI_TEST_ASSERT_EQUAL_UINT32(
+	MODI_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x00000000UL );
 
 	MODI_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -540,10 +540,10 @@ int modi_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 6 );
 
-	MODI_TEST_ASSERT_EQUAL_UINT32(
+	MODI_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x00000000UL );
 
 	MODI_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -656,44 +656,714 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libmodi_bit_stream_peek_value function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc MODI_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc MODI_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
-#endif
+int modi_test_bit_stream_peek_value(
+     void )
 {
-	MODI_TEST_UNREFERENCED_PARAMETER( argc )
-	MODI_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error         = NULL;
+	libmodi_bit_stream_t *bit_stream = NULL;
+	uint32_t value_32bit             = 0;
+	int result                       = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( MODI_TEST_BIT_STREAM_VERBOSE )
-	libcnotify_verbose_set(
+	/* Initialize test
+	 */
+	result = libmodi_bit_stream_initialize(
+	          &bit_stream,
+	          modi_test_bit_stream_data,
+	          16,
+	          0,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-#endif
 
-#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	MODI_TEST_RUN(
-	 "libmodi_bit_stream_initialize",
-	 modi_test_bit_stream_initialize );
+	/* Test regular cases
+	 */
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          4,
+	          &value_32bit,
+	          &error );
 
-	MODI_TEST_RUN(
-	 "libmodi_bit_stream_free",
-	 modi_test_bit_stream_free );
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	MODI_TEST_RUN(
-	 "libmodi_bit_stream_get_value",
-	 modi_test_bit_stream_get_value );
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000008UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000078UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 8 );
+
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000a78UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x0000da78UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 16 );
+
+	/* Test peek past the end of the byte stream
+	 */
+	bit_stream->byte_stream_offset = 16;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          8,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000000UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 16 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000000UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libmodi_bit_stream_peek_value(
+	          NULL,
+	          8,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          33,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          8,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libmodi_bit_stream_initialize(
+	          &bit_stream,
+	          modi_test_bit_stream_data,
+	          16,
+	          0,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          4,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000007UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000078UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 8 );
+
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x0000078dUL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x000078daUL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 16 );
+
+	/* Clean up
+	 */
+	result = libmodi_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		libmodi_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_bit_stream_skip_bits function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_bit_stream_skip_bits(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libmodi_bit_stream_t *bit_stream = NULL;
+	uint32_t value_32bit             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_bit_stream_initialize(
+	          &bit_stream,
+	          modi_test_bit_stream_data,
+	          16,
+	          0,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          16,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_bit_stream_skip_bits(
+	          bit_stream,
+	          4,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000da7UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 12 );
+
+	result = libmodi_bit_stream_skip_bits(
+	          bit_stream,
+	          0,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000da7UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 12 );
+
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000da7UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000da7UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 12 );
+
+	result = libmodi_bit_stream_skip_bits(
+	          bit_stream,
+	          12,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000000UL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libmodi_bit_stream_skip_bits(
+	          NULL,
+	          4,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bit_stream_skip_bits(
+	          bit_stream,
+	          4,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libmodi_bit_stream_initialize(
+	          &bit_stream,
+	          modi_test_bit_stream_data,
+	          16,
+	          0,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_bit_stream_peek_value(
+	          bit_stream,
+	          16,
+	          &value_32bit,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_bit_stream_skip_bits(
+	          bit_stream,
+	          4,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x000008daUL );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 12 );
+
+	/* Clean up
+	 */
+	result = libmodi_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		libmodi_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MODI_TEST_UNREFERENCED_PARAMETER( argc )
+	MODI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( MODI_TEST_BIT_STREAM_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+	MODI_TEST_RUN(
+	 "libmodi_bit_stream_initialize",
+	 modi_test_bit_stream_initialize );
+
+	MODI_TEST_RUN(
+	 "libmodi_bit_stream_free",
+	 modi_test_bit_stream_free );
+
+	MODI_TEST_RUN(
+	 "libmodi_bit_stream_get_value",
+	 modi_test_bit_stream_get_value );
+
+	MODI_TEST_RUN(
+	 "libmodi_bit_stream_peek_value",
+	 modi_test_bit_stream_peek_value );
+
+	MODI_TEST_RUN(
+	 "libmodi_bit_stream_skip_bits",
+	 modi_test_bit_stream_skip_bits );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
 
@@ -31,6 +31,7 @@
 #include "modi_test_libcerror.h"
 #include "modi_test_libcnotify.h"
 #include "modi_test_macros.h"
+#include "modi_test_memory.h"
 #include "modi_test_unused.h"
 
 #include "../libmodi/libmodi_bit_stream.h"
@@ -107,30 +108,456 @@ uint8_t modi_test_bzip_uncompressed_data2[ 512 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
 
-/* Tests the libmodi_bzip_initialize_crc32_table function
+/* Tests the libmodi_bzip_context_initialize function
  * Returns 1 if successful or 0 if not
  */
-int modi_test_bzip_initialize_crc32_table(
+int modi_test_bzip_context_initialize(
      void )
 {
-	/* Test invocation of function only
+	libmodi_bzip_context_t *context = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 19;
+	int number_of_memset_fail_tests = 19;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_bzip_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_bzip_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
 	 */
-	libmodi_bzip_initialize_crc32_table();
+	result = libmodi_bzip_context_initialize(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (libmodi_bzip_context_t *) 0x12345678UL;
+
+	result = libmodi_bzip_context_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_bzip_context_initialize with malloc failing
+		 */
+		modi_test_malloc_attempts_before_fail = test_number;
+
+		result = libmodi_bzip_context_initialize(
+		          &context,
+		          &error );
+
+		if( modi_test_malloc_attempts_before_fail != -1 )
+		{
+			modi_test_malloc_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				libmodi_bzip_context_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_bzip_context_initialize with memset failing
+		 */
+		modi_test_memset_attempts_before_fail = test_number;
+
+		result = libmodi_bzip_context_initialize(
+		          &context,
+		          &error );
+
+		if( modi_test_memset_attempts_before_fail != -1 )
+		{
+			modi_test_memset_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				libmodi_bzip_context_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MODI_TEST_MEMORY ) */
 
 	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libmodi_bzip_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
 }
 
-/* Tests the libmodi_bzip_calculate_crc32 function
+/* Tests the libmodi_bzip_context_free function
  * Returns 1 if successful or 0 if not
  */
-int modi_test_bzip_calculate_crc32(
+int modi_test_bzip_context_free(
      void )
 {
-	char *data               = "Hello, world!";
 	libcerror_error_t *error = NULL;
-	uint32_t checksum        = 0;
 	int result               = 0;
 
+	/* Test error cases
+	 */
+	result = libmodi_bzip_context_free(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_bzip_context_resize_block_data function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_bzip_context_resize_block_data(
+     void )
+{
+	libmodi_bzip_context_t *context = NULL;
+	libcerror_error_t *error        = NULL;
+	uint8_t *block_data             = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_bzip_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_bzip_context_resize_block_data(
+	          context,
+	          200000,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "context->block_data_size",
+	 context->block_data_size,
+	 (size_t) 200000 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context->block_data",
+	 context->block_data );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context->permutations",
+	 context->permutations );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	block_data = context->block_data;
+
+	/* Test that a smaller block data size reuses the buffers
+	 */
+	result = libmodi_bzip_context_resize_block_data(
+	          context,
+	          100000,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "context->block_data_size",
+	 context->block_data_size,
+	 (size_t) 200000 );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "context->block_data",
+	 (int) ( context->block_data == block_data ),
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_bzip_context_resize_block_data(
+	          context,
+	          900000,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "context->block_data_size",
+	 context->block_data_size,
+	 (size_t) 900000 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_bzip_context_resize_block_data(
+	          NULL,
+	          100000,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bzip_context_resize_block_data(
+	          context,
+	          0,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bzip_context_resize_block_data(
+	          context,
+	          900001,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_bzip_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libmodi_bzip_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_bzip_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_bzip_calculate_crc32(
+     void )
+{
+	uint8_t test_data[ 4096 + 16 ];
+
+	char *data                 = "Hello, world!";
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	size_t test_data_offset    = 0;
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t value_32bit       = 0x12345678UL;
+	int result                 = 0;
+
+#if defined( LIBMODI_BZIP_HAVE_X86_PCLMUL )
+	size_t number_of_blocks    = 0;
+#endif
+
 	/* Test regular cases
 	 */
 	result = libmodi_bzip_calculate_crc32(
@@ -154,6 +581,123 @@ int modi_test_bzip_calculate_crc32(
 	 "error",
 	 error );
 
+	result = libmodi_bzip_calculate_crc32(
+	          &checksum,
+	          (uint8_t *) "123456789",
+	          9,
+	          0,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xfc891918UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the result matches the CRC-32 calculated one byte at a time
+	 * for various sizes and alignments
+	 */
+	for( test_data_offset = 0;
+	     test_data_offset < sizeof( test_data );
+	     test_data_offset++ )
+	{
+		value_32bit = ( value_32bit * 1103515245UL ) + 12345;
+
+		test_data[ test_data_offset ] = (uint8_t) ( value_32bit >> 16 );
+	}
+	for( data_size = 0;
+	     data_size <= 4096;
+	     data_size += ( data_size < 300 ) ? 1 : 379 )
+	{
+		for( test_data_offset = 0;
+		     test_data_offset < 4;
+		     test_data_offset++ )
+		{
+			expected_checksum = 0;
+
+			for( data_offset = 0;
+			     data_offset < data_size;
+			     data_offset++ )
+			{
+				result = libmodi_bzip_calculate_crc32(
+				          &expected_checksum,
+				          &( test_data[ test_data_offset + data_offset ] ),
+				          1,
+				          expected_checksum,
+				          &error );
+
+				MODI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+			}
+			result = libmodi_bzip_calculate_crc32(
+			          &checksum,
+			          &( test_data[ test_data_offset ] ),
+			          data_size,
+			          0,
+			          &error );
+
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			MODI_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum",
+			 checksum,
+			 expected_checksum );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+#if defined( LIBMODI_BZIP_HAVE_X86_PCLMUL )
+			number_of_blocks = data_size / 64;
+
+			if( ( number_of_blocks > 0 )
+			 && ( __builtin_cpu_supports( "pclmul" ) )
+			 && ( __builtin_cpu_supports( "ssse3" ) ) )
+			{
+				checksum = 0xffffffffUL;
+
+				libmodi_bzip_calculate_crc32_pclmul(
+				 &checksum,
+				 &( test_data[ test_data_offset ] ),
+				 number_of_blocks );
+
+				result = libmodi_bzip_calculate_crc32(
+				          &checksum,
+				          &( test_data[ test_data_offset + ( number_of_blocks * 64 ) ] ),
+				          data_size - ( number_of_blocks * 64 ),
+				          checksum ^ 0xffffffffUL,
+				          &error );
+
+				MODI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				MODI_TEST_ASSERT_EQUAL_UINT32(
+				 "checksum",
+				 checksum,
+				 expected_checksum );
+
+				MODI_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+#endif /* defined( LIBMODI_BZIP_HAVE_X86_PCLMUL ) */
+		}
+	}
 	/* Test error cases
 	 */
 	result = libmodi_bzip_calculate_crc32(
@@ -236,7 +780,7 @@ int modi_test_bzip_reverse_burrows_wheeler_transform(
 	       	'a', ' ', 'b' };
 
 	uint8_t output_data[ 35 ];
-	size_t permutations[ 35 ];
+	uint32_t permutations[ 35 ];
 
 	libcerror_error_t *error  = NULL;
 	void *memset_result       = NULL;
@@ -248,7 +792,7 @@ int modi_test_bzip_reverse_burrows_wheeler_transform(
 	memset_result = memory_set(
 	                 permutations,
 	                 0,
-	                 sizeof( size_t ) * 32 );
+	                 sizeof( uint32_t ) * 35 );
 
 	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "memset_result",
@@ -290,17 +834,61 @@ int modi_test_bzip_reverse_burrows_wheeler_transform(
 	MODI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 0 );
+
+	/* Test error cases
+	 */
+	output_data_offset = 0;
+
+	result = libmodi_bzip_reverse_burrows_wheeler_transform(
+	          NULL,
+	          35,
+	          permutations,
+	          30,
+	          output_data,
+	          35,
+	          &output_data_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bzip_reverse_burrows_wheeler_transform(
+	          input_data,
+	          35,
+	          NULL,
+	          30,
+	          output_data,
+	          35,
+	          &output_data_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* Test error cases
-	 */
-	output_data_offset = 0;
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	result = libmodi_bzip_reverse_burrows_wheeler_transform(
-	          NULL,
+	          input_data,
 	          35,
 	          permutations,
-	          30,
+	          35,
 	          output_data,
 	          35,
 	          &output_data_offset,
@@ -1351,21 +1939,37 @@ int modi_test_bzip_read_huffman_trees(
 	uint8_t symbol_stack[ 256 ];
 	uint8_t selectors[ ( 1 << 15 ) + 1 ];
 
-	libmodi_huffman_tree_t *huffman_trees[ 7 ] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL };
-	libcerror_error_t *error                   = NULL;
-	libmodi_bit_stream_t *bit_stream           = NULL;
-	void *memset_result                        = NULL;
-	uint64_t signature                         = 0;
-	uint32_t origin_pointer                    = 0;
-	uint32_t value_32bit                       = 0;
-	uint16_t number_of_selectors               = 0;
-	uint16_t number_of_symbols                 = 0;
-	uint8_t number_of_trees                    = 0;
-	uint8_t tree_index                         = 0;
-	int result                                 = 0;
+	libmodi_bzip_context_t *context  = NULL;
+	libcerror_error_t *error         = NULL;
+	libmodi_bit_stream_t *bit_stream = NULL;
+	void *memset_result              = NULL;
+	uint64_t signature               = 0;
+	uint32_t origin_pointer          = 0;
+	uint32_t value_32bit             = 0;
+	uint16_t number_of_selectors     = 0;
+	uint16_t number_of_symbols       = 0;
+	uint8_t number_of_trees          = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
+	result = libmodi_bzip_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libmodi_bit_stream_initialize(
 	          &bit_stream,
 	          modi_test_bzip_compressed_data1,
@@ -1504,7 +2108,7 @@ int modi_test_bzip_read_huffman_trees(
 	 */
 	result = libmodi_bzip_read_huffman_trees(
 	          bit_stream,
-	          huffman_trees,
+	          context->huffman_trees,
 	          number_of_trees,
 	          number_of_symbols,
 	          &error );
@@ -1522,7 +2126,7 @@ int modi_test_bzip_read_huffman_trees(
 	 */
 	result = libmodi_bzip_read_huffman_trees(
 	          NULL,
-	          huffman_trees,
+	          context->huffman_trees,
 	          number_of_trees,
 	          number_of_symbols,
 	          &error );
@@ -1539,29 +2143,46 @@ int modi_test_bzip_read_huffman_trees(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	for( tree_index = 0;
-	     tree_index < number_of_trees;
-	     tree_index++ )
-	{
-		result = libmodi_huffman_tree_free(
-		          &( huffman_trees[ tree_index ] ),
-		          &error );
+	result = libmodi_bzip_read_huffman_trees(
+	          bit_stream,
+	          NULL,
+	          number_of_trees,
+	          number_of_symbols,
+	          &error );
 
-		MODI_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		MODI_TEST_ASSERT_IS_NULL(
-		 "huffman_tree",
-		 huffman_trees[ tree_index ] );
+	libcerror_error_free(
+	 &error );
 
-		MODI_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
+	result = libmodi_bzip_read_huffman_trees(
+	          bit_stream,
+	          context->huffman_trees,
+	          LIBMODI_BZIP_MAXIMUM_NUMBER_OF_TREES + 1,
+	          number_of_symbols,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
 	result = libmodi_bit_stream_free(
 	          &bit_stream,
 	          &error );
@@ -1579,23 +2200,101 @@ int modi_test_bzip_read_huffman_trees(
 	 "error",
 	 error );
 
+	result = libmodi_bzip_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
-	for( tree_index = 0;
-	     tree_index < number_of_trees;
-	     tree_index++ )
-	{
-		libmodi_huffman_tree_free(
-		 &( huffman_trees[ tree_index ] ),
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libmodi_bit_stream_free(
 		 &bit_stream,
 		 NULL );
 	}
+	if( context != NULL )
+	{
+		libmodi_bzip_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_bzip_move_symbol_to_front function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_bzip_move_symbol_to_front(
+     void )
+{
+	uint8_t expected_symbol_stack[ 256 ];
+	uint8_t symbol_stack[ 256 ];
+
+	uint8_t test_stack_indexes[ 4 ] = { 0, 1, 2, 255 };
+	int result                      = 0;
+	int stack_index                 = 0;
+	int test_index                  = 0;
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 4;
+	     test_index++ )
+	{
+		/* Use a symbol stack where the value differs from the index
+		 */
+		for( stack_index = 0;
+		     stack_index < 256;
+		     stack_index++ )
+		{
+			symbol_stack[ stack_index ] = (uint8_t) ( 255 - stack_index );
+		}
+		expected_symbol_stack[ 0 ] = symbol_stack[ test_stack_indexes[ test_index ] ];
+
+		for( stack_index = 1;
+		     stack_index < 256;
+		     stack_index++ )
+		{
+			if( stack_index <= test_stack_indexes[ test_index ] )
+			{
+				expected_symbol_stack[ stack_index ] = symbol_stack[ stack_index - 1 ];
+			}
+			else
+			{
+				expected_symbol_stack[ stack_index ] = symbol_stack[ stack_index ];
+			}
+		}
+		libmodi_bzip_move_symbol_to_front(
+		 symbol_stack,
+		 test_stack_indexes[ test_index ] );
+
+		result = memory_compare(
+		          symbol_stack,
+		          expected_symbol_stack,
+		          256 );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
 	return( 0 );
 }
 
@@ -1618,22 +2317,38 @@ int modi_test_bzip_read_block_data(
 		0x20, 0x20, 0x20, 0x20, 0x69, 0x69, 0x70, 0x70, 0x20, 0x20, 0x20, 0x20, 0x65, 0x65, 0x65, 0x65,
 		0x65, 0x65, 0x65, 0x65, 0x65, 0x72, 0x27, 0x72, 0x65, 0x65, 0x20, 0x20 };
 
-	libmodi_huffman_tree_t *huffman_trees[ 7 ] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL };
-	libcerror_error_t *error                   = NULL;
-	libmodi_bit_stream_t *bit_stream           = NULL;
-	void *memset_result                        = NULL;
-	size_t block_data_size                     = 0;
-	uint64_t signature                         = 0;
-	uint32_t origin_pointer                    = 0;
-	uint32_t value_32bit                       = 0;
-	uint16_t number_of_selectors               = 0;
-	uint16_t number_of_symbols                 = 0;
-	uint8_t number_of_trees                    = 0;
-	uint8_t tree_index                         = 0;
-	int result                                 = 0;
+	libmodi_bzip_context_t *context  = NULL;
+	libcerror_error_t *error         = NULL;
+	libmodi_bit_stream_t *bit_stream = NULL;
+	void *memset_result              = NULL;
+	size_t block_data_size           = 0;
+	uint64_t signature               = 0;
+	uint32_t origin_pointer          = 0;
+	uint32_t value_32bit             = 0;
+	uint16_t number_of_selectors     = 0;
+	uint16_t number_of_symbols       = 0;
+	uint8_t number_of_trees          = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
+	result = libmodi_bzip_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libmodi_bit_stream_initialize(
 	          &bit_stream,
 	          modi_test_bzip_compressed_data1,
@@ -1770,7 +2485,7 @@ int modi_test_bzip_read_block_data(
 
 	result = libmodi_bzip_read_huffman_trees(
 	          bit_stream,
-	          huffman_trees,
+	          context->huffman_trees,
 	          number_of_trees,
 	          number_of_symbols,
 	          &error );
@@ -1790,7 +2505,7 @@ int modi_test_bzip_read_block_data(
 
 	result = libmodi_bzip_read_block_data(
 	          bit_stream,
-	          huffman_trees,
+	          context->huffman_trees,
 	          number_of_trees,
 	          selectors,
 	          number_of_selectors,
@@ -1828,7 +2543,7 @@ int modi_test_bzip_read_block_data(
 	 */
 	result = libmodi_bzip_read_block_data(
 	          NULL,
-	          huffman_trees,
+	          context->huffman_trees,
 	          number_of_trees,
 	          selectors,
 	          number_of_selectors,
@@ -1850,29 +2565,32 @@ int modi_test_bzip_read_block_data(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	for( tree_index = 0;
-	     tree_index < number_of_trees;
-	     tree_index++ )
-	{
-		result = libmodi_huffman_tree_free(
-		          &( huffman_trees[ tree_index ] ),
-		          &error );
+	result = libmodi_bzip_read_block_data(
+	          bit_stream,
+	          context->huffman_trees,
+	          number_of_trees,
+	          NULL,
+	          number_of_selectors,
+	          symbol_stack,
+	          number_of_symbols,
+	          block_data,
+	          &block_data_size,
+	          &error );
 
-		MODI_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		MODI_TEST_ASSERT_IS_NULL(
-		 "huffman_tree",
-		 huffman_trees[ tree_index ] );
+	libcerror_error_free(
+	 &error );
 
-		MODI_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
+	/* Clean up
+	 */
 	result = libmodi_bit_stream_free(
 	          &bit_stream,
 	          &error );
@@ -1890,23 +2608,38 @@ int modi_test_bzip_read_block_data(
 	 "error",
 	 error );
 
+	result = libmodi_bzip_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
-	for( tree_index = 0;
-	     tree_index < number_of_trees;
-	     tree_index++ )
-	{
-		libmodi_huffman_tree_free(
-		 &( huffman_trees[ tree_index ] ),
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libmodi_bit_stream_free(
 		 &bit_stream,
 		 NULL );
 	}
+	if( context != NULL )
+	{
+		libmodi_bzip_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2045,15 +2778,36 @@ int modi_test_bzip_decompress(
 {
 	uint8_t uncompressed_data[ 512 ];
 
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	libmodi_bzip_context_t *context = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t uncompressed_data_size   = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_bzip_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
 	uncompressed_data_size = 512;
 
 	result = libmodi_bzip_decompress(
+	          context,
 	          modi_test_bzip_compressed_data1,
 	          117,
 	          uncompressed_data,
@@ -2087,6 +2841,7 @@ int modi_test_bzip_decompress(
 	uncompressed_data_size = 512;
 
 	result = libmodi_bzip_decompress(
+	          context,
 	          modi_test_bzip_compressed_data2,
 	          122,
 	          uncompressed_data,
@@ -2124,6 +2879,27 @@ int modi_test_bzip_decompress(
 	uncompressed_data_size = 512;
 
 	result = libmodi_bzip_decompress(
+	          NULL,
+	          modi_test_bzip_compressed_data1,
+	          117,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_bzip_decompress(
+	          context,
 	          NULL,
 	          117,
 	          uncompressed_data,
@@ -2143,6 +2919,7 @@ int modi_test_bzip_decompress(
 	 &error );
 
 	result = libmodi_bzip_decompress(
+	          context,
 	          modi_test_bzip_compressed_data1,
 	          (size_t) SSIZE_MAX + 1,
 	          uncompressed_data,
@@ -2162,6 +2939,7 @@ int modi_test_bzip_decompress(
 	 &error );
 
 	result = libmodi_bzip_decompress(
+	          context,
 	          modi_test_bzip_compressed_data1,
 	          117,
 	          NULL,
@@ -2181,6 +2959,7 @@ int modi_test_bzip_decompress(
 	 &error );
 
 	result = libmodi_bzip_decompress(
+	          context,
 	          modi_test_bzip_compressed_data1,
 	          117,
 	          uncompressed_data,
@@ -2199,6 +2978,25 @@ int modi_test_bzip_decompress(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libmodi_bzip_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -2207,6 +3005,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( context != NULL )
+	{
+		libmodi_bzip_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2238,8 +3042,16 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
 
 	MODI_TEST_RUN(
-	 "libmodi_bzip_initialize_crc32_table",
-	 modi_test_bzip_initialize_crc32_table );
+	 "libmodi_bzip_context_initialize",
+	 modi_test_bzip_context_initialize );
+
+	MODI_TEST_RUN(
+	 "libmodi_bzip_context_free",
+	 modi_test_bzip_context_free );
+
+	MODI_TEST_RUN(
+	 "libmodi_bzip_context_resize_block_data",
+	 modi_test_bzip_context_resize_block_data );
 
 	MODI_TEST_RUN(
 	 "libmodi_bzip_calculate_crc32",
@@ -2277,6 +3089,10 @@ int main(
 	 "libmodi_bzip_read_huffman_trees",
 	 modi_test_bzip_read_huffman_trees );
 
+	MODI_TEST_RUN(
+	 "libmodi_bzip_move_symbol_to_front",
+	 modi_test_bzip_move_symbol_to_front );
+
 	MODI_TEST_RUN(
 	 "libmodi_bzip_read_block_data",
 	 modi_test_bzip_read_block_data );
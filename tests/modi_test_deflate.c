@@ -691,12 +691,246 @@ uint8_t modi_test_deflate_uncompressed_data[ 7640 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
 
+/* Tests the libmodi_deflate_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_deflate_context_initialize(
+     void )
+{
+	libmodi_deflate_context_t *context = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 10;
+	int number_of_memset_fail_tests    = 10;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_deflate_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_deflate_context_initialize(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (libmodi_deflate_context_t *) 0x12345678UL;
+
+	result = libmodi_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_deflate_context_initialize with malloc failing
+		 */
+		modi_test_malloc_attempts_before_fail = test_number;
+
+		result = libmodi_deflate_context_initialize(
+		          &context,
+		          &error );
+
+		if( modi_test_malloc_attempts_before_fail != -1 )
+		{
+			modi_test_malloc_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				libmodi_deflate_context_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_deflate_context_initialize with memset failing
+		 */
+		modi_test_memset_attempts_before_fail = test_number;
+
+		result = libmodi_deflate_context_initialize(
+		          &context,
+		          &error );
+
+		if( modi_test_memset_attempts_before_fail != -1 )
+		{
+			modi_test_memset_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				libmodi_deflate_context_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MODI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libmodi_deflate_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_deflate_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_deflate_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmodi_deflate_context_free(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libmodi_deflate_build_dynamic_huffman_trees function
  * Returns 1 if successful or 0 if not
  */
 int modi_test_deflate_build_dynamic_huffman_trees(
      void )
 {
+	libmodi_huffman_tree_t *codes_tree     = NULL;
 	libmodi_bit_stream_t *bit_stream       = NULL;
 	libmodi_huffman_tree_t *distances_tree = NULL;
 	libmodi_huffman_tree_t *literals_tree  = NULL;
@@ -732,6 +966,25 @@ int modi_test_deflate_build_dynamic_huffman_trees(
 	 "error",
 	 error );
 
+	result = libmodi_huffman_tree_initialize(
+	          &codes_tree,
+	          19,
+	          15,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "codes_tree",
+	 codes_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libmodi_huffman_tree_initialize(
 	          &literals_tree,
 	          288,
@@ -794,6 +1047,7 @@ int modi_test_deflate_build_dynamic_huffman_trees(
 
 	result = libmodi_deflate_build_dynamic_huffman_trees(
 	          bit_stream,
+	          codes_tree,
 	          literals_tree,
 	          distances_tree,
 	          &error );
@@ -872,6 +1126,26 @@ int modi_test_deflate_build_dynamic_huffman_trees(
 	 error );
 
 	result = libmodi_deflate_build_dynamic_huffman_trees(
+	          NULL,
+	          codes_tree,
+	          literals_tree,
+	          distances_tree,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_deflate_build_dynamic_huffman_trees(
+	          bit_stream,
 	          NULL,
 	          literals_tree,
 	          distances_tree,
@@ -891,6 +1165,7 @@ int modi_test_deflate_build_dynamic_huffman_trees(
 
 	result = libmodi_deflate_build_dynamic_huffman_trees(
 	          bit_stream,
+	          codes_tree,
 	          NULL,
 	          distances_tree,
 	          &error );
@@ -909,6 +1184,7 @@ int modi_test_deflate_build_dynamic_huffman_trees(
 
 	result = libmodi_deflate_build_dynamic_huffman_trees(
 	          bit_stream,
+	          codes_tree,
 	          literals_tree,
 	          NULL,
 	          &error );
@@ -937,6 +1213,7 @@ int modi_test_deflate_build_dynamic_huffman_trees(
 
 		result = libmodi_deflate_build_dynamic_huffman_trees(
 		          bit_stream,
+		          codes_tree,
 		          literals_tree,
 		          distances_tree,
 		          &error );
@@ -998,6 +1275,23 @@ int modi_test_deflate_build_dynamic_huffman_trees(
 	 "error",
 	 error );
 
+	result = libmodi_huffman_tree_free(
+	          &codes_tree,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "codes_tree",
+	 codes_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libmodi_bit_stream_free(
 	          &bit_stream,
 	          &error );
@@ -1030,6 +1324,12 @@ on_error:
 		 &literals_tree,
 		 NULL );
 	}
+	if( codes_tree != NULL )
+	{
+		libmodi_huffman_tree_free(
+		 &codes_tree,
+		 NULL );
+	}
 	if( bit_stream != NULL )
 	{
 		libmodi_bit_stream_free(
@@ -1247,6 +1547,126 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libmodi_deflate_get_fixed_huffman_trees function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_deflate_get_fixed_huffman_trees(
+     void )
+{
+	const libmodi_huffman_tree_t *distances_tree        = NULL;
+	const libmodi_huffman_tree_t *literals_tree         = NULL;
+	const libmodi_huffman_tree_t *shared_distances_tree = NULL;
+	const libmodi_huffman_tree_t *shared_literals_tree  = NULL;
+	libcerror_error_t *error                            = NULL;
+	int result                                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libmodi_deflate_get_fixed_huffman_trees(
+	          &literals_tree,
+	          &distances_tree,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "literals_tree",
+	 literals_tree );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "distances_tree",
+	 distances_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "literals_tree->storage_type",
+	 literals_tree->storage_type,
+	 LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT );
+
+	MODI_TEST_ASSERT_EQUAL_UINT8(
+	 "distances_tree->storage_type",
+	 distances_tree->storage_type,
+	 LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT );
+
+	/* Test that the trees are built once and shared
+	 */
+	result = libmodi_deflate_get_fixed_huffman_trees(
+	          &shared_literals_tree,
+	          &shared_distances_tree,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INTPTR(
+	 "shared_literals_tree",
+	 (intptr_t) shared_literals_tree,
+	 (intptr_t) literals_tree );
+
+	MODI_TEST_ASSERT_EQUAL_INTPTR(
+	 "shared_distances_tree",
+	 (intptr_t) shared_distances_tree,
+	 (intptr_t) distances_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_deflate_get_fixed_huffman_trees(
+	          NULL,
+	          &distances_tree,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_deflate_get_fixed_huffman_trees(
+	          &literals_tree,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libmodi_deflate_decode_huffman function
  * Returns 1 if successful or 0 if not
  */
@@ -1255,6 +1675,7 @@ int modi_test_deflate_decode_huffman(
 {
 	uint8_t uncompressed_data[ 8192 ];
 
+	libmodi_huffman_tree_t *codes_tree     = NULL;
 	libmodi_bit_stream_t *bit_stream       = NULL;
 	libmodi_huffman_tree_t *distances_tree = NULL;
 	libmodi_huffman_tree_t *literals_tree  = NULL;
@@ -1286,6 +1707,25 @@ int modi_test_deflate_decode_huffman(
 	 "error",
 	 error );
 
+	result = libmodi_huffman_tree_initialize(
+	          &codes_tree,
+	          19,
+	          15,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "codes_tree",
+	 codes_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libmodi_huffman_tree_initialize(
 	          &literals_tree,
 	          288,
@@ -1348,6 +1788,7 @@ int modi_test_deflate_decode_huffman(
 
 	result = libmodi_deflate_build_dynamic_huffman_trees(
 	          bit_stream,
+	          codes_tree,
 	          literals_tree,
 	          distances_tree,
 	          &error );
@@ -1445,6 +1886,7 @@ int modi_test_deflate_decode_huffman(
 
 	result = libmodi_deflate_build_dynamic_huffman_trees(
 	          bit_stream,
+	          codes_tree,
 	          literals_tree,
 	          distances_tree,
 	          &error );
@@ -1593,71 +2035,345 @@ int modi_test_deflate_decode_huffman(
 	MODI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	MODI_TEST_ASSERT_IS_NULL(
-	 "distances_tree",
-	 distances_tree );
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "distances_tree",
+	 distances_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_huffman_tree_free(
+	          &literals_tree,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "literals_tree",
+	 literals_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_huffman_tree_free(
+	          &codes_tree,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "codes_tree",
+	 codes_tree );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( distances_tree != NULL )
+	{
+		libmodi_huffman_tree_free(
+		 &distances_tree,
+		 NULL );
+	}
+	if( literals_tree != NULL )
+	{
+		libmodi_huffman_tree_free(
+		 &literals_tree,
+		 NULL );
+	}
+	if( codes_tree != NULL )
+	{
+		libmodi_huffman_tree_free(
+		 &codes_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		libmodi_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_deflate_calculate_adler32 function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_deflate_calculate_adler32(
+     void )
+{
+	uint8_t data[ 16384 + 32 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t initial_value     = 0;
+	uint32_t value_32bit       = 0x12345678UL;
+	int initial_value_index    = 0;
+	int result                 = 0;
+
+#if defined( LIBMODI_DEFLATE_HAVE_X86_SIMD )
+	size_t number_of_blocks    = 0;
+	uint32_t lower_word        = 0;
+	uint32_t upper_word        = 0;
+	int kernel_index           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_deflate_calculate_adler32(
+	          &checksum,
+	          modi_test_deflate_uncompressed_data,
+	          7640,
+	          1,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x304a56a4UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the result matches the scalar calculation for various sizes, alignments and initial values
+	 */
+	for( data_offset = 0;
+	     data_offset < sizeof( data );
+	     data_offset++ )
+	{
+		value_32bit = ( value_32bit * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( value_32bit >> 16 );
+	}
+	for( initial_value_index = 0;
+	     initial_value_index < 2;
+	     initial_value_index++ )
+	{
+		if( initial_value_index == 0 )
+		{
+			initial_value = 1;
+		}
+		else
+		{
+			initial_value = 0xfff0fff0UL;
+		}
+		for( data_size = 0;
+		     data_size <= 16384;
+		     data_size += ( data_size < 160 ) ? 1 : 5551 )
+		{
+			for( data_offset = 0;
+			     data_offset < 4;
+			     data_offset++ )
+			{
+				result = libmodi_deflate_calculate_adler32_scalar(
+				          &expected_checksum,
+				          &( data[ data_offset ] ),
+				          data_size,
+				          initial_value,
+				          &error );
+
+				MODI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				MODI_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libmodi_deflate_calculate_adler32(
+				          &checksum,
+				          &( data[ data_offset ] ),
+				          data_size,
+				          initial_value,
+				          &error );
+
+				MODI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				MODI_TEST_ASSERT_EQUAL_UINT32(
+				 "checksum",
+				 checksum,
+				 expected_checksum );
+
+				MODI_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+#if defined( LIBMODI_DEFLATE_HAVE_X86_SIMD )
+				number_of_blocks = data_size / 32;
+
+				for( kernel_index = 0;
+				     kernel_index < 3;
+				     kernel_index++ )
+				{
+					lower_word = initial_value & 0xffff;
+					upper_word = ( initial_value >> 16 ) & 0xffff;
+
+					if( ( kernel_index == 0 )
+					 && ( __builtin_cpu_supports( "sse2" ) ) )
+					{
+						libmodi_deflate_calculate_adler32_sse2(
+						 &lower_word,
+						 &upper_word,
+						 &( data[ data_offset ] ),
+						 number_of_blocks );
+					}
+					else if( ( kernel_index == 1 )
+					      && ( __builtin_cpu_supports( "ssse3" ) ) )
+					{
+						libmodi_deflate_calculate_adler32_ssse3(
+						 &lower_word,
+						 &upper_word,
+						 &( data[ data_offset ] ),
+						 number_of_blocks );
+					}
+					else if( ( kernel_index == 2 )
+					      && ( __builtin_cpu_supports( "avx2" ) ) )
+					{
+						libmodi_deflate_calculate_adler32_avx2(
+						 &lower_word,
+						 &upper_word,
+						 &( data[ data_offset ] ),
+						 number_of_blocks );
+					}
+					else
+					{
+						continue;
+					}
+					result = libmodi_deflate_calculate_adler32_scalar(
+					          &checksum,
+					          &( data[ data_offset + ( number_of_blocks * 32 ) ] ),
+					          data_size - ( number_of_blocks * 32 ),
+					          ( upper_word << 16 ) | lower_word,
+					          &error );
+
+					MODI_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 1 );
+
+					MODI_TEST_ASSERT_EQUAL_UINT32(
+					 "checksum",
+					 checksum,
+					 expected_checksum );
+
+					MODI_TEST_ASSERT_IS_NULL(
+					 "error",
+					 error );
+				}
+#endif /* defined( LIBMODI_DEFLATE_HAVE_X86_SIMD ) */
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libmodi_deflate_calculate_adler32(
+	          NULL,
+	          modi_test_deflate_uncompressed_data,
+	          7640,
+	          1,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	MODI_TEST_ASSERT_IS_NULL(
+	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libmodi_huffman_tree_free(
-	          &literals_tree,
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_deflate_calculate_adler32(
+	          &checksum,
+	          NULL,
+	          7640,
+	          1,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	MODI_TEST_ASSERT_IS_NULL(
-	 "literals_tree",
-	 literals_tree );
+	 -1 );
 
-	MODI_TEST_ASSERT_IS_NULL(
+	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libmodi_bit_stream_free(
-	          &bit_stream,
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_deflate_calculate_adler32(
+	          &checksum,
+	          modi_test_deflate_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	MODI_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 -1 );
 
-	MODI_TEST_ASSERT_IS_NULL(
+	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
-	if( distances_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &distances_tree,
-		 NULL );
-	}
-	if( literals_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &literals_tree,
-		 NULL );
-	}
-	if( bit_stream != NULL )
-	{
-		libmodi_bit_stream_free(
-		 &bit_stream,
-		 NULL );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -1666,10 +2382,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libmodi_deflate_calculate_adler32 function
+/* Tests the libmodi_deflate_calculate_adler32_scalar function
  * Returns 1 if successful or 0 if not
  */
-int modi_test_deflate_calculate_adler32(
+int modi_test_deflate_calculate_adler32_scalar(
      void )
 {
 	libcerror_error_t *error = NULL;
@@ -1678,7 +2394,7 @@ int modi_test_deflate_calculate_adler32(
 
 	/* Test regular cases
 	 */
-	result = libmodi_deflate_calculate_adler32(
+	result = libmodi_deflate_calculate_adler32_scalar(
 	          &checksum,
 	          modi_test_deflate_uncompressed_data,
 	          7640,
@@ -1701,7 +2417,7 @@ int modi_test_deflate_calculate_adler32(
 
 	/* Test error cases
 	 */
-	result = libmodi_deflate_calculate_adler32(
+	result = libmodi_deflate_calculate_adler32_scalar(
 	          NULL,
 	          modi_test_deflate_uncompressed_data,
 	          7640,
@@ -1720,7 +2436,7 @@ int modi_test_deflate_calculate_adler32(
 	libcerror_error_free(
 	 &error );
 
-	result = libmodi_deflate_calculate_adler32(
+	result = libmodi_deflate_calculate_adler32_scalar(
 	          &checksum,
 	          NULL,
 	          7640,
@@ -1739,7 +2455,7 @@ int modi_test_deflate_calculate_adler32(
 	libcerror_error_free(
 	 &error );
 
-	result = libmodi_deflate_calculate_adler32(
+	result = libmodi_deflate_calculate_adler32_scalar(
 	          &checksum,
 	          modi_test_deflate_uncompressed_data,
 	          (size_t) SSIZE_MAX + 1,
@@ -2087,15 +2803,14 @@ int modi_test_deflate_read_block(
 {
 	uint8_t uncompressed_data[ 8192 ];
 
-	libmodi_bit_stream_t *bit_stream             = NULL;
-	libmodi_huffman_tree_t *fixed_distances_tree = NULL;
-	libmodi_huffman_tree_t *fixed_literals_tree  = NULL;
-	libcerror_error_t *error                     = NULL;
-	size_t uncompressed_data_offset              = 0;
-	size_t uncompressed_data_size                = 7640;
-	uint8_t block_type                           = 0;
-	uint8_t last_block_flag                      = 0;
-	int result                                   = 0;
+	libmodi_deflate_context_t *context = NULL;
+	libmodi_bit_stream_t *bit_stream   = NULL;
+	libcerror_error_t *error           = NULL;
+	size_t uncompressed_data_offset    = 0;
+	size_t uncompressed_data_size      = 7640;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+	int result                         = 0;
 
 	/* Initialize test
 	 */
@@ -2120,29 +2835,8 @@ int modi_test_deflate_read_block(
 	 "error",
 	 error );
 
-	result = libmodi_huffman_tree_initialize(
-	          &fixed_literals_tree,
-	          288,
-	          15,
-	          &error );
-
-	MODI_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	MODI_TEST_ASSERT_IS_NOT_NULL(
-	 "fixed_literals_tree",
-	 fixed_literals_tree );
-
-	MODI_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libmodi_huffman_tree_initialize(
-	          &fixed_distances_tree,
-	          30,
-	          15,
+	result = libmodi_deflate_context_initialize(
+	          &context,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -2151,22 +2845,8 @@ int modi_test_deflate_read_block(
 	 1 );
 
 	MODI_TEST_ASSERT_IS_NOT_NULL(
-	 "fixed_distances_tree",
-	 fixed_distances_tree );
-
-	MODI_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libmodi_deflate_build_fixed_huffman_trees(
-	          fixed_literals_tree,
-	          fixed_distances_tree,
-	          &error );
-
-	MODI_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	 "context",
+	 context );
 
 	MODI_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2190,10 +2870,9 @@ int modi_test_deflate_read_block(
 	/* Test regular cases
 	 */
 	result = libmodi_deflate_read_block(
+	          context,
 	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2261,9 +2940,8 @@ int modi_test_deflate_read_block(
 	 */
 	result = libmodi_deflate_read_block(
 	          NULL,
+	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2282,11 +2960,10 @@ int modi_test_deflate_read_block(
 	 &error );
 
 	result = libmodi_deflate_read_block(
-	          bit_stream,
-	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
+	          context,
 	          NULL,
+	          block_type,
+	          uncompressed_data,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
 	          &error );
@@ -2304,12 +2981,11 @@ int modi_test_deflate_read_block(
 	 &error );
 
 	result = libmodi_deflate_read_block(
+	          context,
 	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
-	          uncompressed_data,
-	          (size_t) SSIZE_MAX + 1,
+	          NULL,
+	          uncompressed_data_size,
 	          &uncompressed_data_offset,
 	          &error );
 
@@ -2326,13 +3002,12 @@ int modi_test_deflate_read_block(
 	 &error );
 
 	result = libmodi_deflate_read_block(
+	          context,
 	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          uncompressed_data,
-	          uncompressed_data_size,
-	          NULL,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -2347,27 +3022,31 @@ int modi_test_deflate_read_block(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libmodi_huffman_tree_free(
-	          &fixed_distances_tree,
+	result = libmodi_deflate_read_block(
+	          context,
+	          bit_stream,
+	          block_type,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          NULL,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	MODI_TEST_ASSERT_IS_NULL(
-	 "fixed_distances_tree",
-	 fixed_distances_tree );
+	 -1 );
 
-	MODI_TEST_ASSERT_IS_NULL(
+	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libmodi_huffman_tree_free(
-	          &fixed_literals_tree,
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_deflate_context_free(
+	          &context,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -2376,8 +3055,8 @@ int modi_test_deflate_read_block(
 	 1 );
 
 	MODI_TEST_ASSERT_IS_NULL(
-	 "fixed_literals_tree",
-	 fixed_literals_tree );
+	 "context",
+	 context );
 
 	MODI_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2403,16 +3082,10 @@ int modi_test_deflate_read_block(
 	return( 1 );
 
 on_error:
-	if( fixed_distances_tree != NULL )
-	{
-		libmodi_huffman_tree_free(
-		 &fixed_distances_tree,
-		 NULL );
-	}
-	if( fixed_literals_tree != NULL )
+	if( context != NULL )
 	{
-		libmodi_huffman_tree_free(
-		 &fixed_literals_tree,
+		libmodi_deflate_context_free(
+		 &context,
 		 NULL );
 	}
 	if( bit_stream != NULL )
@@ -2437,13 +3110,34 @@ int modi_test_deflate_decompress(
 {
 	uint8_t uncompressed_data[ 8192 ];
 
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 7640;
-	int result                    = 0;
+	libmodi_deflate_context_t *context = NULL;
+	libcerror_error_t *error           = NULL;
+	size_t uncompressed_data_size      = 7640;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
 	result = libmodi_deflate_decompress(
+	          context,
 	          &( modi_test_deflate_compressed_data[ 2 ] ),
 	          2627 - 6,
 	          uncompressed_data,
@@ -2469,6 +3163,27 @@ int modi_test_deflate_decompress(
 	/* Test error cases
 	 */
 	result = libmodi_deflate_decompress(
+	          NULL,
+	          &( modi_test_deflate_compressed_data[ 2 ] ),
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_deflate_decompress(
+	          context,
 	          NULL,
 	          2627 - 6,
 	          uncompressed_data,
@@ -2488,6 +3203,7 @@ int modi_test_deflate_decompress(
 	 &error );
 
 	result = libmodi_deflate_decompress(
+	          context,
 	          &( modi_test_deflate_compressed_data[ 2 ] ),
 	          (size_t) SSIZE_MAX + 1,
 	          uncompressed_data,
@@ -2507,6 +3223,7 @@ int modi_test_deflate_decompress(
 	 &error );
 
 	result = libmodi_deflate_decompress(
+	          context,
 	          &( modi_test_deflate_compressed_data[ 2 ] ),
 	          2627 - 6,
 	          NULL,
@@ -2526,6 +3243,7 @@ int modi_test_deflate_decompress(
 	 &error );
 
 	result = libmodi_deflate_decompress(
+	          context,
 	          &( modi_test_deflate_compressed_data[ 2 ] ),
 	          2627 - 6,
 	          uncompressed_data,
@@ -2544,6 +3262,25 @@ int modi_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libmodi_deflate_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -2552,6 +3289,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( context != NULL )
+	{
+		libmodi_deflate_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2563,13 +3306,34 @@ int modi_test_deflate_decompress_zlib(
 {
 	uint8_t uncompressed_data[ 8192 ];
 
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 7640;
-	int result                    = 0;
+	libmodi_deflate_context_t *context = NULL;
+	libcerror_error_t *error           = NULL;
+	size_t uncompressed_data_size      = 7640;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
 	result = libmodi_deflate_decompress_zlib(
+	          context,
 	          modi_test_deflate_compressed_data,
 	          2627,
 	          uncompressed_data,
@@ -2595,6 +3359,27 @@ int modi_test_deflate_decompress_zlib(
 	/* Test error cases
 	 */
 	result = libmodi_deflate_decompress_zlib(
+	          NULL,
+	          modi_test_deflate_compressed_data,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_deflate_decompress_zlib(
+	          context,
 	          NULL,
 	          2627,
 	          uncompressed_data,
@@ -2614,6 +3399,7 @@ int modi_test_deflate_decompress_zlib(
 	 &error );
 
 	result = libmodi_deflate_decompress_zlib(
+	          context,
 	          modi_test_deflate_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
 	          uncompressed_data,
@@ -2633,6 +3419,7 @@ int modi_test_deflate_decompress_zlib(
 	 &error );
 
 	result = libmodi_deflate_decompress_zlib(
+	          context,
 	          modi_test_deflate_compressed_data,
 	          2627,
 	          NULL,
@@ -2652,6 +3439,7 @@ int modi_test_deflate_decompress_zlib(
 	 &error );
 
 	result = libmodi_deflate_decompress_zlib(
+	          context,
 	          modi_test_deflate_compressed_data,
 	          2627,
 	          uncompressed_data,
@@ -2670,6 +3458,25 @@ int modi_test_deflate_decompress_zlib(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libmodi_deflate_context_free(
+	          &context,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -2678,6 +3485,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( context != NULL )
+	{
+		libmodi_deflate_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2708,6 +3521,14 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
 
+	MODI_TEST_RUN(
+	 "libmodi_deflate_context_initialize",
+	 modi_test_deflate_context_initialize );
+
+	MODI_TEST_RUN(
+	 "libmodi_deflate_context_free",
+	 modi_test_deflate_context_free );
+
 	MODI_TEST_RUN(
 	 "libmodi_deflate_build_dynamic_huffman_trees",
 	 modi_test_deflate_build_dynamic_huffman_trees );
@@ -2716,6 +3537,10 @@ int main(
 	 "libmodi_deflate_build_fixed_huffman_trees",
 	 modi_test_deflate_build_fixed_huffman_trees );
 
+	MODI_TEST_RUN(
+	 "libmodi_deflate_get_fixed_huffman_trees",
+	 modi_test_deflate_get_fixed_huffman_trees );
+
 	MODI_TEST_RUN(
 	 "libmodi_deflate_decode_huffman",
 	 modi_test_deflate_decode_huffman );
@@ -2724,6 +3549,10 @@ int main(
 	 "libmodi_deflate_calculate_adler32",
 	 modi_test_deflate_calculate_adler32 );
 
+	MODI_TEST_RUN(
+	 "libmodi_deflate_calculate_adler32_scalar",
+	 modi_test_deflate_calculate_adler32_scalar );
+
 	MODI_TEST_RUN(
 	 "libmodi_deflate_read_data_header",
 	 modi_test_deflate_read_data_header );
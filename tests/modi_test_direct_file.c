@@ -0,0 +1,929 @@
+/*
+ * Direct file IO handle testing program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "modi_test_libbfio.h"
+#include "modi_test_libcerror.h"
+#include "modi_test_libcnotify.h"
+#include "modi_test_macros.h"
+#include "modi_test_memory.h"
+#include "modi_test_unused.h"
+
+#include "../libmodi/libmodi_direct_file.h"
+
+/* Define to make modi_test_direct_file generate verbose output
+#define MODI_TEST_DIRECT_FILE_VERBOSE
+ */
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+/* Tests the libmodi_direct_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_direct_file_io_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libmodi_direct_file_io_handle_t *file_io_handle = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 2;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_direct_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_direct_file_io_handle_initialize(
+	          NULL,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_io_handle = (libmodi_direct_file_io_handle_t *) 0x12345678UL;
+
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	file_io_handle = NULL;
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          NULL,
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          0,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_direct_file_io_handle_initialize with malloc failing
+		 */
+		modi_test_malloc_attempts_before_fail = test_number;
+
+		result = libmodi_direct_file_io_handle_initialize(
+		          &file_io_handle,
+		          "modi_test_direct_file_does_not_exist",
+		          36,
+		          &error );
+
+		if( modi_test_malloc_attempts_before_fail != -1 )
+		{
+			modi_test_malloc_attempts_before_fail = -1;
+
+			if( file_io_handle != NULL )
+			{
+				libmodi_direct_file_io_handle_free(
+				 &file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "file_io_handle",
+			 file_io_handle );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_direct_file_io_handle_initialize with memset failing
+		 */
+		modi_test_memset_attempts_before_fail = test_number;
+
+		result = libmodi_direct_file_io_handle_initialize(
+		          &file_io_handle,
+		          "modi_test_direct_file_does_not_exist",
+		          36,
+		          &error );
+
+		if( modi_test_memset_attempts_before_fail != -1 )
+		{
+			modi_test_memset_attempts_before_fail = -1;
+
+			if( file_io_handle != NULL )
+			{
+				libmodi_direct_file_io_handle_free(
+				 &file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "file_io_handle",
+			 file_io_handle );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MODI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libmodi_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_direct_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_direct_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmodi_direct_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_direct_file_io_handle_open function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_direct_file_io_handle_open(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libmodi_direct_file_io_handle_t *file_io_handle = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_direct_file_io_handle_open(
+	          NULL,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_direct_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ | LIBBFIO_ACCESS_FLAG_WRITE,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_direct_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_direct_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libmodi_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_direct_file_io_handle_is_open function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_direct_file_io_handle_is_open(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libmodi_direct_file_io_handle_t *file_io_handle = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_direct_file_io_handle_is_open(
+	          file_io_handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_direct_file_io_handle_is_open(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_direct_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libmodi_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_direct_file_io_handle_read function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_direct_file_io_handle_read(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                        = NULL;
+	libmodi_direct_file_io_handle_t *file_io_handle = NULL;
+	ssize_t read_count                              = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libmodi_direct_file_io_handle_read(
+	          NULL,
+	          buffer,
+	          16,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "read_count",
+	 (int) read_count,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libmodi_direct_file_io_handle_read(
+	          file_io_handle,
+	          buffer,
+	          16,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "read_count",
+	 (int) read_count,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_direct_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libmodi_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_direct_file_io_handle_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_direct_file_io_handle_seek_offset(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libmodi_direct_file_io_handle_t *file_io_handle = NULL;
+	off64_t offset                                  = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libmodi_direct_file_io_handle_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "offset",
+	 (int) offset,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libmodi_direct_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "offset",
+	 (int) offset,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_direct_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libmodi_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_direct_file_io_handle_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_direct_file_io_handle_get_size(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libmodi_direct_file_io_handle_t *file_io_handle = NULL;
+	size64_t size                                   = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_direct_file_io_handle_initialize(
+	          &file_io_handle,
+	          "modi_test_direct_file_does_not_exist",
+	          36,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_direct_file_io_handle_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_direct_file_io_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_direct_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libmodi_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MODI_TEST_UNREFERENCED_PARAMETER( argc )
+	MODI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( MODI_TEST_DIRECT_FILE_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+	MODI_TEST_RUN(
+	 "libmodi_direct_file_io_handle_initialize",
+	 modi_test_direct_file_io_handle_initialize );
+
+	MODI_TEST_RUN(
+	 "libmodi_direct_file_io_handle_free",
+	 modi_test_direct_file_io_handle_free );
+
+	MODI_TEST_RUN(
+	 "libmodi_direct_file_io_handle_open",
+	 modi_test_direct_file_io_handle_open );
+
+	MODI_TEST_RUN(
+	 "libmodi_direct_file_io_handle_is_open",
+	 modi_test_direct_file_io_handle_is_open );
+
+	MODI_TEST_RUN(
+	 "libmodi_direct_file_io_handle_read",
+	 modi_test_direct_file_io_handle_read );
+
+	MODI_TEST_RUN(
+	 "libmodi_direct_file_io_handle_seek_offset",
+	 modi_test_direct_file_io_handle_seek_offset );
+
+	MODI_TEST_RUN(
+	 "libmodi_direct_file_io_handle_get_size",
+	 modi_test_direct_file_io_handle_get_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,578 @@
+/*
+ * Library extent type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "modi_test_libcerror.h"
+#include "modi_test_libcnotify.h"
+#include "modi_test_libmodi.h"
+#include "modi_test_macros.h"
+#include "modi_test_memory.h"
+#include "modi_test_unused.h"
+
+#include "../libmodi/libmodi_extent.h"
+
+/* Define to make modi_test_extent generate verbose output
+#define MODI_TEST_EXTENT_VERBOSE
+ */
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+/* Tests the libmodi_extent_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_extent_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libmodi_extent_t *extent = NULL;
+	int result               = 0;
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_extent_initialize(
+	          &extent,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_extent_free(
+	          &extent,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "extent",
+	 extent );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_extent_initialize(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent = (libmodi_extent_t *) 0x12345678UL;
+
+	result = libmodi_extent_initialize(
+	          &extent,
+	          &error );
+
+	extent = NULL;
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_extent_initialize with malloc failing
+		 */
+		modi_test_malloc_attempts_before_fail = test_number;
+
+		result = libmodi_extent_initialize(
+		          &extent,
+		          &error );
+
+		if( modi_test_malloc_attempts_before_fail != -1 )
+		{
+			modi_test_malloc_attempts_before_fail = -1;
+
+			if( extent != NULL )
+			{
+				libmodi_extent_free(
+				 &extent,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "extent",
+			 extent );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_extent_initialize with memset failing
+		 */
+		modi_test_memset_attempts_before_fail = test_number;
+
+		result = libmodi_extent_initialize(
+		          &extent,
+		          &error );
+
+		if( modi_test_memset_attempts_before_fail != -1 )
+		{
+			modi_test_memset_attempts_before_fail = -1;
+
+			if( extent != NULL )
+			{
+				libmodi_extent_free(
+				 &extent,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "extent",
+			 extent );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MODI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent != NULL )
+	{
+		libmodi_extent_free(
+		 &extent,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_extent_free function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_extent_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmodi_extent_free(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_extent_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_extent_get_values(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libmodi_extent_t *extent = NULL;
+	size64_t size            = 0;
+	size64_t stored_size     = 0;
+	off64_t offset           = 0;
+	uint32_t flags           = 0;
+	int compression_method   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_extent_initialize(
+	          &extent,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->offset             = 1048576;
+	extent->size               = 2048;
+	extent->stored_size        = 512;
+	extent->compression_method = LIBMODI_COMPRESSION_METHOD_DEFLATE;
+	extent->flags              = LIBMODI_EXTENT_FLAG_IS_COMPRESSED;
+
+	/* Test regular cases
+	 */
+	result = libmodi_extent_get_values(
+	          extent,
+	          &offset,
+	          &size,
+	          &stored_size,
+	          &compression_method,
+	          &flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1048576 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 2048 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "stored_size",
+	 (uint64_t) stored_size,
+	 (uint64_t) 512 );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "compression_method",
+	 compression_method,
+	 LIBMODI_COMPRESSION_METHOD_DEFLATE );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) LIBMODI_EXTENT_FLAG_IS_COMPRESSED );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_extent_get_values(
+	          NULL,
+	          &offset,
+	          &size,
+	          &stored_size,
+	          &compression_method,
+	          &flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_extent_get_values(
+	          extent,
+	          NULL,
+	          &size,
+	          &stored_size,
+	          &compression_method,
+	          &flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_extent_get_values(
+	          extent,
+	          &offset,
+	          NULL,
+	          &stored_size,
+	          &compression_method,
+	          &flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_extent_get_values(
+	          extent,
+	          &offset,
+	          &size,
+	          NULL,
+	          &compression_method,
+	          &flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_extent_get_values(
+	          extent,
+	          &offset,
+	          &size,
+	          &stored_size,
+	          NULL,
+	          &flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_extent_get_values(
+	          extent,
+	          &offset,
+	          &size,
+	          &stored_size,
+	          &compression_method,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_extent_free(
+	          &extent,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "extent",
+	 extent );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent != NULL )
+	{
+		libmodi_extent_free(
+		 &extent,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MODI_TEST_UNREFERENCED_PARAMETER( argc )
+	MODI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( MODI_TEST_EXTENT_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+	MODI_TEST_RUN(
+	 "libmodi_extent_initialize",
+	 modi_test_extent_initialize );
+
+	MODI_TEST_RUN(
+	 "libmodi_extent_free",
+	 modi_test_extent_free );
+
+	MODI_TEST_RUN(
+	 "libmodi_extent_get_values",
+	 modi_test_extent_get_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+}
+
@@ -47,6 +47,7 @@
 #include "modi_test_memory.h"
 #include "modi_test_unused.h"
 
+#include "../libmodi/libmodi_extent.h"
 #include "../libmodi/libmodi_handle.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -2046,6 +2047,29 @@ int modi_test_handle_seek_offset(
 	 "error",
 	 error );
 
+	if( size > 0 )
+	{
+		offset = libmodi_handle_seek_offset(
+		          handle,
+		          0,
+		          LIBMODI_SEEK_HOLE,
+		          &error );
+
+		MODI_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) -1 );
+
+		MODI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		MODI_TEST_ASSERT_LESS_THAN_UINT64(
+		 "offset",
+		 (uint64_t) offset,
+		 (uint64_t) ( size + 1 ) );
+	}
+
 	/* Reset offset to 0
 	 */
 	offset = libmodi_handle_seek_offset(
@@ -2054,78 +2078,1467 @@ int modi_test_handle_seek_offset(
 	          SEEK_SET,
 	          &error );
 
-	MODI_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libmodi_handle_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libmodi_handle_seek_offset(
+	          handle,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libmodi_handle_seek_offset(
+	          handle,
+	          -1,
+	          SEEK_CUR,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	offset = libmodi_handle_seek_offset(
+	          handle,
+	          (off64_t) ( -1 * ( size + 1 ) ),
+	          SEEK_END,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libmodi_handle_seek_offset(
+	          handle,
+	          (off64_t) size,
+	          LIBMODI_SEEK_HOLE,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_offset(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int offset_is_set        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmodi_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	MODI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( offset_is_set != 0 )
+	{
+		result = libmodi_handle_get_offset(
+		          handle,
+		          NULL,
+		          &error );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MODI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_set_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_set_maximum_cache_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libmodi_handle_t *handle = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_handle_initialize(
+	          &handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_handle_set_maximum_cache_size(
+	          handle,
+	          1024 * 1024,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_handle_set_maximum_cache_size(
+	          handle,
+	          0,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_set_maximum_cache_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_handle_free(
+	          &handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libmodi_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_media_size function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_media_size(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t media_size      = 0;
+	int media_size_is_set    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmodi_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	MODI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	media_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_media_size(
+	          NULL,
+	          &media_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( media_size_is_set != 0 )
+	{
+		result = libmodi_handle_get_media_size(
+		          handle,
+		          NULL,
+		          &error );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MODI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_statistics_value function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_statistics_value(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int expected_result      = 0;
+	int result               = 0;
+
+#if defined( HAVE_STATISTICS )
+	expected_result = 1;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_handle_get_statistics_value(
+	          handle,
+	          LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS,
+	          &value,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_handle_get_statistics_value(
+	          handle,
+	          LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS_PER_SIZE_RANGE + LIBMODI_STATISTICS_NUMBER_OF_READ_SIZE_RANGES - 1,
+	          &value,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_handle_get_statistics_value(
+	          handle,
+	          LIBMODI_STATISTICS_VALUE_DECOMPRESSION_TIME + LIBMODI_COMPRESSION_METHOD_DEFLATE,
+	          &value,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an unsupported value type
+	 */
+	result = libmodi_handle_get_statistics_value(
+	          handle,
+	          LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS_PER_SIZE_RANGE + LIBMODI_STATISTICS_NUMBER_OF_READ_SIZE_RANGES,
+	          &value,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_statistics_value(
+	          NULL,
+	          LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS,
+	          &value,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_handle_get_statistics_value(
+	          handle,
+	          LIBMODI_STATISTICS_VALUE_NUMBER_OF_READS,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_number_of_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_number_of_extents(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmodi_handle_get_number_of_extents(
+	          handle,
+	          &number_of_extents,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_handle_get_number_of_extents(
+	          handle,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_extent_by_index(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t extent_size     = 0;
+	size64_t media_size      = 0;
+	size64_t stored_size     = 0;
+	off64_t extent_offset    = 0;
+	off64_t expected_offset  = 0;
+	uint32_t extent_flags    = 0;
+	int compression_method   = 0;
+	int extent_index         = 0;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	result = libmodi_handle_get_number_of_extents(
+	          handle,
+	          &number_of_extents,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		result = libmodi_handle_get_extent_by_index(
+		          handle,
+		          extent_index,
+		          &extent_offset,
+		          &extent_size,
+		          &stored_size,
+		          &compression_method,
+		          &extent_flags,
+		          &error );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MODI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		MODI_TEST_ASSERT_EQUAL_INT64(
+		 "extent_offset",
+		 (int64_t) extent_offset,
+		 (int64_t) expected_offset );
+
+		expected_offset += (off64_t) extent_size;
+	}
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 (uint64_t) expected_offset,
+	 (uint64_t) media_size );
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &stored_size,
+	          &compression_method,
+	          &extent_flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_handle_get_extent_by_index(
+	          handle,
+	          -1,
+	          &extent_offset,
+	          &extent_size,
+	          &stored_size,
+	          &compression_method,
+	          &extent_flags,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_extents > 0 )
+	{
+		result = libmodi_handle_get_extent_by_index(
+		          handle,
+		          0,
+		          NULL,
+		          &extent_size,
+		          &stored_size,
+		          &compression_method,
+		          &extent_flags,
+		          &error );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MODI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_data_or_hole_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_data_or_hole_offset(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error    = NULL;
+	off64_t current_offset      = 0;
+	off64_t data_or_hole_offset = 0;
+	off64_t offset              = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	offset = libmodi_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_handle_get_data_or_hole_offset(
+	          handle,
+	          0,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the current offset was not changed
+	 */
+	result = libmodi_handle_get_offset(
+	          handle,
+	          &current_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "current_offset",
+	 current_offset,
+	 (int64_t) 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_data_or_hole_offset(
+	          NULL,
+	          0,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_handle_get_data_or_hole_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_handle_get_data_or_hole_offset(
+	          handle,
+	          0,
+	          LIBMODI_SEEK_HOLE,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_number_of_partitions function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_number_of_partitions(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_partitions = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmodi_handle_get_number_of_partitions(
+	          handle,
+	          &number_of_partitions,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_number_of_partitions(
+	          NULL,
+	          &number_of_partitions,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_handle_get_number_of_partitions(
+	          handle,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_handle_get_partition_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_handle_get_partition_by_index(
+     libmodi_handle_t *handle )
+{
+	libcerror_error_t *error      = NULL;
+	size64_t media_size           = 0;
+	size64_t partition_size       = 0;
+	off64_t expected_offset       = 0;
+	off64_t partition_offset      = 0;
+	uint32_t partition_attributes = 0;
+	int32_t partition_identifier  = 0;
+	int number_of_partitions      = 0;
+	int partition_index           = 0;
+	int result                    = 0;
+
+	result = libmodi_handle_get_number_of_partitions(
+	          handle,
+	          &number_of_partitions,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		result = libmodi_handle_get_partition_by_index(
+		          handle,
+		          partition_index,
+		          &partition_offset,
+		          &partition_size,
+		          &partition_identifier,
+		          &partition_attributes,
+		          &error );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MODI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		MODI_TEST_ASSERT_EQUAL_INT64(
+		 "partition_offset",
+		 (int64_t) partition_offset,
+		 (int64_t) expected_offset );
+
+		expected_offset += (off64_t) partition_size;
+	}
+	if( number_of_partitions > 0 )
+	{
+		MODI_TEST_ASSERT_EQUAL_UINT64(
+		 "media_size",
+		 (uint64_t) expected_offset,
+		 (uint64_t) media_size );
+	}
+	/* Test error cases
+	 */
+	result = libmodi_handle_get_partition_by_index(
+	          NULL,
+	          0,
+	          &partition_offset,
+	          &partition_size,
+	          &partition_identifier,
+	          &partition_attributes,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_handle_get_partition_by_index(
+	          handle,
+	          -1,
+	          &partition_offset,
+	          &partition_size,
+	          &partition_identifier,
+	          &partition_attributes,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_partitions > 0 )
+	{
+		result = libmodi_handle_get_partition_by_index(
+		          handle,
+		          0,
+		          NULL,
+		          &partition_size,
+		          &partition_identifier,
+		          &partition_attributes,
+		          &error );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MODI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+/* Tests the libmodi_internal_handle_get_data_or_hole_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_internal_handle_get_data_or_hole_offset(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libmodi_extent_t *extent                   = NULL;
+	libmodi_handle_t *handle                   = NULL;
+	libmodi_internal_handle_t *internal_handle = NULL;
+	off64_t data_or_hole_offset                = 0;
+	off64_t offset                             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_handle_initialize(
+	          &handle,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libmodi_internal_handle_t *) handle;
+
+	internal_handle->io_handle->media_size = 4096;
+
+	result = libcdata_array_initialize(
+	          &( internal_handle->extents_array ),
+	          0,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The media data consists of: data 0 - 1024, hole 1024 - 2048,
+	 * data 2048 - 3072 and hole 3072 - 4096
+	 */
+	for( offset = 0;
+	     offset < 4096;
+	     offset += 1024 )
+	{
+		result = libmodi_internal_handle_append_extent(
+		          internal_handle,
+		          offset,
+		          1024,
+		          ( ( offset % 2048 ) == 0 ) ? 1024 : 0,
+		          LIBMODI_COMPRESSION_METHOD_NONE,
+		          ( ( offset % 2048 ) == 0 ) ? 0 : LIBMODI_EXTENT_FLAG_IS_SPARSE,
+		          &error );
+
+		MODI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MODI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          0,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          512,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 512 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          1023,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 1024 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          1024,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 1024 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          1024,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 2048 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          2047,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 2048 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          2048,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 3072 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a hole at the end of the media data
+	 */
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          4095,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 4095 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test no data after a hole at the end of the media data
+	 */
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          3072,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	MODI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test data at the end of the media data, which is followed by an implicit hole
 	 */
-	offset = libmodi_handle_seek_offset(
-	          NULL,
-	          0,
-	          SEEK_SET,
+	result = libcdata_array_get_entry_by_index(
+	          internal_handle->extents_array,
+	          3,
+	          (intptr_t **) &extent,
 	          &error );
 
-	MODI_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	MODI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	extent->stored_size = 1024;
+	extent->flags       = 0;
 
-	offset = libmodi_handle_seek_offset(
-	          handle,
-	          -1,
-	          SEEK_SET,
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          2048,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
 	          &error );
 
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	MODI_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 4096 );
 
-	MODI_TEST_ASSERT_IS_NOT_NULL(
+	MODI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	offset = libmodi_handle_seek_offset(
-	          handle,
-	          -1,
-	          SEEK_CUR,
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          3072,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
 	          &error );
 
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	MODI_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	 "data_or_hole_offset",
+	 data_or_hole_offset,
+	 (int64_t) 3072 );
 
-	MODI_TEST_ASSERT_IS_NOT_NULL(
+	MODI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libmodi_handle_seek_offset(
-	          handle,
-	          (off64_t) ( -1 * ( size + 1 ) ),
-	          SEEK_END,
+	/* Test error cases
+	 */
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          NULL,
+	          0,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
 	          &error );
 
-	MODI_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2134,51 +3547,49 @@ int modi_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          0,
+	          SEEK_SET,
+	          &data_or_hole_offset,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libmodi_handle_get_offset function
- * Returns 1 if successful or 0 if not
- */
-int modi_test_handle_get_offset(
-     libmodi_handle_t *handle )
-{
-	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
-	int offset_is_set        = 0;
-	int result               = 0;
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libmodi_handle_get_offset(
-	          handle,
-	          &offset,
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          -1,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
 	          &error );
 
-	MODI_TEST_ASSERT_NOT_EQUAL_INT(
+	MODI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	MODI_TEST_ASSERT_IS_NULL(
+	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	offset_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libmodi_handle_get_offset(
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          0,
+	          LIBMODI_SEEK_DATA,
 	          NULL,
-	          &offset,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -2193,70 +3604,51 @@ int modi_test_handle_get_offset(
 	libcerror_error_free(
 	 &error );
 
-	if( offset_is_set != 0 )
-	{
-		result = libmodi_handle_get_offset(
-		          handle,
-		          NULL,
-		          &error );
-
-		MODI_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		MODI_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	/* Test offsets at and past the end of the media data
+	 */
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          4096,
+	          LIBMODI_SEEK_DATA,
+	          &data_or_hole_offset,
+	          &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-/* Tests the libmodi_handle_get_media_size function
- * Returns 1 if successful or 0 if not
- */
-int modi_test_handle_get_media_size(
-     libmodi_handle_t *handle )
-{
-	libcerror_error_t *error = NULL;
-	size64_t media_size      = 0;
-	int media_size_is_set    = 0;
-	int result               = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Test regular cases
-	 */
-	result = libmodi_handle_get_media_size(
-	          handle,
-	          &media_size,
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          4096,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
 	          &error );
 
-	MODI_TEST_ASSERT_NOT_EQUAL_INT(
+	MODI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	MODI_TEST_ASSERT_IS_NULL(
+	MODI_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	media_size_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libmodi_handle_get_media_size(
-	          NULL,
-	          &media_size,
+	result = libmodi_internal_handle_get_data_or_hole_offset(
+	          internal_handle,
+	          8192,
+	          LIBMODI_SEEK_HOLE,
+	          &data_or_hole_offset,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -2271,25 +3663,25 @@ int modi_test_handle_get_media_size(
 	libcerror_error_free(
 	 &error );
 
-	if( media_size_is_set != 0 )
-	{
-		result = libmodi_handle_get_media_size(
-		          handle,
-		          NULL,
-		          &error );
+	/* Clean up
+	 */
+	result = libmodi_handle_free(
+	          &handle,
+	          &error );
 
-		MODI_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		MODI_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	MODI_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -2298,9 +3690,17 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( handle != NULL )
+	{
+		libmodi_handle_free(
+		 &handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2362,6 +3762,18 @@ int main(
 	 "libmodi_handle_free",
 	 modi_test_handle_free );
 
+	MODI_TEST_RUN(
+	 "libmodi_handle_set_maximum_cache_size",
+	 modi_test_handle_set_maximum_cache_size );
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+	MODI_TEST_RUN(
+	 "libmodi_internal_handle_get_data_or_hole_offset",
+	 modi_test_internal_handle_get_data_or_hole_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2627,6 +4039,36 @@ int main(
 		 modi_test_handle_get_media_size,
 		 handle );
 
+		MODI_TEST_RUN_WITH_ARGS(
+		 "libmodi_handle_get_statistics_value",
+		 modi_test_handle_get_statistics_value,
+		 handle );
+
+		MODI_TEST_RUN_WITH_ARGS(
+		 "libmodi_handle_get_number_of_extents",
+		 modi_test_handle_get_number_of_extents,
+		 handle );
+
+		MODI_TEST_RUN_WITH_ARGS(
+		 "libmodi_handle_get_extent_by_index",
+		 modi_test_handle_get_extent_by_index,
+		 handle );
+
+		MODI_TEST_RUN_WITH_ARGS(
+		 "libmodi_handle_get_data_or_hole_offset",
+		 modi_test_handle_get_data_or_hole_offset,
+		 handle );
+
+		MODI_TEST_RUN_WITH_ARGS(
+		 "libmodi_handle_get_number_of_partitions",
+		 modi_test_handle_get_number_of_partitions,
+		 handle );
+
+		MODI_TEST_RUN_WITH_ARGS(
+		 "libmodi_handle_get_partition_by_index",
+		 modi_test_handle_get_partition_by_index,
+		 handle );
+
 		/* Clean up
 		 */
 		result = modi_test_handle_close_source(
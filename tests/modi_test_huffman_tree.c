@@ -514,6 +514,7 @@ int modi_test_huffman_tree_build(
 	          huffman_tree,
 	          code_size_array,
 	          288,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -531,6 +532,7 @@ int modi_test_huffman_tree_build(
 	          NULL,
 	          code_size_array,
 	          288,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -549,6 +551,7 @@ int modi_test_huffman_tree_build(
 	          huffman_tree,
 	          NULL,
 	          288,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -567,6 +570,26 @@ int modi_test_huffman_tree_build(
 	          huffman_tree,
 	          code_size_array,
 	          -1,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          288,
+	          0xff,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -591,6 +614,7 @@ int modi_test_huffman_tree_build(
 	          huffman_tree,
 	          code_size_array,
 	          288,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	if( modi_test_malloc_attempts_before_fail != -1 )
@@ -621,6 +645,7 @@ int modi_test_huffman_tree_build(
 	          huffman_tree,
 	          code_size_array,
 	          288,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	if( modi_test_memset_attempts_before_fail != -1 )
@@ -762,6 +787,7 @@ int modi_test_huffman_tree_get_symbol_from_bit_stream(
 	          huffman_tree,
 	          code_size_array,
 	          288,
+	          LIBMODI_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	MODI_TEST_ASSERT_EQUAL_INT(
@@ -0,0 +1,478 @@
+/*
+ * Memory mapped file testing program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "modi_test_libcerror.h"
+#include "modi_test_libcnotify.h"
+#include "modi_test_macros.h"
+#include "modi_test_memory.h"
+#include "modi_test_unused.h"
+
+#include "../libmodi/libmodi_mapped_file.h"
+
+/* Define to make modi_test_mapped_file generate verbose output
+#define MODI_TEST_MAPPED_FILE_VERBOSE
+ */
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+/* Tests the libmodi_mapped_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_mapped_file_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libmodi_mapped_file_t *mapped_file = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_mapped_file_initialize(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mapped_file = (libmodi_mapped_file_t *) 0x12345678UL;
+
+	result = libmodi_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	mapped_file = NULL;
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_mapped_file_initialize with malloc failing
+		 */
+		modi_test_malloc_attempts_before_fail = test_number;
+
+		result = libmodi_mapped_file_initialize(
+		          &mapped_file,
+		          &error );
+
+		if( modi_test_malloc_attempts_before_fail != -1 )
+		{
+			modi_test_malloc_attempts_before_fail = -1;
+
+			if( mapped_file != NULL )
+			{
+				libmodi_mapped_file_free(
+				 &mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "mapped_file",
+			 mapped_file );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_mapped_file_initialize with memset failing
+		 */
+		modi_test_memset_attempts_before_fail = test_number;
+
+		result = libmodi_mapped_file_initialize(
+		          &mapped_file,
+		          &error );
+
+		if( modi_test_memset_attempts_before_fail != -1 )
+		{
+			modi_test_memset_attempts_before_fail = -1;
+
+			if( mapped_file != NULL )
+			{
+				libmodi_mapped_file_free(
+				 &mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "mapped_file",
+			 mapped_file );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MODI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		libmodi_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_mapped_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_mapped_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmodi_mapped_file_free(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_mapped_file_open and libmodi_mapped_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_mapped_file_open_close(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libmodi_mapped_file_t *mapped_file = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_mapped_file_open(
+	          mapped_file,
+	          "modi_test_mapped_file_does_not_exist",
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "mapped_file->data",
+	 mapped_file->data );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_mapped_file_close(
+	          mapped_file,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_mapped_file_open(
+	          NULL,
+	          "modi_test_mapped_file_does_not_exist",
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_mapped_file_open(
+	          mapped_file,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_mapped_file_close(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		libmodi_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MODI_TEST_UNREFERENCED_PARAMETER( argc )
+	MODI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( MODI_TEST_MAPPED_FILE_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+	MODI_TEST_RUN(
+	 "libmodi_mapped_file_initialize",
+	 modi_test_mapped_file_initialize );
+
+	MODI_TEST_RUN(
+	 "libmodi_mapped_file_free",
+	 modi_test_mapped_file_free );
+
+	MODI_TEST_RUN(
+	 "libmodi_mapped_file_open_close",
+	 modi_test_mapped_file_open_close );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1366 @@
+/*
+ * Library partition type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "modi_test_libcerror.h"
+#include "modi_test_libcnotify.h"
+#include "modi_test_libmodi.h"
+#include "modi_test_macros.h"
+#include "modi_test_memory.h"
+#include "modi_test_unused.h"
+
+#include "../libmodi/libmodi_partition.h"
+
+/* Define to make modi_test_partition generate verbose output
+#define MODI_TEST_PARTITION_VERBOSE
+ */
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+/* Tests the libmodi_partition_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmodi_partition_t *partition = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_partition_free(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_initialize(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	partition = (libmodi_partition_t *) 0x12345678UL;
+
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	partition = NULL;
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MODI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_partition_initialize with malloc failing
+		 */
+		modi_test_malloc_attempts_before_fail = test_number;
+
+		result = libmodi_partition_initialize(
+		          &partition,
+		          &error );
+
+		if( modi_test_malloc_attempts_before_fail != -1 )
+		{
+			modi_test_malloc_attempts_before_fail = -1;
+
+			if( partition != NULL )
+			{
+				libmodi_partition_free(
+				 &partition,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "partition",
+			 partition );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmodi_partition_initialize with memset failing
+		 */
+		modi_test_memset_attempts_before_fail = test_number;
+
+		result = libmodi_partition_initialize(
+		          &partition,
+		          &error );
+
+		if( modi_test_memset_attempts_before_fail != -1 )
+		{
+			modi_test_memset_attempts_before_fail = -1;
+
+			if( partition != NULL )
+			{
+				libmodi_partition_free(
+				 &partition,
+				 NULL );
+			}
+		}
+		else
+		{
+			MODI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MODI_TEST_ASSERT_IS_NULL(
+			 "partition",
+			 partition );
+
+			MODI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MODI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_partition_free function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_free(
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_partition_set_name function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_set_name(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmodi_partition_t *partition = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_partition_set_name(
+	          partition,
+	          (uint8_t *) "Apple_HFS : 3",
+	          14,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "partition->name_size",
+	 partition->name_size,
+	 (size_t) 14 );
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_set_name(
+	          NULL,
+	          (uint8_t *) "Apple_HFS : 3",
+	          14,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_set_name(
+	          partition,
+	          (uint8_t *) "Apple_HFS : 3",
+	          14,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 partition->name );
+
+	partition->name = NULL;
+
+	result = libmodi_partition_set_name(
+	          partition,
+	          NULL,
+	          14,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_set_name(
+	          partition,
+	          (uint8_t *) "Apple_HFS : 3",
+	          0,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_partition_free(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_partition_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_get_values(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmodi_partition_t *partition = NULL;
+	size64_t size                  = 0;
+	off64_t offset                 = 0;
+	uint32_t attributes            = 0;
+	int32_t identifier             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	partition->offset     = 32768;
+	partition->size       = 1048576;
+	partition->identifier = 3;
+	partition->attributes = 0x00000050UL;
+
+	/* Test regular cases
+	 */
+	result = libmodi_partition_get_values(
+	          partition,
+	          &offset,
+	          &size,
+	          &identifier,
+	          &attributes,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 32768 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 1048576 );
+
+	MODI_TEST_ASSERT_EQUAL_INT32(
+	 "identifier",
+	 identifier,
+	 (int32_t) 3 );
+
+	MODI_TEST_ASSERT_EQUAL_UINT32(
+	 "attributes",
+	 attributes,
+	 (uint32_t) 0x00000050UL );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_get_values(
+	          NULL,
+	          &offset,
+	          &size,
+	          &identifier,
+	          &attributes,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_values(
+	          partition,
+	          NULL,
+	          &size,
+	          &identifier,
+	          &attributes,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_values(
+	          partition,
+	          &offset,
+	          NULL,
+	          &identifier,
+	          &attributes,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_values(
+	          partition,
+	          &offset,
+	          &size,
+	          NULL,
+	          &attributes,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_values(
+	          partition,
+	          &offset,
+	          &size,
+	          &identifier,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_partition_free(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_partition_get_utf8_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_get_utf8_name_size(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmodi_partition_t *partition = NULL;
+	size_t utf8_string_size        = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_partition_get_utf8_name_size(
+	          partition,
+	          &utf8_string_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_partition_set_name(
+	          partition,
+	          (uint8_t *) "Apple_HFS : 3",
+	          13,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_partition_get_utf8_name_size(
+	          partition,
+	          &utf8_string_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 14 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_get_utf8_name_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_utf8_name_size(
+	          partition,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_partition_free(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_partition_get_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_get_utf8_name(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error       = NULL;
+	libmodi_partition_t *partition = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_partition_set_name(
+	          partition,
+	          (uint8_t *) "Apple_HFS : 3",
+	          14,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_partition_get_utf8_name(
+	          partition,
+	          utf8_string,
+	          32,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Apple_HFS : 3",
+	          14 );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_get_utf8_name(
+	          NULL,
+	          utf8_string,
+	          32,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_utf8_name(
+	          partition,
+	          NULL,
+	          32,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_utf8_name(
+	          partition,
+	          utf8_string,
+	          4,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_partition_free(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_partition_get_utf16_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_get_utf16_name_size(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmodi_partition_t *partition = NULL;
+	size_t utf16_string_size       = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_partition_get_utf16_name_size(
+	          partition,
+	          &utf16_string_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_partition_set_name(
+	          partition,
+	          (uint8_t *) "Apple_HFS : 3",
+	          13,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_partition_get_utf16_name_size(
+	          partition,
+	          &utf16_string_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 14 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_get_utf16_name_size(
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_utf16_name_size(
+	          partition,
+	          NULL,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_partition_free(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmodi_partition_get_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int modi_test_partition_get_utf16_name(
+     void )
+{
+	uint16_t expected_utf16_string[ 14 ] = {
+		'A', 'p', 'p', 'l', 'e', '_', 'H', 'F', 'S', ' ', ':', ' ', '3', 0 };
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error       = NULL;
+	libmodi_partition_t *partition = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmodi_partition_initialize(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmodi_partition_set_name(
+	          partition,
+	          (uint8_t *) "Apple_HFS : 3",
+	          14,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmodi_partition_get_utf16_name(
+	          partition,
+	          utf16_string,
+	          32,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 14 );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmodi_partition_get_utf16_name(
+	          NULL,
+	          utf16_string,
+	          32,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_utf16_name(
+	          partition,
+	          NULL,
+	          32,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmodi_partition_get_utf16_name(
+	          partition,
+	          utf16_string,
+	          4,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MODI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmodi_partition_free(
+	          &partition,
+	          &error );
+
+	MODI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	MODI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libmodi_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MODI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MODI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MODI_TEST_UNREFERENCED_PARAMETER( argc )
+	MODI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( MODI_TEST_PARTITION_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_initialize",
+	 modi_test_partition_initialize );
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_free",
+	 modi_test_partition_free );
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_set_name",
+	 modi_test_partition_set_name );
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_get_values",
+	 modi_test_partition_get_values );
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_get_utf8_name_size",
+	 modi_test_partition_get_utf8_name_size );
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_get_utf8_name",
+	 modi_test_partition_get_utf8_name );
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_get_utf16_name_size",
+	 modi_test_partition_get_utf16_name_size );
+
+	MODI_TEST_RUN(
+	 "libmodi_partition_get_utf16_name",
+	 modi_test_partition_get_utf16_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMODI_DLL_IMPORT ) */
+}
+
@@ -394,6 +394,84 @@ class HandleTypeTests(unittest.TestCase):
 
     modi_handle.close()
 
+  def test_get_number_of_extents(self):
+    """Tests the get_number_of_extents function and number_of_extents property."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    modi_handle = pymodi.handle()
+
+    modi_handle.open(test_source)
+
+    number_of_extents = modi_handle.get_number_of_extents()
+    self.assertIsNotNone(number_of_extents)
+
+    self.assertIsNotNone(modi_handle.number_of_extents)
+
+    modi_handle.close()
+
+  def test_get_extent(self):
+    """Tests the get_extent function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    modi_handle = pymodi.handle()
+
+    modi_handle.open(test_source)
+
+    number_of_extents = modi_handle.get_number_of_extents()
+    if number_of_extents > 0:
+      extent = modi_handle.get_extent(0)
+      self.assertIsNotNone(extent)
+      self.assertEqual(len(extent), 5)
+      self.assertEqual(extent[0], 0)
+
+    with self.assertRaises(IOError):
+      modi_handle.get_extent(number_of_extents)
+
+    modi_handle.close()
+
+  def test_get_number_of_partitions(self):
+    """Tests the get_number_of_partitions function and number_of_partitions property."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    modi_handle = pymodi.handle()
+
+    modi_handle.open(test_source)
+
+    number_of_partitions = modi_handle.get_number_of_partitions()
+    self.assertIsNotNone(number_of_partitions)
+
+    self.assertIsNotNone(modi_handle.number_of_partitions)
+
+    modi_handle.close()
+
+  def test_get_partition(self):
+    """Tests the get_partition function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    modi_handle = pymodi.handle()
+
+    modi_handle.open(test_source)
+
+    number_of_partitions = modi_handle.get_number_of_partitions()
+    if number_of_partitions > 0:
+      partition = modi_handle.get_partition(0)
+      self.assertIsNotNone(partition)
+      self.assertEqual(len(partition), 5)
+      self.assertEqual(partition[0], 0)
+
+    with self.assertRaises(IOError):
+      modi_handle.get_partition(number_of_partitions)
+
+    modi_handle.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
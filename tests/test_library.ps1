@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "bands_data_handle bit_stream bzip data_block deflate error huffman_tree io_handle notify sparse_bundle_xml_plist sparse_image_header system_string udif_block_table udif_block_table_entry udif_resource_file udif_xml_plist"
+$LibraryTests = "bands_data_handle bit_stream bzip data_block deflate direct_file error extent huffman_tree io_handle mapped_file notify partition sparse_bundle_xml_plist sparse_image_header system_string udif_block_table udif_block_table_entry udif_resource_file udif_xml_plist"
 $LibraryTestsWithInput = "handle support"
 $OptionSets = "" -split " "
 